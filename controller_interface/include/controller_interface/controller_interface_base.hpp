@@ -15,7 +15,10 @@
 #ifndef CONTROLLER_INTERFACE__CONTROLLER_INTERFACE_BASE_HPP_
 #define CONTROLLER_INTERFACE__CONTROLLER_INTERFACE_BASE_HPP_
 
+#include <atomic>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -24,10 +27,12 @@
 #include "realtime_tools/async_function_handler.hpp"
 
 #include "controller_interface/controller_interface_params.hpp"
+#include "hardware_interface/deadline_scheduling.hpp"
 #include "hardware_interface/handle.hpp"
 #include "hardware_interface/introspection.hpp"
 #include "hardware_interface/loaned_command_interface.hpp"
 #include "hardware_interface/loaned_state_interface.hpp"
+#include "hardware_interface/realtime_memory.hpp"
 
 #include "rclcpp/version.h"
 #include "rclcpp_lifecycle/lifecycle_node.hpp"
@@ -206,6 +211,71 @@ public:
 
   bool is_async() const;
 
+  /// Get the number of runtime overruns of the async thread scheduled with SCHED_DEADLINE.
+  /**
+   * The async thread is scheduled with SCHED_DEADLINE if the
+   * `async_parameters.sched_runtime` parameter is set, see
+   * hardware_interface::configure_sched_deadline().
+   *
+   * \returns 0 if the thread isn't scheduled with SCHED_DEADLINE.
+   */
+  uint64_t get_deadline_overruns() const;
+
+  /// Pin the async thread to CPUs, applied by the thread itself with its next update.
+  /**
+   * Used by the controller manager to place the async thread on the CPU topology. The CPUs replace
+   * the ones set by the `async_parameters.cpu_affinity` parameter, also for the thread created by a
+   * later configuration of the controller.
+   *
+   * \param[in] cpus CPUs the async thread is pinned to.
+   */
+  void set_async_thread_cpu_affinity(const std::vector<int> & cpus);
+
+  /// Get the memory resource for allocations in the real-time loop, e.g., by pmr containers.
+  /**
+   * The resource is a hardware_interface::RealtimeMemoryArena if the `realtime_memory_arena_size`
+   * parameter of the controller is set, and the default memory resource otherwise. The arena is
+   * created before on_init() and lives as long as the controller.
+   *
+   * \returns the memory resource, never nullptr.
+   */
+  std::pmr::memory_resource * get_realtime_memory_resource() const;
+
+  /// Get the usage of the real-time memory arena, all zero if the controller has no arena.
+  hardware_interface::RealtimeMemoryArenaStatistics get_realtime_memory_arena_statistics() const;
+
+  /// Get information if the controller is only updated on new samples of its state interfaces.
+  /**
+   * Set by the `update_trigger` parameter: `periodic` (default) updates the controller at its
+   * update rate, `state_update` only in the cycles in which \ref has_new_state_samples is true.
+   */
+  bool is_state_triggered() const;
+
+  /// Check if any trigger state interface received a new sample since the previous call.
+  /**
+   * The trigger interfaces are the claimed state interfaces listed in the `trigger_interfaces`
+   * parameter, or all claimed state interfaces if it is empty. A sample is an update of the state
+   * by its hardware component or controller, also if the value didn't change. The seen samples are
+   * consumed, so that each sample triggers a single update. Interfaces bound to the memory of a
+   * hardware component don't count their updates and never trigger.
+   * **The method called in the (real-time) control loop.**
+   *
+   * \returns true if a trigger interface received a new sample, false otherwise.
+   */
+  bool has_new_state_samples();
+
+  /// Run the following updates of the controller asynchronously.
+  /**
+   * Used by the controller manager to take a controller exceeding its execution time budget out of
+   * the control loop. The async handler has to be prepared on configure, which is the case if the
+   * controller is async or was initialized with `allow_async_demotion`. The demotion lasts only
+   * while the controller is active, it runs synchronously again once it is deactivated.
+   * **The method called in the (real-time) control loop.**
+   *
+   * \returns true if the controller runs asynchronously now, false if it can't be demoted.
+   */
+  bool demote_to_async();
+
   const std::string & get_robot_description() const;
 
   /**
@@ -312,6 +382,79 @@ public:
    */
   virtual bool is_in_chained_mode() const = 0;
 
+  /// Prepare the controller for activation outside of the real-time loop.
+  /**
+   * Method used by the controller_manager to run the first, non real-time, phase of the controller
+   * activation. It is called in the thread handling the switch request before the activation is
+   * committed in the control loop and calls \ref on_prepare_activation. The controller has to be
+   * in the `inactive` state and its interfaces are not assigned yet.
+   *
+   * \note **The method is not real-time safe and shouldn't be called in the control loop.**
+   *
+   * \returns return_type::OK if the controller is prepared for activation, otherwise
+   * return_type::ERROR.
+   */
+  return_type prepare_activation();
+
+  /// Get information if the controller was prepared for the next activation.
+  /**
+   * The flag is set by a successful \ref prepare_activation and cleared once the controller is
+   * deactivated, cleaned up or its activation is cancelled or fails, so it can be checked in
+   * `on_activate` to skip the work already done in \ref on_prepare_activation.
+   *
+   * \returns true if the controller was prepared for the next activation, false otherwise.
+   */
+  bool is_activation_prepared() const;
+
+  /// Undo the preparation of an activation that is not committed.
+  /**
+   * Method used by the controller_manager when a switch is aborted or the activation fails after
+   * \ref prepare_activation succeeded. Calls \ref on_cancel_activation if the controller is
+   * prepared and clears the flag returned by \ref is_activation_prepared.
+   *
+   * \note **The method is not real-time safe and shouldn't be called in the control loop.**
+   *
+   * \returns return_type::OK if the controller wasn't prepared or the preparation is undone,
+   * otherwise return_type::ERROR.
+   */
+  return_type cancel_activation();
+
+  /// First, non real-time, phase of the controller activation.
+  /**
+   * Override this method to perform the work of the activation that is not real-time safe, e.g.,
+   * allocating memory, reading parameters or precomputing trajectories. The second phase of the
+   * activation is `on_activate`, which is executed in the control loop when the switch is
+   * requested with `activate_asap` and should then be kept bounded.
+   *
+   * \note `on_activate` is also called without a preceding preparation, e.g., when a fallback
+   * controller is activated from the control loop. Use \ref is_activation_prepared to check it.
+   *
+   * \param[in] previous_state current lifecycle state of the controller (`inactive`).
+   * \returns CallbackReturn::SUCCESS if the controller is prepared for activation.
+   */
+  virtual CallbackReturn on_prepare_activation(const rclcpp_lifecycle::State & previous_state)
+  {
+    (void)previous_state;
+    return CallbackReturn::SUCCESS;
+  }
+
+  /// Undo the work of \ref on_prepare_activation when the activation is not committed.
+  /**
+   * Override this method to release what \ref on_prepare_activation acquired. It is called when
+   * the switch is aborted after the controller was prepared, e.g., because another controller of a
+   * STRICT switch could not be prepared or the hardware rejected the switch of the command modes,
+   * and when `on_activate` failed. In the latter case it is called from the thread activating the
+   * controller, which is the control loop for switches requested with `activate_asap`.
+   *
+   * \param[in] previous_state current lifecycle state of the controller (`inactive`).
+   * \returns CallbackReturn::SUCCESS if the preparation is undone.
+   */
+  virtual CallbackReturn on_cancel_activation(const rclcpp_lifecycle::State & previous_state)
+  {
+    (void)previous_state;
+    return CallbackReturn::SUCCESS;
+  }
+
   /**
    * Method to wait for any running async update cycle to finish after finishing the current cycle.
    * This is needed to be called before deactivating the controller by the controller_manager, so
@@ -374,12 +517,43 @@ private:
    */
   void stop_async_handler_thread();
 
+  /**
+   * Resolve the claimed trigger state interfaces on activation of a controller with the
+   * `state_update` trigger.
+   * \returns false if a trigger interface isn't claimed or bound to memory, or no trigger
+   * interface is claimed.
+   */
+  bool init_trigger_interfaces();
+
+  /// Replace SCHED_FIFO of the async thread by SCHED_DEADLINE, called by the thread itself.
+  void configure_async_thread_sched_deadline();
+
+  /// Pin the async thread to the CPUs of set_async_thread_cpu_affinity(), called by the thread.
+  void apply_async_thread_cpu_affinity();
+
   std::shared_ptr<rclcpp_lifecycle::LifecycleNode> node_;
+  // declared before the async handler, so that it outlives the allocations of the async thread
+  std::unique_ptr<hardware_interface::RealtimeMemoryArena> realtime_memory_arena_;
   std::unique_ptr<realtime_tools::AsyncFunctionHandler<return_type>> async_handler_;
-  bool is_async_ = false;
+  std::atomic_bool is_async_ = false;
+  /// Value of the `is_async` parameter on configure, restored after a demotion to async
+  bool configured_is_async_ = false;
   controller_interface::ControllerInterfaceParams ctrl_itf_params_;
   std::atomic_bool skip_async_triggers_ = false;
+  std::atomic_bool activation_prepared_ = false;
   ControllerUpdateStats trigger_stats_;
+  bool is_state_triggered_ = false;
+  std::vector<std::string> trigger_interface_names_;
+  /// Index of each trigger interface in state_interfaces_ and the update sequence seen last
+  std::vector<std::pair<size_t, uint64_t>> trigger_update_sequences_;
+  // SCHED_DEADLINE reservation of the async thread, set by the thread with its first update
+  hardware_interface::DeadlineSchedulingParams deadline_scheduling_;
+  bool async_thread_scheduled_ = false;
+  hardware_interface::DeadlineOverrunCounter deadline_overrun_counter_;
+  // CPUs the async thread is pinned to by the thread itself, guarded by the mutex
+  std::mutex async_thread_cpu_affinity_mutex_;
+  std::vector<int> async_thread_cpu_affinity_;
+  std::atomic_bool async_thread_cpu_affinity_pending_ = false;
 
 protected:
   pal_statistics::RegistrationsRAII stats_registrations_;
@@ -32,6 +32,8 @@
  * @var node_options Options for the controller node.
  * @var joint_limits A map of joint names to their limits.
  * @var soft_joint_limits A map of joint names to their soft limits.
+ * @var allow_async_demotion Prepare the async handler also for a synchronous controller, so that
+ * it can be demoted to async with \ref ControllerInterfaceBase::demote_to_async.
  *
  * This struct is used to pass parameters to the controller interface during initialization.
  * It allows for easy configuration of the controller's behavior and interaction with the robot's
@@ -53,6 +55,8 @@ struct ControllerInterfaceParams
 
   std::unordered_map<std::string, joint_limits::JointLimits> hard_joint_limits = {};
   std::unordered_map<std::string, joint_limits::SoftJointLimits> soft_joint_limits = {};
+
+  bool allow_async_demotion = false;
 };
 
 }  // namespace controller_interface
@@ -14,12 +14,16 @@
 
 #include "controller_interface/controller_interface_base.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 #include "hardware_interface/introspection.hpp"
 #include "lifecycle_msgs/msg/state.hpp"
+#include "realtime_tools/realtime_helpers.hpp"
 
 namespace controller_interface
 {
@@ -68,7 +72,18 @@ return_type ControllerInterfaceBase::init(
     auto_declare<int>("update_rate", static_cast<int>(ctrl_itf_params_.update_rate));
 
     auto_declare<bool>("is_async", false);
+    auto_declare<std::string>("update_trigger", "periodic");
+    auto_declare<std::vector<std::string>>("trigger_interfaces", {});
     auto_declare<int>("thread_priority", -100);
+    auto_declare<int>("async_parameters.sched_runtime", 0);
+    auto_declare<int>("async_parameters.sched_deadline", 0);
+    auto_declare<int>("async_parameters.sched_period", 0);
+    const auto realtime_memory_arena_size = auto_declare<int>("realtime_memory_arena_size", 0);
+    if (realtime_memory_arena_size > 0)
+    {
+      realtime_memory_arena_ = std::make_unique<hardware_interface::RealtimeMemoryArena>(
+        static_cast<size_t>(realtime_memory_arena_size));
+    }
   }
   catch (const std::exception & e)
   {
@@ -99,6 +114,7 @@ return_type ControllerInterfaceBase::init(
       // make sure introspection is disabled on controller cleanup as users may manually enable
       // it in `on_configure` and `on_deactivate` - see the docs for details
       enable_introspection(false);
+      activation_prepared_.store(false);
       this->stop_async_handler_thread();
       return on_cleanup(previous_state);
     });
@@ -107,20 +123,35 @@ return_type ControllerInterfaceBase::init(
     [this](const rclcpp_lifecycle::State & previous_state) -> CallbackReturn
     {
       skip_async_triggers_.store(false);
+      // a demotion to async lasts only while the controller is active
+      is_async_.store(configured_is_async_);
       enable_introspection(true);
       if (is_async() && async_handler_ && async_handler_->is_running())
       {
         // This is needed if it is disabled due to a thrown exception in the async callback thread
         async_handler_->reset_variables();
       }
-      return on_activate(previous_state);
+      auto result = CallbackReturn::FAILURE;
+      if (!is_state_triggered_ || init_trigger_interfaces())
+      {
+        result = on_activate(previous_state);
+      }
+      if (result != CallbackReturn::SUCCESS)
+      {
+        // the preparation is valid only for this activation
+        cancel_activation();
+      }
+      return result;
     });
 
   node_->register_on_deactivate(
     [this](const rclcpp_lifecycle::State & previous_state) -> CallbackReturn
     {
       enable_introspection(false);
-      return on_deactivate(previous_state);
+      activation_prepared_.store(false);
+      const auto result = on_deactivate(previous_state);
+      is_async_.store(configured_is_async_);
+      return result;
     });
 
   node_->register_on_shutdown(
@@ -174,9 +205,23 @@ const rclcpp_lifecycle::State & ControllerInterfaceBase::configure()
     {
       ctrl_itf_params_.update_rate = static_cast<unsigned int>(update_rate);
     }
-    is_async_ = get_node()->get_parameter("is_async").as_bool();
+    configured_is_async_ = get_node()->get_parameter("is_async").as_bool();
+    is_async_ = configured_is_async_;
+    const auto update_trigger = get_node()->get_parameter("update_trigger").as_string();
+    if (update_trigger != "periodic" && update_trigger != "state_update")
+    {
+      RCLCPP_ERROR(
+        get_node()->get_logger(),
+        "The update trigger '%s' is not supported, use 'periodic' or 'state_update'.",
+        update_trigger.c_str());
+      return get_lifecycle_state();
+    }
+    is_state_triggered_ = (update_trigger == "state_update");
+    trigger_interface_names_ = get_node()->get_parameter("trigger_interfaces").as_string_array();
   }
-  if (is_async_)
+  // the handler is also prepared for a controller that may be demoted to async later, as creating
+  // it is not real-time safe
+  if (configured_is_async_ || ctrl_itf_params_.allow_async_demotion)
   {
     realtime_tools::AsyncFunctionHandlerParams async_params;
     async_params.thread_priority = 50;  // default value
@@ -199,13 +244,64 @@ const rclcpp_lifecycle::State & ControllerInterfaceBase::configure()
         "The controllers are not supported to run asynchronously in detached mode!");
       return get_node()->get_current_state();
     }
-    RCLCPP_INFO(
-      get_node()->get_logger(), "Starting async handler with scheduler priority: %d",
-      async_params.thread_priority);
+    hardware_interface::DeadlineSchedulingParams deadline_params;
+    deadline_params.runtime = std::chrono::microseconds(
+      get_node()->get_parameter("async_parameters.sched_runtime").as_int());
+    deadline_params.deadline = std::chrono::microseconds(
+      get_node()->get_parameter("async_parameters.sched_deadline").as_int());
+    deadline_params.period = std::chrono::microseconds(
+      get_node()->get_parameter("async_parameters.sched_period").as_int());
+    deadline_scheduling_ = {};
+    async_thread_scheduled_ = false;
+    if (deadline_params.is_enabled())
+    {
+      try
+      {
+        deadline_scheduling_ = hardware_interface::resolve_deadline_scheduling_params(
+          deadline_params,
+          std::chrono::microseconds(
+            ctrl_itf_params_.update_rate > 0 ? 1'000'000 / ctrl_itf_params_.update_rate : 0));
+      }
+      catch (const std::invalid_argument & e)
+      {
+        RCLCPP_ERROR(
+          get_node()->get_logger(), "%s Set the 'async_parameters.sched_period' parameter.",
+          e.what());
+        return get_node()->get_current_state();
+      }
+      RCLCPP_INFO(
+        get_node()->get_logger(),
+        "Starting async handler with SCHED_DEADLINE runtime %ld us, deadline %ld us and period "
+        "%ld us",
+        static_cast<long>(deadline_scheduling_.runtime.count()),   // NOLINT
+        static_cast<long>(deadline_scheduling_.deadline.count()),  // NOLINT
+        static_cast<long>(deadline_scheduling_.period.count()));   // NOLINT
+    }
+    else
+    {
+      RCLCPP_INFO(
+        get_node()->get_logger(), "Starting async handler with scheduler priority: %d",
+        async_params.thread_priority);
+    }
+    {
+      // the CPUs set for a previous thread are applied by the new thread
+      std::lock_guard<std::mutex> lock(async_thread_cpu_affinity_mutex_);
+      async_thread_cpu_affinity_pending_.store(!async_thread_cpu_affinity_.empty());
+    }
     async_handler_ = std::make_unique<realtime_tools::AsyncFunctionHandler<return_type>>();
     async_handler_->init(
-      std::bind(
-        &ControllerInterfaceBase::update, this, std::placeholders::_1, std::placeholders::_2),
+      [this](const rclcpp::Time & time, const rclcpp::Duration & period)
+      {
+        if (deadline_scheduling_.is_enabled() && !async_thread_scheduled_)
+        {
+          configure_async_thread_sched_deadline();
+        }
+        if (async_thread_cpu_affinity_pending_.load(std::memory_order_acquire))
+        {
+          apply_async_thread_cpu_affinity();
+        }
+        return update(time, period);
+      },
       async_params);
     async_handler_->start_thread();
   }
@@ -310,7 +406,158 @@ unsigned int ControllerInterfaceBase::get_update_rate() const
   return ctrl_itf_params_.update_rate;
 }
 
-bool ControllerInterfaceBase::is_async() const { return is_async_; }
+bool ControllerInterfaceBase::is_async() const { return is_async_.load(); }
+
+uint64_t ControllerInterfaceBase::get_deadline_overruns() const
+{
+  return deadline_overrun_counter_.get_count();
+}
+
+std::pmr::memory_resource * ControllerInterfaceBase::get_realtime_memory_resource() const
+{
+  if (realtime_memory_arena_)
+  {
+    return realtime_memory_arena_.get();
+  }
+  return std::pmr::get_default_resource();
+}
+
+hardware_interface::RealtimeMemoryArenaStatistics
+ControllerInterfaceBase::get_realtime_memory_arena_statistics() const
+{
+  if (realtime_memory_arena_)
+  {
+    return realtime_memory_arena_->get_statistics();
+  }
+  return {};
+}
+
+void ControllerInterfaceBase::configure_async_thread_sched_deadline()
+{
+  async_thread_scheduled_ = true;
+  const auto [success, reason] = hardware_interface::configure_sched_deadline(deadline_scheduling_);
+  if (!success)
+  {
+    RCLCPP_WARN(
+      get_node()->get_logger(),
+      "Could not set SCHED_DEADLINE of the async thread, it keeps SCHED_FIFO: %s", reason.c_str());
+    return;
+  }
+  if (!deadline_overrun_counter_.attach_to_current_thread())
+  {
+    RCLCPP_WARN(
+      get_node()->get_logger(), "The deadline overruns of the async thread are not counted.");
+  }
+}
+
+void ControllerInterfaceBase::set_async_thread_cpu_affinity(const std::vector<int> & cpus)
+{
+  std::lock_guard<std::mutex> lock(async_thread_cpu_affinity_mutex_);
+  async_thread_cpu_affinity_ = cpus;
+  async_thread_cpu_affinity_pending_.store(true, std::memory_order_release);
+}
+
+void ControllerInterfaceBase::apply_async_thread_cpu_affinity()
+{
+  std::unique_lock<std::mutex> lock(async_thread_cpu_affinity_mutex_, std::try_to_lock);
+  if (!lock.owns_lock())
+  {
+    // retried with the next update
+    return;
+  }
+  async_thread_cpu_affinity_pending_.store(false, std::memory_order_relaxed);
+  const auto [success, reason] =
+    realtime_tools::set_current_thread_affinity(async_thread_cpu_affinity_);
+  if (!success)
+  {
+    RCLCPP_WARN(
+      get_node()->get_logger(), "Could not set the CPU affinity of the async thread: %s",
+      reason.c_str());
+  }
+}
+
+bool ControllerInterfaceBase::demote_to_async()
+{
+  if (is_async())
+  {
+    return true;
+  }
+  if (!async_handler_ || !async_handler_->is_running())
+  {
+    return false;
+  }
+  is_async_.store(true);
+  return true;
+}
+
+bool ControllerInterfaceBase::is_state_triggered() const { return is_state_triggered_; }
+
+bool ControllerInterfaceBase::has_new_state_samples()
+{
+  bool new_samples = false;
+  for (auto & [index, last_sequence] : trigger_update_sequences_)
+  {
+    const uint64_t sequence = state_interfaces_[index].get_update_sequence();
+    if (sequence != last_sequence)
+    {
+      last_sequence = sequence;
+      new_samples = true;
+    }
+  }
+  return new_samples;
+}
+
+bool ControllerInterfaceBase::init_trigger_interfaces()
+{
+  trigger_update_sequences_.clear();
+  for (size_t i = 0; i < state_interfaces_.size(); ++i)
+  {
+    const auto & state_interface = state_interfaces_[i];
+    const bool is_listed =
+      std::find(
+        trigger_interface_names_.begin(), trigger_interface_names_.end(),
+        state_interface.get_name()) != trigger_interface_names_.end();
+    if (!trigger_interface_names_.empty() && !is_listed)
+    {
+      continue;
+    }
+    // the updates of states bound to memory are not counted, they would never trigger an update
+    if (state_interface.is_bound_to_memory())
+    {
+      if (is_listed)
+      {
+        RCLCPP_ERROR(
+          get_node()->get_logger(),
+          "The trigger interface '%s' is bound to the memory of its hardware component and can't "
+          "trigger an update.",
+          state_interface.get_name().c_str());
+        return false;
+      }
+      continue;
+    }
+    // only the samples received after the activation trigger an update
+    trigger_update_sequences_.emplace_back(i, state_interface.get_update_sequence());
+  }
+  if (trigger_update_sequences_.empty())
+  {
+    RCLCPP_ERROR(
+      get_node()->get_logger(),
+      "The controller is triggered by state updates, but doesn't claim any trigger interface.");
+    return false;
+  }
+  if (
+    !trigger_interface_names_.empty() &&
+    trigger_update_sequences_.size() != trigger_interface_names_.size())
+  {
+    RCLCPP_ERROR(
+      get_node()->get_logger(),
+      "The controller is triggered by state updates, but not all of its %zu trigger interfaces "
+      "are claimed state interfaces.",
+      trigger_interface_names_.size());
+    return false;
+  }
+  return true;
+}
 
 const std::string & ControllerInterfaceBase::get_robot_description() const
 {
@@ -329,6 +576,45 @@ ControllerInterfaceBase::get_soft_joint_limits() const
   return ctrl_itf_params_.soft_joint_limits;
 }
 
+return_type ControllerInterfaceBase::prepare_activation()
+{
+  activation_prepared_.store(false);
+  if (get_lifecycle_state().id() != lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE)
+  {
+    RCLCPP_ERROR(
+      get_node()->get_logger(),
+      "Can not prepare the activation of the controller in '%s' state, it has to be 'inactive'.",
+      get_lifecycle_state().label().c_str());
+    return return_type::ERROR;
+  }
+  if (on_prepare_activation(get_lifecycle_state()) != CallbackReturn::SUCCESS)
+  {
+    return return_type::ERROR;
+  }
+  activation_prepared_.store(true);
+  return return_type::OK;
+}
+
+bool ControllerInterfaceBase::is_activation_prepared() const
+{
+  return activation_prepared_.load();
+}
+
+return_type ControllerInterfaceBase::cancel_activation()
+{
+  if (!activation_prepared_.exchange(false))
+  {
+    return return_type::OK;
+  }
+  if (on_cancel_activation(get_lifecycle_state()) != CallbackReturn::SUCCESS)
+  {
+    RCLCPP_ERROR(
+      get_node()->get_logger(), "Failed to undo the preparation of the controller activation.");
+    return return_type::ERROR;
+  }
+  return return_type::OK;
+}
+
 void ControllerInterfaceBase::wait_for_trigger_update_to_finish()
 {
   if (is_async() && async_handler_ && async_handler_->is_running())
@@ -345,7 +631,7 @@ void ControllerInterfaceBase::prepare_for_deactivation()
 
 void ControllerInterfaceBase::stop_async_handler_thread()
 {
-  if (is_async() && async_handler_ && async_handler_->is_running())
+  if (async_handler_ && async_handler_->is_running())
   {
     async_handler_->stop_thread();
   }
@@ -273,3 +273,258 @@ TEST(TestableControllerInterface, default_returns_for_chainable_controllers_meth
 
   rclcpp::shutdown();
 }
+
+TEST(TestableControllerInterfaceTwoPhaseActivation, prepare_activation)
+{
+  char const * const argv[] = {""};
+  int argc = arrlen(argv);
+  rclcpp::init(argc, argv);
+
+  TestableControllerInterfaceTwoPhaseActivation controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 10;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+
+  // the activation can only be prepared in the inactive state
+  EXPECT_EQ(controller.prepare_activation(), controller_interface::return_type::ERROR);
+  EXPECT_EQ(controller.prepare_activation_calls, 0u);
+  EXPECT_FALSE(controller.is_activation_prepared());
+
+  controller.configure();
+  ASSERT_EQ(
+    controller.get_lifecycle_state().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+
+  // a failing preparation doesn't mark the controller as prepared
+  controller.prepare_activation_result = controller_interface::CallbackReturn::ERROR;
+  EXPECT_EQ(controller.prepare_activation(), controller_interface::return_type::ERROR);
+  EXPECT_EQ(controller.prepare_activation_calls, 1u);
+  EXPECT_FALSE(controller.is_activation_prepared());
+
+  controller.prepare_activation_result = controller_interface::CallbackReturn::SUCCESS;
+  EXPECT_EQ(controller.prepare_activation(), controller_interface::return_type::OK);
+  EXPECT_EQ(controller.prepare_activation_calls, 2u);
+  EXPECT_TRUE(controller.is_activation_prepared());
+
+  controller.get_node()->activate();
+  EXPECT_TRUE(controller.activated_with_preparation);
+
+  // the preparation is valid only for one activation
+  controller.get_node()->deactivate();
+  EXPECT_FALSE(controller.is_activation_prepared());
+  controller.get_node()->activate();
+  EXPECT_FALSE(controller.activated_with_preparation);
+  controller.get_node()->deactivate();
+
+  // cancelling undoes the preparation once
+  EXPECT_EQ(controller.cancel_activation(), controller_interface::return_type::OK);
+  EXPECT_EQ(controller.cancel_activation_calls, 0u);
+  EXPECT_EQ(controller.prepare_activation(), controller_interface::return_type::OK);
+  EXPECT_EQ(controller.cancel_activation(), controller_interface::return_type::OK);
+  EXPECT_EQ(controller.cancel_activation_calls, 1u);
+  EXPECT_FALSE(controller.is_activation_prepared());
+  EXPECT_EQ(controller.cancel_activation(), controller_interface::return_type::OK);
+  EXPECT_EQ(controller.cancel_activation_calls, 1u);
+
+  // a failing activation undoes the preparation
+  EXPECT_EQ(controller.prepare_activation(), controller_interface::return_type::OK);
+  controller.activate_result = controller_interface::CallbackReturn::ERROR;
+  controller.get_node()->activate();
+  EXPECT_TRUE(controller.activated_with_preparation);
+  EXPECT_NE(
+    controller.get_lifecycle_state().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+  EXPECT_EQ(controller.cancel_activation_calls, 2u);
+  EXPECT_FALSE(controller.is_activation_prepared());
+
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
+TEST(TestableControllerInterface, demote_to_async)
+{
+  char const * const argv[] = {""};
+  int argc = arrlen(argv);
+  rclcpp::init(argc, argv);
+
+  TestableControllerInterface controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 10;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  controller.configure();
+  // without a prepared async handler, the controller can't be demoted
+  EXPECT_FALSE(controller.demote_to_async());
+  EXPECT_FALSE(controller.is_async());
+  controller.get_node()->shutdown();
+
+  TestableControllerInterface demotable_controller;
+  params.allow_async_demotion = true;
+  params.node_options = demotable_controller.define_custom_node_options();
+  ASSERT_EQ(demotable_controller.init(params), controller_interface::return_type::OK);
+  demotable_controller.configure();
+  demotable_controller.get_node()->activate();
+  EXPECT_FALSE(demotable_controller.is_async());
+  EXPECT_TRUE(
+    demotable_controller.trigger_update(rclcpp::Time(0, 0), rclcpp::Duration::from_seconds(0.1))
+      .successful);
+
+  EXPECT_TRUE(demotable_controller.demote_to_async());
+  EXPECT_TRUE(demotable_controller.is_async());
+  EXPECT_TRUE(
+    demotable_controller.trigger_update(rclcpp::Time(0, 0), rclcpp::Duration::from_seconds(0.1))
+      .successful);
+  demotable_controller.prepare_for_deactivation();
+  demotable_controller.get_node()->deactivate();
+
+  // the demotion lasts only while the controller is active
+  EXPECT_FALSE(demotable_controller.is_async());
+  EXPECT_TRUE(demotable_controller.demote_to_async());
+  demotable_controller.get_node()->activate();
+  EXPECT_FALSE(demotable_controller.is_async());
+  EXPECT_TRUE(
+    demotable_controller.trigger_update(rclcpp::Time(0, 0), rclcpp::Duration::from_seconds(0.1))
+      .successful);
+  demotable_controller.prepare_for_deactivation();
+  demotable_controller.get_node()->deactivate();
+
+  demotable_controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
+TEST(TestableControllerInterface, state_triggered_update)
+{
+  char const * const argv[] = {""};
+  int argc = arrlen(argv);
+  rclcpp::init(argc, argv);
+
+  TestableControllerInterface controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 1000;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  EXPECT_FALSE(controller.is_state_triggered());
+
+  // unknown triggers are rejected on configure
+  controller.get_node()->set_parameter({"update_trigger", "on_change"});
+  ASSERT_EQ(controller.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_UNCONFIGURED);
+
+  controller.get_node()->set_parameter({"update_trigger", "state_update"});
+  controller.get_node()->set_parameter(
+    {"trigger_interfaces", std::vector<std::string>{"joint1/position"}});
+  ASSERT_EQ(controller.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+  EXPECT_TRUE(controller.is_state_triggered());
+
+  hardware_interface::InterfaceInfo info;
+  info.initial_value = "0.0";
+  info.name = "position";
+  auto position = std::make_shared<hardware_interface::StateInterface>(
+    hardware_interface::InterfaceDescription("joint1", info));
+  info.name = "velocity";
+  auto velocity = std::make_shared<hardware_interface::StateInterface>(
+    hardware_interface::InterfaceDescription("joint1", info));
+
+  // the trigger interface has to be claimed
+  std::vector<hardware_interface::LoanedStateInterface> state_interfaces;
+  state_interfaces.emplace_back(velocity);
+  controller.assign_interfaces({}, std::move(state_interfaces));
+  ASSERT_EQ(
+    controller.get_node()->activate().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+
+  // the updates of a trigger interface bound to memory are not counted
+  double process_image = 0.0;
+  info.name = "position";
+  hardware_interface::InterfaceDescription bound_description("joint1", info);
+  bound_description.bind_memory(&process_image);
+  auto bound_position = std::make_shared<hardware_interface::StateInterface>(bound_description);
+  state_interfaces.clear();
+  state_interfaces.emplace_back(velocity);
+  state_interfaces.emplace_back(bound_position);
+  controller.assign_interfaces({}, std::move(state_interfaces));
+  ASSERT_EQ(
+    controller.get_node()->activate().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+
+  state_interfaces.clear();
+  state_interfaces.emplace_back(velocity);
+  state_interfaces.emplace_back(position);
+  controller.assign_interfaces({}, std::move(state_interfaces));
+  ASSERT_TRUE(position->set_value(1.0));
+  ASSERT_EQ(
+    controller.get_node()->activate().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+  // the samples before the activation don't trigger
+  EXPECT_FALSE(controller.has_new_state_samples());
+
+  // only the trigger interface triggers, each sample once
+  ASSERT_TRUE(velocity->set_value(1.0));
+  EXPECT_FALSE(controller.has_new_state_samples());
+  ASSERT_TRUE(position->set_value(2.0));
+  EXPECT_TRUE(controller.has_new_state_samples());
+  EXPECT_FALSE(controller.has_new_state_samples());
+  // a sample with the same value still triggers
+  ASSERT_TRUE(position->set_value(2.0));
+  EXPECT_TRUE(controller.has_new_state_samples());
+
+  controller.get_node()->deactivate();
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
+
+TEST(TestableControllerInterface, state_triggered_update_with_extrapolated_states)
+{
+  char const * const argv[] = {""};
+  int argc = arrlen(argv);
+  rclcpp::init(argc, argv);
+
+  TestableControllerInterface controller;
+  controller_interface::ControllerInterfaceParams params;
+  params.controller_name = TEST_CONTROLLER_NAME;
+  params.robot_description = "";
+  params.update_rate = 1000;
+  params.node_namespace = "";
+  params.node_options = controller.define_custom_node_options();
+  ASSERT_EQ(controller.init(params), controller_interface::return_type::OK);
+  controller.get_node()->set_parameter({"update_trigger", "state_update"});
+  ASSERT_EQ(controller.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+
+  hardware_interface::InterfaceInfo info;
+  info.initial_value = "0.0";
+  info.name = "position";
+  auto position = std::make_shared<hardware_interface::StateInterface>(
+    hardware_interface::InterfaceDescription("joint1", info));
+  std::vector<hardware_interface::LoanedStateInterface> state_interfaces;
+  state_interfaces.emplace_back(position);
+  controller.assign_interfaces({}, std::move(state_interfaces));
+  ASSERT_EQ(
+    controller.get_node()->activate().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+
+  // a sample read from the hardware triggers
+  ASSERT_TRUE(position->set_value(1.0));
+  EXPECT_TRUE(controller.has_new_state_samples());
+
+  // the values predicted in the cycles between two samples don't trigger
+  for (const double prediction : {1.1, 1.2, 1.3})
+  {
+    ASSERT_TRUE(position->set_predicted_value(prediction));
+    EXPECT_TRUE(position->is_predicted());
+    EXPECT_DOUBLE_EQ(prediction, position->get_optional().value());
+    EXPECT_FALSE(controller.has_new_state_samples());
+  }
+
+  // the next sample triggers again
+  ASSERT_TRUE(position->set_value(1.4));
+  position->set_predicted(false);
+  EXPECT_TRUE(controller.has_new_state_samples());
+  EXPECT_FALSE(controller.has_new_state_samples());
+
+  controller.get_node()->deactivate();
+  controller.get_node()->shutdown();
+  rclcpp::shutdown();
+}
@@ -64,4 +64,37 @@ public:
   }
 };
 
+class TestableControllerInterfaceTwoPhaseActivation : public TestableControllerInterface
+{
+public:
+  controller_interface::CallbackReturn on_prepare_activation(
+    const rclcpp_lifecycle::State & /*previous_state*/) override
+  {
+    ++prepare_activation_calls;
+    return prepare_activation_result;
+  }
+
+  controller_interface::CallbackReturn on_activate(
+    const rclcpp_lifecycle::State & /*previous_state*/) override
+  {
+    activated_with_preparation = is_activation_prepared();
+    return activate_result;
+  }
+
+  controller_interface::CallbackReturn on_cancel_activation(
+    const rclcpp_lifecycle::State & /*previous_state*/) override
+  {
+    ++cancel_activation_calls;
+    return controller_interface::CallbackReturn::SUCCESS;
+  }
+
+  size_t prepare_activation_calls = 0;
+  size_t cancel_activation_calls = 0;
+  bool activated_with_preparation = false;
+  controller_interface::CallbackReturn prepare_activation_result =
+    controller_interface::CallbackReturn::SUCCESS;
+  controller_interface::CallbackReturn activate_result =
+    controller_interface::CallbackReturn::SUCCESS;
+};
+
 #endif  // TEST_CONTROLLER_INTERFACE_HPP_
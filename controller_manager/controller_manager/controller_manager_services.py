@@ -467,20 +467,28 @@ def set_controller_parameters_from_param_files(
         ):
             return False
 
-        fallback_controllers = get_parameter_from_param_files(
-            node,
-            controller_name,
-            spawner_namespace,
-            controller_parameter_files,
+        # parameters of the controller that are used by the controller manager
+        for parameter_name in [
             "fallback_controllers",
-        )
-        if fallback_controllers:
-            if not set_controller_parameters(
+            "priority",
+            "execution_time_budget",
+            "execution_time_budget_policy",
+            "rate_domain",
+        ]:
+            parameter_value = get_parameter_from_param_files(
                 node,
-                controller_manager_name,
                 controller_name,
-                "fallback_controllers",
-                fallback_controllers,
-            ):
-                return False
+                spawner_namespace,
+                controller_parameter_files,
+                parameter_name,
+            )
+            if parameter_value:
+                if not set_controller_parameters(
+                    node,
+                    controller_manager_name,
+                    controller_name,
+                    parameter_name,
+                    parameter_value,
+                ):
+                    return False
     return True
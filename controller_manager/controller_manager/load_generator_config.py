@@ -0,0 +1,319 @@
+#!/usr/bin/env python3
+# Copyright 2025 ros2_control development team
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Generate the configuration of a synthetic load for capacity planning.
+
+The generated robot description contains N ``mock_components/LoadGeneratorSystem`` hardware
+components and the controller configuration M ``controller_manager/load_generator_controller``
+controllers, optionally chained, so that the scheduling headroom of the controller manager can be
+measured on the target machine with the generated launch file.
+"""
+
+import argparse
+import os
+import sys
+from xml.sax.saxutils import quoteattr
+
+import yaml
+
+ROBOT_DESCRIPTION_FILE = "load_generator.urdf"
+CONTROLLERS_FILE = "load_generator_controllers.yaml"
+LAUNCH_FILE = "load_generator.launch.py"
+CONTROLLER_TYPE = "controller_manager/load_generator_controller"
+HARDWARE_PLUGIN = "mock_components/LoadGeneratorSystem"
+
+LAUNCH_FILE_TEMPLATE = '''# Generated by load_generator_config, do not edit.
+import os
+
+from launch import LaunchDescription
+from launch_ros.actions import Node
+
+CONTROLLERS = {controllers}
+
+
+def generate_launch_description():
+    directory = os.path.dirname(os.path.realpath(__file__))
+    with open(os.path.join(directory, "{robot_description_file}")) as robot_description_file:
+        robot_description = {{"robot_description": robot_description_file.read()}}
+    controllers_file = os.path.join(directory, "{controllers_file}")
+
+    return LaunchDescription(
+        [
+            Node(
+                package="robot_state_publisher",
+                executable="robot_state_publisher",
+                parameters=[robot_description],
+            ),
+            Node(
+                package="controller_manager",
+                executable="ros2_control_node",
+                parameters=[controllers_file],
+                output="both",
+            ),
+            Node(
+                package="controller_manager",
+                executable="spawner",
+                arguments=CONTROLLERS
+                + ["--param-file", controllers_file, "--activate-as-group"],
+            ),
+        ]
+    )
+'''
+
+
+def load_parameters(
+    cpu_time_us=0.0,
+    memory_footprint_bytes=0,
+    cache_footprint_bytes=0,
+    jitter_distribution="none",
+    jitter_us=0.0,
+    failure_rate=0.0,
+    seed=0,
+):
+    """Return the parameters of a synthetic load, with the types expected by the plugins."""
+    return {
+        "cpu_time_us": float(cpu_time_us),
+        "memory_footprint_bytes": int(memory_footprint_bytes),
+        "cache_footprint_bytes": int(cache_footprint_bytes),
+        "jitter_distribution": str(jitter_distribution),
+        "jitter_us": float(jitter_us),
+        "failure_rate": float(failure_rate),
+        "seed": int(seed),
+    }
+
+
+def joint_names(hardware_components, joints_per_component):
+    return [f"joint{i}" for i in range(hardware_components * joints_per_component)]
+
+
+def generate_robot_description(hardware_components, joints_per_component, hardware_load):
+    """Return a URDF with the joints and the load generating hardware components."""
+    joints = joint_names(hardware_components, joints_per_component)
+    lines = ['<?xml version="1.0" encoding="utf-8"?>', '<robot name="load_generator">']
+    lines.append('  <link name="base_link"/>')
+    for joint in joints:
+        lines.append(f'  <link name="{joint}_link"/>')
+        lines.append(f'  <joint name="{joint}" type="continuous">')
+        lines.append('    <parent link="base_link"/>')
+        lines.append(f'    <child link="{joint}_link"/>')
+        lines.append("  </joint>")
+    for component in range(hardware_components):
+        # a different seed per component, so that their jitter and failures are independent
+        parameters = dict(hardware_load, seed=hardware_load["seed"] + component)
+        lines.append(f'  <ros2_control name="LoadGeneratorSystem{component}" type="system">')
+        lines.append("    <hardware>")
+        lines.append(f"      <plugin>{HARDWARE_PLUGIN}</plugin>")
+        for name, value in parameters.items():
+            lines.append(f"      <param name={quoteattr(name)}>{value}</param>")
+        lines.append("    </hardware>")
+        first_joint = component * joints_per_component
+        for joint in joints[first_joint : first_joint + joints_per_component]:
+            lines.append(f'    <joint name="{joint}">')
+            lines.append('      <command_interface name="position"/>')
+            lines.append('      <state_interface name="position">')
+            lines.append('        <param name="initial_value">0.0</param>')
+            lines.append("      </state_interface>")
+            lines.append("    </joint>")
+        lines.append("  </ros2_control>")
+    lines.append("</robot>")
+    return "\n".join(lines) + "\n"
+
+
+def controller_names(controllers):
+    return [f"load_generator_{i}" for i in range(controllers)]
+
+
+def generate_controllers_config(controllers, chain_length, joints, update_rate, controller_load):
+    """
+    Return the parameters of the controller manager and the load generating controllers.
+
+    The controllers are split into chains of ``chain_length`` controllers. The joints are
+    distributed round-robin over the chains, the last controller of a chain commands the joints of
+    the chain, and each other controller commands the reference interfaces of its successor.
+    """
+    if chain_length < 1:
+        raise ValueError("The chain length has to be at least 1.")
+    names = controller_names(controllers)
+    chains = [names[i : i + chain_length] for i in range(0, len(names), chain_length)]
+    config = {"controller_manager": {"ros__parameters": {"update_rate": int(update_rate)}}}
+    for chain_index, chain in enumerate(chains):
+        chain_joints = joints[chain_index :: len(chains)]
+        interfaces = [f"{joint}/position" for joint in chain_joints]
+        for position, name in enumerate(chain):
+            parameters = {"type": CONTROLLER_TYPE}
+            parameters.update(controller_load)
+            parameters["seed"] = controller_load["seed"] + chain_index * chain_length + position
+            # empty lists are omitted, as their type can't be deduced from the parameter file
+            if interfaces:
+                parameters["state_interfaces"] = list(interfaces)
+                if position + 1 < len(chain):
+                    successor = chain[position + 1]
+                    parameters["command_interfaces"] = [
+                        f"{successor}/{interface}" for interface in interfaces
+                    ]
+                else:
+                    parameters["command_interfaces"] = list(interfaces)
+                if position > 0:
+                    parameters["reference_interfaces"] = list(interfaces)
+            config[name] = {"ros__parameters": parameters}
+    return config
+
+
+def generate_launch_file(controllers):
+    return LAUNCH_FILE_TEMPLATE.format(
+        controllers=repr(controller_names(controllers)),
+        robot_description_file=ROBOT_DESCRIPTION_FILE,
+        controllers_file=CONTROLLERS_FILE,
+    )
+
+
+def write_configuration(
+    output_dir,
+    hardware_components,
+    joints_per_component,
+    controllers,
+    chain_length,
+    update_rate,
+    hardware_load,
+    controller_load,
+):
+    """Write the robot description, controller configuration and launch file to output_dir."""
+    os.makedirs(output_dir, exist_ok=True)
+    joints = joint_names(hardware_components, joints_per_component)
+    files = {
+        ROBOT_DESCRIPTION_FILE: generate_robot_description(
+            hardware_components, joints_per_component, hardware_load
+        ),
+        CONTROLLERS_FILE: yaml.safe_dump(
+            generate_controllers_config(
+                controllers, chain_length, joints, update_rate, controller_load
+            ),
+            sort_keys=False,
+        ),
+        LAUNCH_FILE: generate_launch_file(controllers),
+    }
+    for file_name, content in files.items():
+        with open(os.path.join(output_dir, file_name), "w") as output_file:
+            output_file.write(content)
+    return [os.path.join(output_dir, file_name) for file_name in files]
+
+
+def add_load_arguments(parser, prefix, default_cpu_time_us):
+    group = parser.add_argument_group(f"synthetic load of the {prefix}s")
+    group.add_argument(
+        f"--{prefix}-cpu-time-us",
+        type=float,
+        default=default_cpu_time_us,
+        help="Busy time per cycle in microseconds",
+    )
+    group.add_argument(
+        f"--{prefix}-memory-footprint-bytes",
+        type=int,
+        default=0,
+        help="Memory allocated when the plugin is configured",
+    )
+    group.add_argument(
+        f"--{prefix}-cache-footprint-bytes",
+        type=int,
+        default=0,
+        help="Memory read and written in each cycle",
+    )
+    group.add_argument(
+        f"--{prefix}-jitter-distribution",
+        choices=["none", "uniform", "normal", "exponential"],
+        default="none",
+        help="Distribution of the jitter added to the busy time",
+    )
+    group.add_argument(
+        f"--{prefix}-jitter-us",
+        type=float,
+        default=0.0,
+        help="Scale of the jitter in microseconds: maximum (uniform), standard deviation "
+        "(normal) or mean (exponential)",
+    )
+    group.add_argument(
+        f"--{prefix}-failure-rate",
+        type=float,
+        default=0.0,
+        help="Probability that a cycle fails",
+    )
+
+
+def load_from_arguments(args, prefix):
+    prefix = prefix.replace("-", "_")
+    return load_parameters(
+        cpu_time_us=getattr(args, f"{prefix}_cpu_time_us"),
+        memory_footprint_bytes=getattr(args, f"{prefix}_memory_footprint_bytes"),
+        cache_footprint_bytes=getattr(args, f"{prefix}_cache_footprint_bytes"),
+        jitter_distribution=getattr(args, f"{prefix}_jitter_distribution"),
+        jitter_us=getattr(args, f"{prefix}_jitter_us"),
+        failure_rate=getattr(args, f"{prefix}_failure_rate"),
+        seed=args.seed,
+    )
+
+
+def main(args=None):
+    parser = argparse.ArgumentParser(
+        description="Generate a robot description, controller configuration and launch file "
+        "with synthetic load generating hardware components and controllers."
+    )
+    parser.add_argument(
+        "-o", "--output-dir", required=True, help="Directory the files are written to"
+    )
+    parser.add_argument(
+        "--hardware-components", type=int, default=1, help="Number of hardware components"
+    )
+    parser.add_argument(
+        "--joints-per-component", type=int, default=6, help="Number of joints per component"
+    )
+    parser.add_argument("--controllers", type=int, default=1, help="Number of controllers")
+    parser.add_argument(
+        "--chain-length",
+        type=int,
+        default=1,
+        help="Number of controllers chained in front of each other",
+    )
+    parser.add_argument(
+        "--update-rate", type=int, default=2000, help="Update rate of the controller manager"
+    )
+    parser.add_argument("--seed", type=int, default=0, help="Seed of the jitter and failures")
+    add_load_arguments(parser, "hardware", 10.0)
+    add_load_arguments(parser, "controller", 10.0)
+    args = parser.parse_args(args)
+
+    if args.hardware_components < 0 or args.joints_per_component < 0 or args.controllers < 0:
+        parser.error("The number of components, joints and controllers can't be negative.")
+    if args.chain_length < 1:
+        parser.error("The chain length has to be at least 1.")
+
+    files = write_configuration(
+        args.output_dir,
+        args.hardware_components,
+        args.joints_per_component,
+        args.controllers,
+        args.chain_length,
+        args.update_rate,
+        load_from_arguments(args, "hardware"),
+        load_from_arguments(args, "controller"),
+    )
+    for file_name in files:
+        print(f"Generated {file_name}")
+    print(f"Run with: ros2 launch {os.path.join(args.output_dir, LAUNCH_FILE)}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -15,8 +15,10 @@
 #ifndef CONTROLLER_MANAGER__CONTROLLER_MANAGER_HPP_
 #define CONTROLLER_MANAGER__CONTROLLER_MANAGER_HPP_
 
+#include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -27,6 +29,8 @@
 #include "controller_interface/controller_interface_base.hpp"
 
 #include "controller_manager/controller_spec.hpp"
+#include "controller_manager/cpu_placement.hpp"
+#include "controller_manager/switch_plan.hpp"
 #include "controller_manager_msgs/msg/controller_manager_activity.hpp"
 #include "controller_manager_msgs/srv/configure_controller.hpp"
 #include "controller_manager_msgs/srv/list_controller_types.hpp"
@@ -40,7 +44,9 @@
 #include "controller_manager_msgs/srv/unload_controller.hpp"
 
 #include "diagnostic_updater/diagnostic_updater.hpp"
+#include "hardware_interface/deadline_scheduling.hpp"
 #include "hardware_interface/helpers.hpp"
+#include "hardware_interface/realtime_logger.hpp"
 #include "hardware_interface/resource_manager.hpp"
 
 #include "pluginlib/class_loader.hpp"
@@ -170,6 +176,42 @@ public:
     const std::vector<std::string> & deactivate_controllers, int strictness, bool activate_asap,
     const rclcpp::Duration & timeout, std::string & message);
 
+  /// prepare_switch Validates and compiles a controller switch without executing it.
+  /**
+   * Runs all the checks of \ref switch_controller_cb (existence and state of the controllers,
+   * chained mode, fallback controllers and availability of the interfaces) and stores the result
+   * in \p plan. The plan can be executed later, possibly multiple times, with
+   * \ref execute_switch.
+   *
+   * \param[in] activate_controllers is a list of controllers to activate.
+   * \param[in] deactivate_controllers is a list of controllers to deactivate.
+   * \param[in] strictness level of strictness (BEST_EFFORT or STRICT)
+   * \param[out] plan compiled switch.
+   * \param[out] message describing the result of the preparation.
+   * \returns return_type::OK if the switch is valid (the plan might still be empty with
+   * BEST_EFFORT strictness), return_type::ERROR otherwise.
+   */
+  controller_interface::return_type prepare_switch(
+    const std::vector<std::string> & activate_controllers,
+    const std::vector<std::string> & deactivate_controllers, int strictness, SwitchPlan & plan,
+    std::string & message);
+
+  /// execute_switch Executes a switch compiled with \ref prepare_switch.
+  /**
+   * Only checks that the controllers of the plan are still loaded and in the state they were in
+   * when the plan was compiled, then hands the compiled request lists to the control loop.
+   *
+   * \param[in] plan compiled switch.
+   * \param[in] activate_asap flag to activate controllers as soon as possible.
+   * \param[in] timeout to wait for the controllers to be switched.
+   * \param[out] message describing the result of the switch.
+   * \returns return_type::OK if the switch succeeded, return_type::ERROR if the plan is outdated
+   * or the switch failed.
+   */
+  controller_interface::return_type execute_switch(
+    const SwitchPlan & plan, bool activate_asap, const rclcpp::Duration & timeout,
+    std::string & message);
+
   /// Read values to state interfaces.
   /**
    * Read current values from hardware to state interfaces.
@@ -201,6 +243,140 @@ public:
    */
   void write(const rclcpp::Time & time, const rclcpp::Duration & period);
 
+  /// Execute control cycles back to back with a fixed period.
+  /**
+   * Calls \ref read, \ref update and \ref write \p cycles times without waiting in between, so
+   * that the controller manager can be stepped in lockstep with a simulator and faster than real
+   * time. The time of the i-th cycle is `time + i * period`. The wall time of each cycle is added
+   * to the statistics returned by \ref get_step_statistics. The rate domains are not stepped, they
+   * keep being executed by their own loops calling \ref update_rate_domain.
+   * **The method called in the (real-time) control loop.**
+   *
+   * \param[in] time The time of the first cycle
+   * \param[in] period The fixed period of the cycles
+   * \param[in] cycles The number of cycles to execute
+   * \returns return_type::OK if all updates succeeded, return_type::ERROR otherwise.
+   */
+  controller_interface::return_type step(
+    const rclcpp::Time & time, const rclcpp::Duration & period, unsigned int cycles = 1);
+
+  /// Statistics of the wall time of the cycles executed by \ref step in microseconds.
+  const MovingAverageStatistics & get_step_statistics() const { return step_stats_; }
+
+  /// Number of controllers updated in each cycle of the hyperperiod of the controller schedule.
+  /**
+   * Only computed if the `tick_scheduling` parameter is set, empty otherwise. The profile is
+   * updated by every controller switch and covers the active controllers after the switch.
+   */
+  std::vector<double> get_controller_load_profile() const;
+
+  /// State and counters of the load shedding of the real-time loop.
+  struct LoadShedding
+  {
+    /// Controllers with a priority below the level are shed, 0 if no controller is shed
+    unsigned int level = 0;
+    /// Consecutive cycles with headroom at the current level
+    unsigned int headroom_cycles = 0;
+    /// Number of times the level was raised
+    uint64_t events = 0;
+    /// Number of controller updates skipped by the load shedding
+    uint64_t shed_updates = 0;
+  };
+
+  /// Load shedding of the real-time loop, see the `overruns.load_shedding` parameters.
+  const LoadShedding & get_load_shedding() const { return load_shedding_; }
+
+  /// Rate domain with a dedicated real-time thread, see the `rate_domains.names` parameter.
+  struct RateDomain
+  {
+    std::string name;
+    unsigned int update_rate = 0;
+    /// Scheduler priority of the thread of the rate domain
+    int thread_priority = 50;
+    /// CPU cores the thread of the rate domain is pinned to, any core if empty
+    std::vector<int> cpu_affinity;
+    /// SCHED_DEADLINE reservation of the thread of the rate domain, used instead of the priority
+    hardware_interface::DeadlineSchedulingParams deadline_scheduling;
+    std::vector<std::string> hardware_components;
+  };
+
+  /// Rate domains with a dedicated real-time thread.
+  /**
+   * The rate domain `i` is the element `i - 1`, the rate domain 0 is the main control loop
+   * executing \ref read, \ref update and \ref write with the update rate of the controller manager.
+   */
+  const std::vector<RateDomain> & get_rate_domains() const { return rate_domains_; }
+
+  /// Execute a control cycle of a rate domain.
+  /**
+   * Reads the hardware components of the rate domain, updates its active controllers and writes
+   * its hardware components. Controllers failing in the cycle are deactivated, and their fallback
+   * controllers activated, by the next \ref update of the main control loop, as all the
+   * (de)activations are executed by the main control loop. The cycle is skipped while the main
+   * control loop (de)activates controllers.
+   * **The method called in the (real-time) loop of the rate domain.**
+   *
+   * \param[in] rate_domain index of the rate domain, starting at 1.
+   * \param[in] time The time at the start of this cycle
+   * \param[in] period The measured period of the last cycle of the rate domain
+   * \returns return_type::OK if all updates succeeded, return_type::ERROR otherwise.
+   */
+  controller_interface::return_type update_rate_domain(
+    unsigned int rate_domain, const rclcpp::Time & time, const rclcpp::Duration & period);
+
+  /// Number of cycles of the rate domain skipped while the main loop (de)activated controllers.
+  uint64_t get_rate_domain_skipped_cycles(unsigned int rate_domain) const;
+
+  /// Deadline misses of a real-time loop.
+  struct DeadlineMisses
+  {
+    /// Runtime overruns of the loop scheduled with SCHED_DEADLINE, signaled by the kernel
+    uint64_t runtime_overruns = 0;
+    /// Cycles missed as the loop didn't finish within its period, counted by the loop
+    uint64_t missed_cycles = 0;
+  };
+
+  /// Deadline misses of the main control loop or of a rate domain.
+  /**
+   * \param[in] rate_domain index of the rate domain, 0 for the main control loop.
+   */
+  const DeadlineMisses & get_deadline_misses(unsigned int rate_domain = 0) const;
+
+  /// Count the runtime overruns of the calling thread scheduled with SCHED_DEADLINE.
+  /**
+   * Called by the thread executing the loop after scheduling itself with
+   * hardware_interface::configure_sched_deadline().
+   *
+   * \param[in] rate_domain index of the rate domain, 0 for the main control loop.
+   * \returns false if the overruns can't be counted.
+   */
+  bool attach_deadline_overrun_counter(unsigned int rate_domain = 0);
+
+  /// Add cycles missed by the loop, e.g., as the previous cycle took longer than the period.
+  /**
+   * **The method called in the (real-time) loop.**
+   *
+   * \param[in] rate_domain index of the rate domain, 0 for the main control loop.
+   * \param[in] cycles number of missed cycles.
+   */
+  void add_deadline_missed_cycles(unsigned int rate_domain, uint64_t cycles);
+
+  /// CPU planned for the thread of the main control loop or of a rate domain.
+  /**
+   * The CPU is planned if the `cpu_placement.policy` parameter is `topology` and the thread isn't
+   * pinned by its `cpu_affinity` parameter.
+   *
+   * \param[in] rate_domain index of the rate domain, 0 for the main control loop.
+   * \returns the planned CPU, or an empty list if the thread keeps its configured CPU affinity.
+   */
+  std::vector<int> get_planned_cpu_affinity(unsigned int rate_domain = 0) const;
+
+  /// Describe the placement of the real-time threads on the CPU topology, one line per thread.
+  /**
+   * \returns the plan, or an empty string if the CPU placement is disabled.
+   */
+  std::string get_cpu_placement_plan() const;
+
   /// Deterministic (real-time safe) callback group, e.g., update function.
   /**
    * Deterministic (real-time safe) callback group for the update function. Default behavior
@@ -248,7 +424,12 @@ protected:
   controller_interface::ControllerInterfaceBaseSharedPtr add_controller_impl(
     const ControllerSpec & controller);
 
-  void manage_switch();
+  /**
+   * Perform the requested switch of the controllers.
+   * \param[in] blocking whether to wait for the rate domains to finish their cycles instead of
+   * retrying in the next cycle of the main control loop, used by the non-realtime switch.
+   */
+  void manage_switch(bool blocking = false);
 
   /// Deactivate chosen controllers from real-time controller list.
   /**
@@ -328,6 +509,9 @@ protected:
 
   // Per controller update rate support
   unsigned int update_loop_counter_ = 0;
+  /// Number of update cycles since the start, the tick of the controller update schedules
+  uint64_t update_tick_ = 0;
+  std::vector<double> controller_load_profile_;
   unsigned int update_rate_;
   std::vector<std::vector<std::string>> chained_controllers_configuration_;
 
@@ -362,6 +546,134 @@ private:
    */
   void clear_requests();
 
+  /**
+   * Undo the preparation of the controllers of the switch plan that were prepared for activation
+   * but are still inactive, called when the switch is aborted.
+   * \param[in] controllers list of all loaded controllers.
+   * \param[in] plan switch plan being executed.
+   */
+  void cancel_activation_preparations(
+    const std::vector<ControllerSpec> & controllers, const SwitchPlan & plan);
+
+  /**
+   * Compute the update schedules of the controllers active after the requested switch. The
+   * schedules are added to the requests of the switch and applied by \ref manage_switch.
+   * \param[in] controllers list of all loaded controllers.
+   * \returns the load profile of the schedule.
+   */
+  std::vector<double> request_controller_update_schedules(
+    const std::vector<ControllerSpec> & controllers);
+
+  /**
+   * Raise or lower the load shedding level from the execution time of the last cycle.
+   * \param[in] cycle_time execution time of the last cycle in microseconds.
+   * \param[in] expected_cycle_time period of the update rate in microseconds.
+   * \note This method is meant to be used only in the real-time control loop.
+   */
+  void update_load_shedding(double cycle_time, double expected_cycle_time);
+
+  /**
+   * Check the execution time of a synchronous update against the budget of the controller and
+   * apply its policy once the budget is exceeded in too many consecutive updates.
+   * \param[in] controller the updated controller.
+   * \param[in] execution_time execution time of the update in microseconds.
+   * \returns true if the controller has to be deactivated and its fallback controllers activated.
+   * \note This method is meant to be used only in the real-time control loop.
+   */
+  bool enforce_execution_time_budget(const ControllerSpec & controller, double execution_time);
+
+  /// Whether the update of the controller is shed at the current load shedding level.
+  bool is_update_shed(const ControllerSpec & controller, uint64_t update_tick) const;
+
+  /**
+   * Update an active controller if it is due in the current cycle of its rate domain.
+   * \param[in] controller the controller to update.
+   * \param[in] time the time of the cycle.
+   * \param[in] period the period of the cycle.
+   * \param[in] update_rate the update rate of the rate domain of the controller.
+   * \param[in] update_tick the index of the cycle in the rate domain.
+   * \param[out] ret set to the result of the update if it failed.
+   * \returns true if the controller has to be deactivated and its fallback controllers activated.
+   * \note This method is meant to be used only in the real-time loops.
+   */
+  bool update_controller(
+    const ControllerSpec & controller, const rclcpp::Time & time, const rclcpp::Duration & period,
+    unsigned int update_rate, uint64_t update_tick, controller_interface::return_type & ret);
+
+  /**
+   * Read the rate domains from the parameters and assign the controllers and hardware components.
+   * Called once before the resource manager is initialized.
+   */
+  void init_rate_domains();
+
+  /**
+   * Read the CPU topology and place the threads of the main control loop and the rate domains, if
+   * the `cpu_placement.policy` parameter is `topology`. Called once after init_rate_domains().
+   */
+  void init_cpu_placement();
+
+  /// Place the async threads of the hardware components, once the resource manager is initialized.
+  void place_async_hardware_components();
+
+  /// Place the async thread of a configured controller.
+  void place_async_controller(const ControllerSpec & controller);
+
+  /// Name of the thread of the main control loop or of a rate domain in the CPU placement.
+  std::string get_rate_domain_thread_name(unsigned int rate_domain) const;
+
+  /// Update rate of the rate domain, the one of the controller manager for the rate domain 0.
+  unsigned int get_rate_domain_update_rate(unsigned int rate_domain) const;
+
+  /**
+   * Get the rate domain of an interface, i.e., the one of the hardware component or the chainable
+   * controller exporting it.
+   * \param[in] controllers list of all loaded controllers.
+   * \param[in] interface_name the name of the command or state interface.
+   * \param[in] is_command_interface whether the interface is a command interface.
+   * \returns the index of the rate domain, 0 for the main control loop.
+   */
+  unsigned int get_interface_rate_domain(
+    const std::vector<ControllerSpec> & controllers, const std::string & interface_name,
+    bool is_command_interface);
+
+  /**
+   * Request the deactivation of controllers from the next \ref update of the main control loop.
+   * Used by the rate domains and when the rate domains can't be excluded from their cycles.
+   * \param[in] rt_controller_list the list of controllers used by the calling real-time loop.
+   * \param[in] controller_names the controllers to deactivate.
+   */
+  void request_controllers_deactivation(
+    const std::vector<ControllerSpec> & rt_controller_list,
+    const std::vector<std::string> & controller_names) const;
+
+  /**
+   * Deactivate the controllers in the deactivate list of the real-time buffer after a failed read
+   * or write of their hardware components, or postpone it if a rate domain is in its cycle.
+   * \param[in] rt_controller_list the list of controllers used by the main control loop.
+   * \param[in] rt_cycle_name name of the real-time cycle.
+   */
+  void deactivate_controllers_of_failed_hardware(
+    const std::vector<ControllerSpec> & rt_controller_list, const std::string & rt_cycle_name);
+
+  /// Excludes the cycles of the rate domains while the main control loop (de)activates controllers
+  class RateDomainsLock
+  {
+  public:
+    explicit RateDomainsLock(ControllerManager & cm, bool blocking = false);
+    ~RateDomainsLock();
+    RateDomainsLock(const RateDomainsLock &) = delete;
+    RateDomainsLock & operator=(const RateDomainsLock &) = delete;
+
+    /// Whether none of the rate domains is in the middle of its cycle
+    bool owns_lock() const { return owns_lock_; }
+    void unlock();
+
+  private:
+    ControllerManager & cm_;
+    size_t locked_ = 0;
+    bool owns_lock_ = false;
+  };
+
   /**
    * Perform hardware command mode change for the given list of controllers to activate and
    * deactivate.
@@ -465,6 +777,19 @@ private:
     const std::vector<ControllerSpec> & controllers, const std::vector<std::string> activation_list,
     std::string & message);
 
+  /**
+   * Checks that the controllers of a compiled switch plan are still loaded at the same position of
+   * the controllers list and that they are in the state expected by the plan.
+   *
+   * \param[in] controllers list with controllers.
+   * \param[in] plan compiled switch.
+   * \param[out] message describing the result of the check.
+   * \return return_type::OK if the plan can be executed, otherwise return_type::ERROR.
+   */
+  controller_interface::return_type check_switch_plan_is_valid(
+    const std::vector<ControllerSpec> & controllers, const SwitchPlan & plan,
+    std::string & message) const;
+
   /**
    * @brief Inserts a controller into an ordered list based on dependencies to compute the
    * controller chain.
@@ -558,6 +883,21 @@ private:
      */
     std::vector<ControllerSpec> & update_and_get_used_by_rt_list();
 
+    /// Makes the "updated" list the one used by the real-time loop of a rate domain
+    /**
+     * Unlike the main control loop, a rate domain only uses the list during its cycle and has to
+     * release it with \ref release_used_by_rt_list at the end of the cycle.
+     * \param[in] rate_domain index of the rate domain, starting at 1.
+     * \return reference to the updated list
+     */
+    std::vector<ControllerSpec> & update_and_get_used_by_rt_list(unsigned int rate_domain);
+
+    /// Releases the list used by the real-time loop of a rate domain
+    void release_used_by_rt_list(unsigned int rate_domain);
+
+    /// Allocates the list indices of the rate domains, before their loops are started
+    void set_rate_domains_count(size_t count);
+
     /**
      * get_unused_list Waits until the "outdated" and "unused by rt"
      * lists match and returns a reference to it
@@ -613,6 +953,8 @@ private:
     int updated_controllers_index_ = 0;
     /// The index of the controllers list being used in the real-time thread.
     int used_by_realtime_controllers_index_ = -1;
+    /// The index of the controllers list being used in the cycle of each rate domain, or -1
+    std::vector<int> used_by_rate_domains_controllers_indices_;
     /// The callback to be called when the list is switched
     std::function<void()> on_switch_callback_ = nullptr;
   };
@@ -668,11 +1010,14 @@ private:
     double switch_perform_mode_time = 0.0;
     double deactivation_time = 0.0;
     double activation_time = 0.0;
+    /// Time spent preparing the activation of the controllers outside of the control loop
+    double activation_preparation_time = 0.0;
   };
 
   ControllerManagerExecutionTime execution_time_;
 
   controller_manager::MovingAverageStatistics periodicity_stats_;
+  controller_manager::MovingAverageStatistics step_stats_;
 
   struct SwitchParams
   {
@@ -712,6 +1057,12 @@ private:
     std::vector<std::string> from_chained_mode_request;
     std::vector<std::string> activate_command_interface_request;
     std::vector<std::string> deactivate_command_interface_request;
+    // Id of the command mode switch prepared by the resource manager for the interface requests
+    uint64_t command_mode_switch_id = 0;
+    // The update schedules of the controllers applied with the switch, with tick scheduling
+    using TickSchedule = hardware_interface::TickSchedule;
+    using ScheduleRequest = std::pair<std::shared_ptr<TickSchedule>, TickSchedule>;
+    std::vector<ScheduleRequest> update_schedule_request;
   };
 
   SwitchParams switch_params_;
@@ -751,6 +1102,36 @@ private:
     std::string concatenated_string;
   };
   RTBufferVariables rt_buffer_;
+
+  /// Logger used in the real-time paths (read, update, write and the switch), created in
+  /// init_controller_manager.
+  std::unique_ptr<hardware_interface::RealtimeLogger> rt_logger_;
+  std::chrono::steady_clock::time_point last_no_clock_warning_time_;
+  std::chrono::steady_clock::time_point last_overrun_warning_time_;
+  std::chrono::steady_clock::time_point last_load_shedding_warning_time_;
+  LoadShedding load_shedding_;
+  std::chrono::steady_clock::time_point last_stale_state_warning_time_;
+  DeadlineMisses deadline_misses_;
+  hardware_interface::DeadlineOverrunCounter deadline_overrun_counter_;
+  /// Placement of the real-time threads, nullptr if the CPU placement is disabled
+  std::unique_ptr<CpuPlacementPlanner> cpu_placement_;
+  mutable std::mutex cpu_placement_mutex_;
+
+  struct RateDomainCycles
+  {
+    /// Held by the cycle of the rate domain, or by the main loop to exclude it
+    std::mutex mutex;
+    uint64_t update_tick = 0;
+    uint64_t skipped_cycles = 0;
+    double execution_time = 0.0;
+    std::chrono::steady_clock::time_point last_stale_state_warning_time;
+    DeadlineMisses deadline_misses;
+    hardware_interface::DeadlineOverrunCounter deadline_overrun_counter;
+    /// Buffers of the cycle of the rate domain, as rt_buffer_ is used by the main control loop
+    RTBufferVariables rt_buffer;
+  };
+  std::vector<RateDomain> rate_domains_;
+  std::vector<std::unique_ptr<RateDomainCycles>> rate_domain_cycles_;
 };
 
 }  // namespace controller_manager
@@ -19,17 +19,61 @@
 #ifndef CONTROLLER_MANAGER__CONTROLLER_SPEC_HPP_
 #define CONTROLLER_MANAGER__CONTROLLER_SPEC_HPP_
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
 #include "controller_interface/controller_interface_base.hpp"
 #include "hardware_interface/controller_info.hpp"
+#include "hardware_interface/multi_rate_scheduler.hpp"
 #include "hardware_interface/types/statistics_types.hpp"
 
 namespace controller_manager
 {
 
 using MovingAverageStatistics = ros2_control::MovingAverageStatistics;
+
+/// Priority class of a controller for the load shedding of the controller manager
+/**
+ * When the control loop approaches an overrun, the updates of the controllers with the lowest
+ * priority are shed first. Critical controllers, and controllers claiming command interfaces or
+ * running in chained mode, are never shed.
+ */
+enum class ControllerPriority : uint8_t
+{
+  LOW = 0,
+  NORMAL = 1,
+  CRITICAL = 2,
+};
+
+/// Action of the controller manager when a controller keeps exceeding its execution time budget
+enum class BudgetViolationPolicy : uint8_t
+{
+  /// Warn about the violation
+  WARN,
+  /// Run the following updates of the controller asynchronously, out of the control loop
+  ASYNC,
+  /// Deactivate the controller and activate its fallback controllers
+  FALLBACK,
+};
+
+/// Execution time budget of a controller, checked after every synchronous update
+struct ExecutionTimeBudget
+{
+  /// Maximum execution time of an update in microseconds, 0 if the budget is not enforced
+  double limit = 0.0;
+  BudgetViolationPolicy policy = BudgetViolationPolicy::WARN;
+  /// Consecutive updates exceeding the limit
+  unsigned int consecutive_violations = 0;
+  /// Updates exceeding the limit since the controller was loaded
+  uint64_t violations = 0;
+  /// Throttles the warnings of the WARN policy, per controller as the controllers of the rate
+  /// domains are updated concurrently
+  std::chrono::steady_clock::time_point last_warning_time;
+};
+
 /// Controller Specification
 /**
  * This struct contains both a pointer to a given controller, \ref c, as well
@@ -43,6 +87,9 @@ struct ControllerSpec
     last_update_cycle_time = std::make_shared<rclcpp::Time>(0, 0, RCL_CLOCK_UNINITIALIZED);
     execution_time_statistics = std::make_shared<MovingAverageStatistics>();
     periodicity_statistics = std::make_shared<MovingAverageStatistics>();
+    update_schedule = std::make_shared<hardware_interface::TickSchedule>();
+    execution_time_budget = std::make_shared<ExecutionTimeBudget>();
+    deactivation_requested = std::make_shared<std::atomic_bool>(false);
   }
 
   hardware_interface::ControllerInfo info;
@@ -50,6 +97,14 @@ struct ControllerSpec
   std::shared_ptr<rclcpp::Time> last_update_cycle_time;
   std::shared_ptr<MovingAverageStatistics> execution_time_statistics;
   std::shared_ptr<MovingAverageStatistics> periodicity_statistics;
+  /// Ticks of the control loop the controller is updated in, only used with tick scheduling
+  std::shared_ptr<hardware_interface::TickSchedule> update_schedule;
+  ControllerPriority priority = ControllerPriority::NORMAL;
+  std::shared_ptr<ExecutionTimeBudget> execution_time_budget;
+  /// Rate domain whose real-time loop updates the controller, 0 for the main control loop
+  unsigned int rate_domain = 0;
+  /// Set by the real-time loops to deactivate the controller in the next cycle of the main loop
+  std::shared_ptr<std::atomic_bool> deactivation_requested;
 };
 
 struct ControllerChainSpec
@@ -0,0 +1,144 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CONTROLLER_MANAGER__CPU_PLACEMENT_HPP_
+#define CONTROLLER_MANAGER__CPU_PLACEMENT_HPP_
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace controller_manager
+{
+/// Parse a CPU list in the format of the kernel, e.g., "0-3,8,10-11".
+/**
+ * \param[in] cpu_list comma separated CPUs and ranges of CPUs, may be empty.
+ * \returns the sorted CPUs without duplicates.
+ * \throws std::invalid_argument if the list is malformed.
+ */
+std::vector<int> parse_cpu_list(const std::string & cpu_list);
+
+/// Topology of an online CPU.
+struct CpuInfo
+{
+  int id = 0;
+  /// Physical core of the CPU within its package
+  int core_id = 0;
+  int package_id = 0;
+  /// Lowest CPU sharing the last level cache with the CPU, identifies the cache
+  int last_level_cache = 0;
+  /// The CPU is isolated from the scheduler by the `isolcpus` kernel parameter
+  bool isolated = false;
+  /// CPUs of the same physical core, including the CPU itself
+  std::vector<int> smt_siblings;
+};
+
+/// Topology of the online CPUs of the system.
+struct CpuTopology
+{
+  /// Read the topology from the `cpu` directory of sysfs.
+  /**
+   * CPUs without topology information are treated as separate cores of package 0, CPUs without
+   * cache information as sharing the last level cache with their package.
+   *
+   * \param[in] sysfs_cpu_path path of the `cpu` directory of sysfs.
+   * \returns the topology, without CPUs if the list of online CPUs can't be read.
+   */
+  static CpuTopology read(const std::string & sysfs_cpu_path = "/sys/devices/system/cpu");
+
+  /// Get the topology of an online CPU, nullptr if the CPU isn't online.
+  const CpuInfo * find(int cpu) const;
+
+  /// Online CPUs sorted by their id
+  std::vector<CpuInfo> cpus;
+};
+
+/// CPUs assigned to a real-time thread.
+struct CpuPlacement
+{
+  std::string thread_name;
+  /// Thread exchanging data with the thread in every cycle, empty if none
+  std::string partner;
+  /// CPUs the thread is pinned to, a single CPU if placed by the planner
+  std::vector<int> cpus;
+  /// The CPUs are set by the configuration instead of the planner
+  bool configured = false;
+  /// The thread shares the last level cache with its partner
+  bool shares_cache_with_partner = false;
+};
+
+/// Assigns the real-time threads to physical cores of the CPU topology.
+/**
+ * Each placed thread gets a CPU of a physical core that is not used by any other real-time thread,
+ * so that no two real-time threads run on SMT siblings. Among the free cores, the planner prefers
+ * the CPUs isolated by `isolcpus`, then the cores sharing the last level cache with the partner of
+ * the thread, then the cores in the package of the partner. The core of CPU 0, which usually
+ * handles the housekeeping of the kernel, is used last.
+ *
+ * The CPUs of threads pinned by the configuration are reserved, the planner doesn't change them.
+ */
+class CpuPlacementPlanner
+{
+public:
+  explicit CpuPlacementPlanner(CpuTopology topology);
+
+  const CpuTopology & get_topology() const { return topology_; }
+
+  /// Reserve the physical cores of CPUs assigned to a thread by the configuration.
+  /**
+   * \param[in] thread_name name of the thread, replaces a previous placement of the thread.
+   * \param[in] cpus CPUs the thread is pinned to, CPUs that aren't online are ignored.
+   * \param[in] partner name of the thread exchanging data with the thread, or empty.
+   */
+  void reserve(
+    const std::string & thread_name, const std::vector<int> & cpus,
+    const std::string & partner = "");
+
+  /// Assign a CPU of a free physical core to a thread.
+  /**
+   * \param[in] thread_name name of the thread, its current placement is returned if it is already
+   * placed.
+   * \param[in] partner name of the placed thread exchanging data with the thread, or empty.
+   * \returns the CPU, or std::nullopt if no physical core is free.
+   */
+  std::optional<int> place(const std::string & thread_name, const std::string & partner = "");
+
+  /// Free the physical cores of a thread.
+  void release(const std::string & thread_name);
+
+  /// Get the placement of a thread, nullptr if it isn't placed.
+  const CpuPlacement * get_placement(const std::string & thread_name) const;
+
+  /// Placements of the threads in the order they were placed
+  const std::vector<CpuPlacement> & get_plan() const { return plan_; }
+
+  /// Describe the CPUs of a placement and whether they share the cache with the partner.
+  std::string describe(const CpuPlacement & placement) const;
+
+  /// Describe the plan, one line per thread.
+  std::string to_string() const;
+
+private:
+  bool is_core_free(const CpuInfo & cpu) const;
+
+  bool shares_cache(const std::vector<int> & cpus, const CpuPlacement * partner) const;
+
+  CpuTopology topology_;
+  bool has_isolated_cpus_ = false;
+  std::vector<CpuPlacement> plan_;
+};
+
+}  // namespace controller_manager
+
+#endif  // CONTROLLER_MANAGER__CPU_PLACEMENT_HPP_
@@ -0,0 +1,68 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CONTROLLER_MANAGER__LOAD_GENERATOR_CONTROLLER_HPP_
+#define CONTROLLER_MANAGER__LOAD_GENERATOR_CONTROLLER_HPP_
+
+#include <string>
+#include <vector>
+
+#include "controller_interface/chainable_controller_interface.hpp"
+#include "mock_components/synthetic_load.hpp"
+
+namespace controller_manager
+{
+/// Chainable controller generating a synthetic load in each update for capacity planning.
+/**
+ * The controller claims the interfaces listed in the `command_interfaces` and `state_interfaces`
+ * parameters and exports the reference and state interfaces listed in `reference_interfaces` and
+ * `exported_state_interfaces`, so that chains of any length can be built. In each update it spends
+ * the cpu time, touches the cache footprint and fails with the failure rate given by the
+ * parameters `cpu_time_us`, `memory_footprint_bytes`, `cache_footprint_bytes`,
+ * `jitter_distribution`, `jitter_us`, `failure_rate` and `seed`, see
+ * mock_components::SyntheticLoadParameters.
+ *
+ * In chained mode, the i-th command is set to the i-th reference if it is finite. Otherwise, the
+ * i-th claimed state is forwarded to it. The i-th exported state forwards the i-th claimed state.
+ */
+class LoadGeneratorController : public controller_interface::ChainableControllerInterface
+{
+public:
+  controller_interface::CallbackReturn on_init() override;
+
+  controller_interface::InterfaceConfiguration command_interface_configuration() const override;
+
+  controller_interface::InterfaceConfiguration state_interface_configuration() const override;
+
+  controller_interface::CallbackReturn on_configure(
+    const rclcpp_lifecycle::State & previous_state) override;
+
+  const mock_components::SyntheticLoad & get_synthetic_load() const { return load_; }
+
+protected:
+  controller_interface::return_type update_reference_from_subscribers(
+    const rclcpp::Time & time, const rclcpp::Duration & period) override;
+
+  controller_interface::return_type update_and_write_commands(
+    const rclcpp::Time & time, const rclcpp::Duration & period) override;
+
+private:
+  std::vector<std::string> command_interface_names_;
+  std::vector<std::string> state_interface_names_;
+  mock_components::SyntheticLoad load_;
+};
+
+}  // namespace controller_manager
+
+#endif  // CONTROLLER_MANAGER__LOAD_GENERATOR_CONTROLLER_HPP_
@@ -0,0 +1,69 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef CONTROLLER_MANAGER__SWITCH_PLAN_HPP_
+#define CONTROLLER_MANAGER__SWITCH_PLAN_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace controller_manager
+{
+/// Precompiled controller switch
+/**
+ * The plan is the result of validating a switch request with
+ * \ref ControllerManager::prepare_switch. It holds the resolved activation, deactivation and
+ * chained mode lists, the command interfaces to start and stop and the position of every affected
+ * controller in the controllers list. It can be executed with
+ * \ref ControllerManager::execute_switch without repeating the validation, as long as the
+ * involved controllers are still in the state they were in when the plan was compiled.
+ */
+struct SwitchPlan
+{
+  /// Check if the plan has any controller to activate or deactivate.
+  bool empty() const { return activate_request.empty() && deactivate_request.empty(); }
+
+  void clear()
+  {
+    strictness = 0;
+    activate_request.clear();
+    deactivate_request.clear();
+    to_chained_mode_request.clear();
+    from_chained_mode_request.clear();
+    activate_command_interface_request.clear();
+    deactivate_command_interface_request.clear();
+    activate_indices.clear();
+    deactivate_indices.clear();
+  }
+
+  /// Strictness the plan was compiled with (STRICT or BEST_EFFORT)
+  int strictness = 0;
+
+  std::vector<std::string> activate_request;
+  std::vector<std::string> deactivate_request;
+  std::vector<std::string> to_chained_mode_request;
+  std::vector<std::string> from_chained_mode_request;
+  std::vector<std::string> activate_command_interface_request;
+  std::vector<std::string> deactivate_command_interface_request;
+
+  /// Position of the controllers in \ref activate_request within the controllers list
+  std::vector<size_t> activate_indices;
+  /// Position of the controllers in \ref deactivate_request within the controllers list
+  std::vector<size_t> deactivate_indices;
+};
+
+}  // namespace controller_manager
+
+#endif  // CONTROLLER_MANAGER__SWITCH_PLAN_HPP_
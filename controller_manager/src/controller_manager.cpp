@@ -26,6 +26,7 @@
 #include "controller_manager_msgs/msg/hardware_component_state.hpp"
 #include "hardware_interface/helpers.hpp"
 #include "hardware_interface/introspection.hpp"
+#include "hardware_interface/realtime_memory.hpp"
 #include "hardware_interface/types/lifecycle_state_names.hpp"
 #include "lifecycle_msgs/msg/state.hpp"
 #include "rcl/arguments.h"
@@ -357,6 +358,20 @@ void get_controller_list_command_interfaces(
   }
 }
 
+void set_rate_domains_params(
+  const std::vector<controller_manager::ControllerManager::RateDomain> & rate_domains,
+  hardware_interface::ResourceManagerParams & params)
+{
+  for (unsigned int i = 0; i < rate_domains.size(); ++i)
+  {
+    params.rate_domain_update_rates.push_back(rate_domains[i].update_rate);
+    for (const auto & component_name : rate_domains[i].hardware_components)
+    {
+      params.hardware_components_rate_domains[component_name] = i + 1;
+    }
+  }
+}
+
 void register_controller_manager_statistics(
   const std::string & name,
   const libstatistics_collector::moving_average_statistics::StatisticData * variable)
@@ -373,6 +388,33 @@ void unregister_controller_manager_statistics(const std::string & name)
   UNREGISTER_ENTITY(hardware_interface::CM_STATISTICS_KEY, name + "/sample_count");
   UNREGISTER_ENTITY(hardware_interface::CM_STATISTICS_KEY, name + "/current_value");
 }
+
+/// CPUs of an integer or integer array parameter, empty for parameters of other types.
+std::vector<int> get_cpus_from_parameter(const rclcpp::Parameter & parameter)
+{
+  std::vector<int> cpus;
+  if (parameter.get_type() == rclcpp::ParameterType::PARAMETER_INTEGER)
+  {
+    cpus.push_back(static_cast<int>(parameter.as_int()));
+  }
+  else if (parameter.get_type() == rclcpp::ParameterType::PARAMETER_INTEGER_ARRAY)
+  {
+    for (const auto cpu : parameter.as_integer_array())
+    {
+      cpus.push_back(static_cast<int>(cpu));
+    }
+  }
+  return cpus;
+}
+
+std::string make_arena_stats_string(
+  const hardware_interface::RealtimeMemoryArenaStatistics & statistics)
+{
+  return fmt::format(
+    FMT_COMPILE("Used: {} bytes, High-water mark: {} of {} bytes, Failed allocations: {}"),
+    statistics.used_bytes, statistics.high_water_mark, statistics.capacity,
+    statistics.failed_allocations);
+}
 }  // namespace
 
 namespace controller_manager
@@ -414,6 +456,8 @@ ControllerManager::ControllerManager(
   robot_description_(urdf)
 {
   initialize_parameters();
+  init_rate_domains();
+  init_cpu_placement();
   hardware_interface::ResourceManagerParams params;
   params.robot_description = robot_description_;
   params.clock = trigger_clock_;
@@ -426,6 +470,10 @@ ControllerManager::ControllerManager(
     params_->defaults.allow_controller_activation_with_inactive_hardware;
   params.return_failed_hardware_names_on_return_deactivate_write_cycle_ =
     params_->defaults.deactivate_controllers_on_hardware_self_deactivate;
+  params.stale_state_read_cycles =
+    static_cast<unsigned int>(params_->hardware_components_stale_state_read_cycles);
+  params.tick_scheduling = params_->tick_scheduling;
+  set_rate_domains_params(rate_domains_, params);
   resource_manager_ =
     std::make_unique<hardware_interface::ResourceManager>(params, !robot_description_.empty());
   init_controller_manager();
@@ -449,6 +497,22 @@ ControllerManager::ControllerManager(
   robot_description_(resource_manager_->get_robot_description())
 {
   initialize_parameters();
+  init_rate_domains();
+  init_cpu_placement();
+  for (auto & rate_domain : rate_domains_)
+  {
+    if (!resource_manager_->are_components_initialized())
+    {
+      // assigned when the robot description is received
+      break;
+    }
+    RCLCPP_WARN_EXPRESSION(
+      get_logger(), !rate_domain.hardware_components.empty(),
+      "The hardware components of the rate domain '%s' are read and written by the main control "
+      "loop, as the resource manager is already initialized.",
+      rate_domain.name.c_str());
+    rate_domain.hardware_components.clear();
+  }
   init_controller_manager();
 }
 
@@ -495,6 +559,7 @@ bool ControllerManager::shutdown_controllers()
 
 void ControllerManager::init_controller_manager()
 {
+  rt_logger_ = std::make_unique<hardware_interface::RealtimeLogger>(get_logger());
   controller_manager_activity_publisher_ =
     create_publisher<controller_manager_msgs::msg::ControllerManagerActivity>(
       "~/activity", rclcpp::QoS(1).reliable().transient_local());
@@ -510,6 +575,7 @@ void ControllerManager::init_controller_manager()
     {
       resource_manager_->import_joint_limiters(robot_description_);
     }
+    place_async_hardware_components();
     init_services();
   }
   else
@@ -534,6 +600,7 @@ void ControllerManager::init_controller_manager()
 
   // Setup diagnostics
   periodicity_stats_.reset();
+  step_stats_.reset();
   diagnostics_updater_.setHardwareID("ros2_control");
   diagnostics_updater_.add(
     "Controllers Activity", this, &ControllerManager::controller_activity_diagnostic_callback);
@@ -616,6 +683,78 @@ void ControllerManager::initialize_parameters()
   }
 }
 
+void ControllerManager::init_rate_domains()
+{
+  std::unordered_map<std::string, std::string> hardware_components_rate_domains;
+  for (const auto & name : params_->rate_domains.names)
+  {
+    if (name.empty() || name == "names")
+    {
+      throw std::runtime_error(
+        fmt::format(FMT_COMPILE("The rate domain name '{}' is not allowed."), name));
+    }
+    const std::string prefix = "rate_domains." + name + ".";
+    RateDomain rate_domain;
+    rate_domain.name = name;
+    const int64_t update_rate = get_parameter_or<int64_t>(prefix + "update_rate", 0);
+    if (update_rate <= 0)
+    {
+      throw std::runtime_error(fmt::format(
+        FMT_COMPILE("The parameter '{}update_rate' of the rate domain has to be positive."),
+        prefix));
+    }
+    rate_domain.update_rate = static_cast<unsigned int>(update_rate);
+    rate_domain.thread_priority =
+      static_cast<int>(get_parameter_or<int64_t>(prefix + "thread_priority", 50));
+    rclcpp::Parameter cpu_affinity_param;
+    if (get_parameter(prefix + "cpu_affinity", cpu_affinity_param))
+    {
+      rate_domain.cpu_affinity = get_cpus_from_parameter(cpu_affinity_param);
+    }
+    hardware_interface::DeadlineSchedulingParams deadline_scheduling;
+    deadline_scheduling.runtime =
+      std::chrono::microseconds(get_parameter_or<int64_t>(prefix + "sched_runtime", 0));
+    deadline_scheduling.deadline =
+      std::chrono::microseconds(get_parameter_or<int64_t>(prefix + "sched_deadline", 0));
+    deadline_scheduling.period =
+      std::chrono::microseconds(get_parameter_or<int64_t>(prefix + "sched_period", 0));
+    if (deadline_scheduling.is_enabled())
+    {
+      try
+      {
+        rate_domain.deadline_scheduling = hardware_interface::resolve_deadline_scheduling_params(
+          deadline_scheduling, std::chrono::microseconds(1'000'000 / rate_domain.update_rate));
+      }
+      catch (const std::invalid_argument & e)
+      {
+        throw std::runtime_error(fmt::format(
+          FMT_COMPILE("Invalid SCHED_DEADLINE parameters of the rate domain '{}': {}"), name,
+          e.what()));
+      }
+    }
+    rate_domain.hardware_components =
+      get_parameter_or<std::vector<std::string>>(prefix + "hardware_components", {});
+    std::string hardware_components_string;
+    for (const auto & component_name : rate_domain.hardware_components)
+    {
+      const auto [it, inserted] = hardware_components_rate_domains.emplace(component_name, name);
+      if (!inserted)
+      {
+        throw std::runtime_error(fmt::format(
+          FMT_COMPILE("The hardware component '{}' is part of the rate domains '{}' and '{}'."),
+          component_name, it->second, name));
+      }
+      hardware_components_string += " " + component_name;
+    }
+    RCLCPP_INFO(
+      get_logger(), "Rate domain '%s' with update rate %u Hz and hardware components [%s ]",
+      name.c_str(), rate_domain.update_rate, hardware_components_string.c_str());
+    rate_domains_.push_back(std::move(rate_domain));
+    rate_domain_cycles_.push_back(std::make_unique<RateDomainCycles>());
+  }
+  rt_controllers_wrapper_.set_rate_domains_count(rate_domains_.size());
+}
+
 void ControllerManager::robot_description_callback(const std_msgs::msg::String & robot_description)
 {
   RCLCPP_INFO(get_logger(), "Received robot description from topic.");
@@ -636,6 +775,7 @@ void ControllerManager::robot_description_callback(const std_msgs::msg::String &
       get_logger(),
       "Resource Manager has been successfully initialized. Starting Controller Manager "
       "services...");
+    place_async_hardware_components();
     init_services();
   }
 }
@@ -653,6 +793,10 @@ void ControllerManager::init_resource_manager(const std::string & robot_descript
   params.executor = executor_;
   params.node_namespace = this->get_namespace();
   params.update_rate = static_cast<unsigned int>(params_->update_rate);
+  params.stale_state_read_cycles =
+    static_cast<unsigned int>(params_->hardware_components_stale_state_read_cycles);
+  params.tick_scheduling = params_->tick_scheduling;
+  set_rate_domains_params(rate_domains_, params);
   if (!resource_manager_->load_and_initialize_components(params))
   {
     RCLCPP_WARN(
@@ -885,6 +1029,39 @@ void ControllerManager::init_services()
   REGISTER_ENTITY(
     hardware_interface::CM_STATISTICS_KEY, cm_name + ".activation_time",
     &execution_time_.activation_time);
+  REGISTER_ENTITY(
+    hardware_interface::CM_STATISTICS_KEY, cm_name + ".activation_preparation_time",
+    &execution_time_.activation_preparation_time);
+  REGISTER_ENTITY(
+    hardware_interface::CM_STATISTICS_KEY, cm_name + ".load_shedding.level", &load_shedding_.level);
+  REGISTER_ENTITY(
+    hardware_interface::CM_STATISTICS_KEY, cm_name + ".load_shedding.events",
+    &load_shedding_.events);
+  REGISTER_ENTITY(
+    hardware_interface::CM_STATISTICS_KEY, cm_name + ".load_shedding.shed_updates",
+    &load_shedding_.shed_updates);
+  REGISTER_ENTITY(
+    hardware_interface::CM_STATISTICS_KEY, cm_name + ".deadline_misses.runtime_overruns",
+    &deadline_misses_.runtime_overruns);
+  REGISTER_ENTITY(
+    hardware_interface::CM_STATISTICS_KEY, cm_name + ".deadline_misses.missed_cycles",
+    &deadline_misses_.missed_cycles);
+  for (size_t i = 0; i < rate_domains_.size(); ++i)
+  {
+    const std::string prefix = cm_name + ".rate_domains." + rate_domains_[i].name;
+    REGISTER_ENTITY(
+      hardware_interface::CM_STATISTICS_KEY, prefix + ".execution_time",
+      &rate_domain_cycles_[i]->execution_time);
+    REGISTER_ENTITY(
+      hardware_interface::CM_STATISTICS_KEY, prefix + ".skipped_cycles",
+      &rate_domain_cycles_[i]->skipped_cycles);
+    REGISTER_ENTITY(
+      hardware_interface::CM_STATISTICS_KEY, prefix + ".deadline_misses.runtime_overruns",
+      &rate_domain_cycles_[i]->deadline_misses.runtime_overruns);
+    REGISTER_ENTITY(
+      hardware_interface::CM_STATISTICS_KEY, prefix + ".deadline_misses.missed_cycles",
+      &rate_domain_cycles_[i]->deadline_misses.missed_cycles);
+  }
 }
 
 controller_interface::ControllerInterfaceBaseSharedPtr ControllerManager::load_controller(
@@ -1015,6 +1192,91 @@ controller_interface::ControllerInterfaceBaseSharedPtr ControllerManager::load_c
     controller_spec.info.fallback_controllers_names = fallback_controllers;
   }
 
+  const std::string priority_param = fmt::format(FMT_COMPILE("{}.priority"), controller_name);
+  if (!has_parameter(priority_param))
+  {
+    declare_parameter(priority_param, std::string("normal"));
+  }
+  const std::string priority = get_parameter(priority_param).as_string();
+  if (priority == "low")
+  {
+    controller_spec.priority = ControllerPriority::LOW;
+  }
+  else if (priority == "critical")
+  {
+    controller_spec.priority = ControllerPriority::CRITICAL;
+  }
+  else if (priority != "normal")
+  {
+    RCLCPP_ERROR(
+      get_logger(),
+      "The priority '%s' of controller '%s' is invalid, expected 'low', 'normal' or 'critical'.",
+      priority.c_str(), controller_name.c_str());
+    return nullptr;
+  }
+
+  const std::string rate_domain_param =
+    fmt::format(FMT_COMPILE("{}.rate_domain"), controller_name);
+  if (!has_parameter(rate_domain_param))
+  {
+    declare_parameter(rate_domain_param, std::string(""));
+  }
+  const std::string rate_domain = get_parameter(rate_domain_param).as_string();
+  if (!rate_domain.empty())
+  {
+    const auto rate_domain_it = std::find_if(
+      rate_domains_.begin(), rate_domains_.end(),
+      [&rate_domain](const RateDomain & domain) { return domain.name == rate_domain; });
+    if (rate_domain_it == rate_domains_.end())
+    {
+      RCLCPP_ERROR(
+        get_logger(), "The rate domain '%s' of controller '%s' is not defined in '%s'.",
+        rate_domain.c_str(), controller_name.c_str(), "rate_domains.names");
+      return nullptr;
+    }
+    controller_spec.rate_domain =
+      static_cast<unsigned int>(std::distance(rate_domains_.begin(), rate_domain_it)) + 1u;
+  }
+
+  const std::string budget_param =
+    fmt::format(FMT_COMPILE("{}.execution_time_budget"), controller_name);
+  const std::string budget_policy_param =
+    fmt::format(FMT_COMPILE("{}.execution_time_budget_policy"), controller_name);
+  if (!has_parameter(budget_param))
+  {
+    // the budget may be given as an integer number of microseconds
+    rcl_interfaces::msg::ParameterDescriptor budget_descriptor;
+    budget_descriptor.dynamic_typing = true;
+    declare_parameter(budget_param, rclcpp::ParameterValue(0.0), budget_descriptor);
+  }
+  if (!has_parameter(budget_policy_param))
+  {
+    declare_parameter(budget_policy_param, std::string("warn"));
+  }
+  const auto budget = get_parameter(budget_param);
+  controller_spec.execution_time_budget->limit =
+    budget.get_type() == rclcpp::ParameterType::PARAMETER_INTEGER
+      ? static_cast<double>(budget.as_int())
+      : budget.as_double();
+  const std::string budget_policy = get_parameter(budget_policy_param).as_string();
+  if (budget_policy == "async")
+  {
+    controller_spec.execution_time_budget->policy = BudgetViolationPolicy::ASYNC;
+  }
+  else if (budget_policy == "fallback")
+  {
+    controller_spec.execution_time_budget->policy = BudgetViolationPolicy::FALLBACK;
+  }
+  else if (budget_policy != "warn")
+  {
+    RCLCPP_ERROR(
+      get_logger(),
+      "The execution time budget policy '%s' of controller '%s' is invalid, expected 'warn', "
+      "'async' or 'fallback'.",
+      budget_policy.c_str(), controller_name.c_str());
+    return nullptr;
+  }
+
   const std::string node_options_args_param =
     fmt::format(FMT_COMPILE("{}.node_options_args"), controller_name);
   std::vector<std::string> node_options_args;
@@ -1107,6 +1369,13 @@ controller_interface::return_type ControllerManager::unload_controller(
   unregister_controller_manager_statistics(controller_name + ".stats/periodicity");
   executor_->remove_node(controller.c->get_node()->get_node_base_interface());
   to.erase(found_it);
+  {
+    std::lock_guard<std::mutex> cpu_placement_guard(cpu_placement_mutex_);
+    if (cpu_placement_)
+    {
+      cpu_placement_->release("controller/" + controller_name);
+    }
+  }
 
   // Destroys the old controllers list when the realtime thread is finished with it.
   RCLCPP_DEBUG(get_logger(), "Realtime switches over to new controller list");
@@ -1252,7 +1521,7 @@ controller_interface::return_type ControllerManager::configure_controller(
   }
 
   const auto controller_update_rate = controller->get_update_rate();
-  const auto cm_update_rate = get_update_rate();
+  const auto cm_update_rate = get_rate_domain_update_rate(found_it->rate_domain);
   if (controller_update_rate > cm_update_rate)
   {
     RCLCPP_WARN(
@@ -1272,6 +1541,7 @@ controller_interface::return_type ControllerManager::configure_controller(
       controller_name.c_str(), 1.0 / controller_update_rate, controller_update_rate,
       cm_update_rate);
   }
+  place_async_controller(*found_it);
 
   // CHAINABLE CONTROLLERS: get reference interfaces from chainable controllers
   if (controller->is_chainable())
@@ -1439,6 +1709,44 @@ void ControllerManager::clear_requests()
   switch_params_.from_chained_mode_request.clear();
   switch_params_.activate_command_interface_request.clear();
   switch_params_.deactivate_command_interface_request.clear();
+  switch_params_.command_mode_switch_id = 0;
+  switch_params_.update_schedule_request.clear();
+}
+
+void ControllerManager::cancel_activation_preparations(
+  const std::vector<ControllerSpec> & controllers, const SwitchPlan & plan)
+{
+  for (const auto controller_index : plan.activate_indices)
+  {
+    const auto & controller = controllers[controller_index];
+    if (!controller.c->is_activation_prepared() || !is_controller_inactive(controller.c))
+    {
+      continue;
+    }
+    try
+    {
+      if (controller.c->cancel_activation() != controller_interface::return_type::OK)
+      {
+        RCLCPP_ERROR(
+          get_logger(), "Could not undo the preparation of the activation of controller '%s'.",
+          controller.info.name.c_str());
+      }
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_ERROR(
+        get_logger(),
+        "Caught exception of type : %s while cancelling the activation of the controller '%s': %s",
+        typeid(e).name(), controller.info.name.c_str(), e.what());
+    }
+    catch (...)
+    {
+      RCLCPP_ERROR(
+        get_logger(),
+        "Caught unknown exception while cancelling the activation of the controller '%s'",
+        controller.info.name.c_str());
+    }
+  }
 }
 
 controller_interface::return_type ControllerManager::switch_controller(
@@ -1456,6 +1764,22 @@ controller_interface::return_type ControllerManager::switch_controller_cb(
   const std::vector<std::string> & deactivate_controllers, int strictness, bool activate_asap,
   const rclcpp::Duration & timeout, std::string & message)
 {
+  SwitchPlan plan;
+  const auto ret =
+    prepare_switch(activate_controllers, deactivate_controllers, strictness, plan, message);
+  if (ret != controller_interface::return_type::OK || plan.empty())
+  {
+    return ret;
+  }
+  return execute_switch(plan, activate_asap, timeout, message);
+}
+
+controller_interface::return_type ControllerManager::prepare_switch(
+  const std::vector<std::string> & activate_controllers,
+  const std::vector<std::string> & deactivate_controllers, int strictness, SwitchPlan & plan,
+  std::string & message)
+{
+  plan.clear();
   if (!is_resource_manager_initialized())
   {
     message =
@@ -1947,6 +2271,95 @@ controller_interface::return_type ControllerManager::switch_controller_cb(
     return controller_interface::return_type::ERROR;
   }
 
+  // compile the plan, the position of the controllers is resolved once so that executing the plan
+  // doesn't need to search the controllers list by name again
+  const auto get_controller_indices = [&controllers](const std::vector<std::string> & names)
+  {
+    std::vector<size_t> indices;
+    indices.reserve(names.size());
+    for (const auto & name : names)
+    {
+      auto controller_it = std::find_if(
+        controllers.begin(), controllers.end(),
+        std::bind(controller_name_compare, std::placeholders::_1, name));
+      indices.push_back(static_cast<size_t>(std::distance(controllers.begin(), controller_it)));
+    }
+    return indices;
+  };
+  plan.strictness = strictness;
+  plan.activate_request = switch_params_.activate_request;
+  plan.deactivate_request = switch_params_.deactivate_request;
+  plan.to_chained_mode_request = switch_params_.to_chained_mode_request;
+  plan.from_chained_mode_request = switch_params_.from_chained_mode_request;
+  plan.activate_command_interface_request = switch_params_.activate_command_interface_request;
+  plan.deactivate_command_interface_request = switch_params_.deactivate_command_interface_request;
+  plan.activate_indices = get_controller_indices(plan.activate_request);
+  plan.deactivate_indices = get_controller_indices(plan.deactivate_request);
+
+  // The reference interfaces made available for the checks are made available again when the plan
+  // is executed
+  clear_requests();
+
+  return controller_interface::return_type::OK;
+}
+
+controller_interface::return_type ControllerManager::execute_switch(
+  const SwitchPlan & plan, bool activate_asap, const rclcpp::Duration & timeout,
+  std::string & message)
+{
+  if (!is_resource_manager_initialized())
+  {
+    message =
+      "Resource Manager is not initialized yet! Please provide robot description on "
+      "'robot_description' topic before trying to switch controllers.";
+    RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+    return controller_interface::return_type::ERROR;
+  }
+  if (plan.empty())
+  {
+    message = "The switch plan is empty, no controllers need to be activated or deactivated.";
+    RCLCPP_INFO(get_logger(), "%s", message.c_str());
+    return controller_interface::return_type::OK;
+  }
+
+  // lock controllers
+  std::lock_guard<std::recursive_mutex> guard(rt_controllers_wrapper_.controllers_lock_);
+
+  const std::vector<ControllerSpec> & controllers = rt_controllers_wrapper_.get_updated_list(guard);
+
+  if (
+    check_switch_plan_is_valid(controllers, plan, message) !=
+    controller_interface::return_type::OK)
+  {
+    return controller_interface::return_type::ERROR;
+  }
+
+  switch_params_.reset();
+  const int strictness = plan.strictness;
+  switch_params_.activate_request = plan.activate_request;
+  switch_params_.deactivate_request = plan.deactivate_request;
+  switch_params_.to_chained_mode_request = plan.to_chained_mode_request;
+  switch_params_.from_chained_mode_request = plan.from_chained_mode_request;
+  switch_params_.activate_command_interface_request = plan.activate_command_interface_request;
+  switch_params_.deactivate_command_interface_request = plan.deactivate_command_interface_request;
+
+  // make the interfaces of the controllers switching to chained mode available, so they can be
+  // claimed by the preceding controllers activated in the same switch
+  for (const auto & controller_name : switch_params_.to_chained_mode_request)
+  {
+    resource_manager_->make_controller_exported_state_interfaces_available(controller_name);
+    resource_manager_->make_controller_reference_interfaces_available(controller_name);
+  }
+
+  if (
+    check_for_interfaces_availability_to_activate(
+      controllers, switch_params_.activate_request, message) !=
+    controller_interface::return_type::OK)
+  {
+    clear_requests();
+    return controller_interface::return_type::ERROR;
+  }
+
   RCLCPP_DEBUG(get_logger(), "Request for command interfaces from activating controllers:");
   for (const auto & interface : switch_params_.activate_command_interface_request)
   {
@@ -1958,17 +2371,87 @@ controller_interface::return_type ControllerManager::switch_controller_cb(
     RCLCPP_DEBUG(get_logger(), " - %s", interface.c_str());
   }
 
-  // wait for deactivating async controllers to finish their current cycle
-  for (const auto & controller : switch_params_.deactivate_request)
+  // run the non real-time phase of the activation here, so that only committing the activation is
+  // left to the control loop
+  const auto prepare_activation_start_time = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < plan.activate_request.size(); ++i)
   {
-    auto controller_it = std::find_if(
-      controllers.begin(), controllers.end(),
-      std::bind(controller_name_compare, std::placeholders::_1, controller));
-    if (controller_it != controllers.end())
+    const auto & controller_name = plan.activate_request[i];
+    const auto & controller = controllers[plan.activate_indices[i]];
+    // controllers restarted within the switch are still active and are activated in one phase
+    if (!is_controller_inactive(controller.c))
+    {
+      continue;
+    }
+    auto prepare_result = controller_interface::return_type::ERROR;
+    const auto ctrl_start_time = std::chrono::steady_clock::now();
+    try
+    {
+      prepare_result = controller.c->prepare_activation();
+    }
+    catch (const std::exception & e)
+    {
+      RCLCPP_ERROR(
+        get_logger(),
+        "Caught exception of type : %s while preparing the activation of the controller '%s': %s",
+        typeid(e).name(), controller_name.c_str(), e.what());
+    }
+    catch (...)
+    {
+      RCLCPP_ERROR(
+        get_logger(),
+        "Caught unknown exception while preparing the activation of the controller '%s'",
+        controller_name.c_str());
+    }
+    RCLCPP_DEBUG(
+      get_logger(), "Preparing the activation of controller '%s' took %.3f us",
+      controller_name.c_str(),
+      std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - ctrl_start_time)
+        .count());
+    if (prepare_result != controller_interface::return_type::OK)
     {
-      controller_it->c->prepare_for_deactivation();
+      message = fmt::format(
+        FMT_COMPILE("Could not prepare the activation of controller '{}'."), controller_name);
+      if (strictness == controller_manager_msgs::srv::SwitchController::Request::STRICT)
+      {
+        RCLCPP_ERROR(
+          get_logger(), "%s Aborting, no controller is switched! (::STRICT switch)",
+          message.c_str());
+        cancel_activation_preparations(controllers, plan);
+        clear_requests();
+        return controller_interface::return_type::ERROR;
+      }
+      RCLCPP_WARN(get_logger(), "%s Skipping its activation.", message.c_str());
+      message.clear();
+      (void)ros2_control::remove_item(switch_params_.activate_request, controller_name);
+      std::vector<std::string> controller_command_interfaces;
+      extract_command_interfaces_for_controller(
+        controller, resource_manager_, controller_command_interfaces);
+      for (const auto & interface : controller_command_interfaces)
+      {
+        (void)ros2_control::remove_item(
+          switch_params_.activate_command_interface_request, interface);
+      }
     }
   }
+  execution_time_.activation_preparation_time =
+    std::chrono::duration<double, std::micro>(
+      std::chrono::steady_clock::now() - prepare_activation_start_time)
+      .count();
+
+  if (switch_params_.activate_request.empty() && switch_params_.deactivate_request.empty())
+  {
+    message = "After preparing the activation, no controllers need to be activated or deactivated.";
+    RCLCPP_INFO(get_logger(), "%s", message.c_str());
+    clear_requests();
+    return controller_interface::return_type::OK;
+  }
+
+  // wait for deactivating async controllers to finish their current cycle
+  for (const auto controller_index : plan.deactivate_indices)
+  {
+    controllers[controller_index].c->prepare_for_deactivation();
+  }
 
   if (
     !switch_params_.activate_command_interface_request.empty() ||
@@ -1976,15 +2459,23 @@ controller_interface::return_type ControllerManager::switch_controller_cb(
   {
     if (!resource_manager_->prepare_command_mode_switch(
           switch_params_.activate_command_interface_request,
-          switch_params_.deactivate_command_interface_request))
+          switch_params_.deactivate_command_interface_request,
+          switch_params_.command_mode_switch_id))
     {
       message = "Could not switch controllers since prepare command mode switch was rejected.";
       RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+      cancel_activation_preparations(controllers, plan);
       clear_requests();
       return controller_interface::return_type::ERROR;
     }
   }
 
+  std::vector<double> load_profile;
+  if (params_->tick_scheduling)
+  {
+    load_profile = request_controller_update_schedules(controllers);
+  }
+
   // start the atomic controller switching
   switch_params_.strictness = strictness;
   switch_params_.activate_asap = activate_asap;
@@ -2011,7 +2502,9 @@ controller_interface::return_type ControllerManager::switch_controller_cb(
         FMT_COMPILE("Switch controller timed out after {} seconds!"),
         static_cast<double>(switch_params_.timeout.count()) / 1e9);
       RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+      // the control loop can't start the switch while the mutex is held
       clear_requests();
+      cancel_activation_preparations(controllers, plan);
       return controller_interface::return_type::ERROR;
     }
   }
@@ -2019,7 +2512,11 @@ controller_interface::return_type ControllerManager::switch_controller_cb(
   {
     RCLCPP_INFO(get_logger(), "Requested controller switch from non-realtime loop");
     // This should work as the realtime thread operation is read-only operation
-    manage_switch();
+    manage_switch(true);
+  }
+  if (params_->tick_scheduling)
+  {
+    controller_load_profile_ = std::move(load_profile);
   }
 
   // copy the controllers spec from the used to the unused list
@@ -2041,6 +2538,59 @@ controller_interface::return_type ControllerManager::switch_controller_cb(
   return switch_result;
 }
 
+std::vector<double> ControllerManager::request_controller_update_schedules(
+  const std::vector<ControllerSpec> & controllers)
+{
+  std::vector<std::shared_ptr<hardware_interface::TickSchedule>> schedules;
+  std::vector<unsigned int> rates;
+  for (const auto & controller : controllers)
+  {
+    const bool activated =
+      ros2_control::has_item(switch_params_.activate_request, controller.info.name);
+    const bool deactivated =
+      ros2_control::has_item(switch_params_.deactivate_request, controller.info.name);
+    if (controller.rate_domain != 0)
+    {
+      // scheduled in its first update by the loop of its rate domain
+      if (activated || deactivated)
+      {
+        switch_params_.update_schedule_request.emplace_back(
+          controller.update_schedule, hardware_interface::TickSchedule{});
+      }
+    }
+    else if (activated || (is_controller_active(controller.c) && !deactivated))
+    {
+      schedules.push_back(controller.update_schedule);
+      rates.push_back(controller.c->get_update_rate());
+    }
+    else if (deactivated)
+    {
+      // rescheduled the next time the controller is activated
+      switch_params_.update_schedule_request.emplace_back(
+        controller.update_schedule, hardware_interface::TickSchedule{});
+    }
+  }
+
+  auto schedule = hardware_interface::compute_multi_rate_schedule(update_rate_, rates);
+  for (size_t i = 0; i < schedules.size(); ++i)
+  {
+    switch_params_.update_schedule_request.emplace_back(schedules[i], schedule.tasks[i]);
+  }
+  RCLCPP_DEBUG(
+    get_logger(),
+    "Scheduled %zu active controllers over a hyperperiod of %zu cycles, at most %.0f and on "
+    "average %.2f controller updates per cycle",
+    rates.size(), schedule.load_profile.size(), schedule.get_peak_load(),
+    schedule.get_average_load());
+  return std::move(schedule.load_profile);
+}
+
+std::vector<double> ControllerManager::get_controller_load_profile() const
+{
+  std::lock_guard<std::recursive_mutex> guard(rt_controllers_wrapper_.controllers_lock_);
+  return controller_load_profile_;
+}
+
 controller_interface::ControllerInterfaceBaseSharedPtr ControllerManager::add_controller_impl(
   const ControllerSpec & controller)
 {
@@ -2073,11 +2623,14 @@ controller_interface::ControllerInterfaceBaseSharedPtr ControllerManager::add_co
     controller_interface::ControllerInterfaceParams controller_params;
     controller_params.controller_name = controller.info.name;
     controller_params.robot_description = robot_description_;
-    controller_params.update_rate = get_update_rate();
+    controller_params.update_rate = get_rate_domain_update_rate(controller.rate_domain);
     controller_params.node_namespace = get_namespace();
     controller_params.node_options = controller_node_options;
     controller_params.hard_joint_limits = resource_manager_->get_hard_joint_limits();
     controller_params.soft_joint_limits = resource_manager_->get_soft_joint_limits();
+    controller_params.allow_async_demotion =
+      controller.execution_time_budget->limit > 0.0 &&
+      controller.execution_time_budget->policy == BudgetViolationPolicy::ASYNC;
     if (controller.c->init(controller_params) == controller_interface::return_type::ERROR)
     {
       to.clear();
@@ -2136,10 +2689,9 @@ void ControllerManager::deactivate_controllers(
       std::bind(controller_name_compare, std::placeholders::_1, controller_name));
     if (found_it == rt_controller_list.end())
     {
-      RCLCPP_ERROR(
-        get_logger(),
-        "Got request to deactivate controller '%s' but it is not in the realtime controller list",
-        controller_name.c_str());
+      rt_logger_->error(
+        "Got request to deactivate controller '{}' but it is not in the realtime controller list",
+        controller_name);
       continue;
     }
     auto controller = found_it->c;
@@ -2159,23 +2711,22 @@ void ControllerManager::deactivate_controllers(
         }
         if (new_state.id() != lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE)
         {
-          RCLCPP_ERROR(
-            get_logger(), "After deactivating, controller '%s' is in state '%s', expected Inactive",
-            controller_name.c_str(), new_state.label().c_str());
+          rt_logger_->error(
+            "After deactivating, controller '{}' is in state '{}', expected Inactive",
+            controller_name, new_state.label());
         }
       }
       catch (const std::exception & e)
       {
-        RCLCPP_ERROR(
-          get_logger(), "Caught exception of type : %s while deactivating the  controller '%s': %s",
-          typeid(e).name(), controller_name.c_str(), e.what());
+        rt_logger_->error(
+          "Caught exception of type : {} while deactivating the  controller '{}': {}",
+          typeid(e).name(), controller_name, e.what());
         continue;
       }
       catch (...)
       {
-        RCLCPP_ERROR(
-          get_logger(), "Caught unknown exception while deactivating the controller '%s'",
-          controller_name.c_str());
+        rt_logger_->error(
+          "Caught unknown exception while deactivating the controller '{}'", controller_name);
         continue;
       }
     }
@@ -2195,11 +2746,10 @@ void ControllerManager::switch_chained_mode(
       std::bind(controller_name_compare, std::placeholders::_1, controller_name));
     if (found_it == rt_controller_list.end())
     {
-      RCLCPP_FATAL(
-        get_logger(),
-        "Got request to turn %s chained mode for controller '%s', but controller is not in the "
+      rt_logger_->fatal(
+        "Got request to turn {} chained mode for controller '{}', but controller is not in the "
         "realtime controller list. (This should never happen!)",
-        (to_chained_mode ? "ON" : "OFF"), controller_name.c_str());
+        (to_chained_mode ? "ON" : "OFF"), controller_name);
       continue;
     }
     auto controller = found_it->c;
@@ -2207,22 +2757,20 @@ void ControllerManager::switch_chained_mode(
     {
       if (!controller->set_chained_mode(to_chained_mode))
       {
-        RCLCPP_ERROR(
-          get_logger(),
-          "Got request to turn %s chained mode for controller '%s', but controller refused to do "
+        rt_logger_->error(
+          "Got request to turn {} chained mode for controller '{}', but controller refused to do "
           "it! The control will probably not work as expected. Try to restart all controllers. "
           "If "
           "the error persist check controllers' individual configuration.",
-          (to_chained_mode ? "ON" : "OFF"), controller_name.c_str());
+          (to_chained_mode ? "ON" : "OFF"), controller_name);
       }
     }
     else
     {
-      RCLCPP_FATAL(
-        get_logger(),
-        "Got request to turn %s chained mode for controller '%s', but this can not happen if "
-        "controller is in '%s' state. (This should never happen!)",
-        (to_chained_mode ? "ON" : "OFF"), controller_name.c_str(),
+      rt_logger_->fatal(
+        "Got request to turn {} chained mode for controller '{}', but this can not happen if "
+        "controller is in '{}' state. (This should never happen!)",
+        (to_chained_mode ? "ON" : "OFF"), controller_name,
         hardware_interface::lifecycle_state_names::ACTIVE);
     }
   }
@@ -2241,10 +2789,9 @@ void ControllerManager::activate_controllers(
       std::bind(controller_name_compare, std::placeholders::_1, controller_name));
     if (found_it == rt_controller_list.end())
     {
-      RCLCPP_ERROR(
-        get_logger(),
-        "Got request to activate controller '%s' but it is not in the realtime controller list",
-        controller_name.c_str());
+      rt_logger_->error(
+        "Got request to activate controller '{}' but it is not in the realtime controller list",
+        controller_name);
       continue;
     }
     auto controller = found_it->c;
@@ -2273,10 +2820,9 @@ void ControllerManager::activate_controllers(
     {
       if (resource_manager_->command_interface_is_claimed(command_interface))
       {
-        RCLCPP_ERROR(
-          get_logger(),
-          "Resource conflict for controller '%s'. Command interface '%s' is already claimed.",
-          controller_name.c_str(), command_interface.c_str());
+        rt_logger_->error(
+          "Resource conflict for controller '{}'. Command interface '{}' is already claimed.",
+          controller_name, command_interface);
         command_loans.clear();
         assignment_successful = false;
         break;
@@ -2287,11 +2833,10 @@ void ControllerManager::activate_controllers(
       }
       catch (const std::exception & e)
       {
-        RCLCPP_ERROR(
-          get_logger(),
-          "Caught exception of type : %s while claiming the command interfaces. Can't activate "
-          "controller '%s': %s",
-          typeid(e).name(), controller_name.c_str(), e.what());
+        rt_logger_->error(
+          "Caught exception of type : {} while claiming the command interfaces. Can't activate "
+          "controller '{}': {}",
+          typeid(e).name(), controller_name, e.what());
         command_loans.clear();
         assignment_successful = false;
         break;
@@ -2327,11 +2872,10 @@ void ControllerManager::activate_controllers(
       }
       catch (const std::exception & e)
       {
-        RCLCPP_ERROR(
-          get_logger(),
-          "Caught exception of type : %s while claiming the state interfaces. Can't activate "
-          "controller '%s': %s",
-          typeid(e).name(), controller_name.c_str(), e.what());
+        rt_logger_->error(
+          "Caught exception of type : {} while claiming the state interfaces. Can't activate "
+          "controller '{}': {}",
+          typeid(e).name(), controller_name, e.what());
         assignment_successful = false;
         break;
       }
@@ -2353,23 +2897,21 @@ void ControllerManager::activate_controllers(
     }
     catch (const std::exception & e)
     {
-      RCLCPP_ERROR(
-        get_logger(), "Caught exception of type : %s while activating the controller '%s': %s",
-        typeid(e).name(), controller_name.c_str(), e.what());
+      rt_logger_->error(
+        "Caught exception of type : {} while activating the controller '{}': {}",
+        typeid(e).name(), controller_name, e.what());
     }
     catch (...)
     {
-      RCLCPP_ERROR(
-        get_logger(), "Caught unknown exception while activating the controller '%s'",
-        controller_name.c_str());
+      rt_logger_->error(
+        "Caught unknown exception while activating the controller '{}'", controller_name);
     }
     if (new_state.id() != lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
     {
-      RCLCPP_ERROR(
-        get_logger(),
-        "After activation, controller '%s' is in state '%s' (%d), expected '%s' (%d). Releasing "
+      rt_logger_->error(
+        "After activation, controller '{}' is in state '{}' ({}), expected '{}' ({}). Releasing "
         "interfaces!",
-        controller->get_node()->get_name(), new_state.label().c_str(), new_state.id(),
+        controller->get_node()->get_name(), new_state.label(), new_state.id(),
         hardware_interface::lifecycle_state_names::ACTIVE,
         lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
       is_successful = false;
@@ -2395,33 +2937,34 @@ void ControllerManager::activate_controllers(
   if (
     !is_successful && strictness == controller_manager_msgs::srv::SwitchController::Request::STRICT)
   {
-    RCLCPP_ERROR(
-      get_logger(),
+    rt_logger_->error(
       "At least one controller failed to be activated. Releasing all interfaces and stopping all "
       "activated controllers because the switch strictness is set to STRICT.");
     // deactivate all controllers that were activated in this switch
     deactivate_controllers(rt_controller_list, controllers_to_activate);
+    uint64_t rollback_switch_id = 0;
     if (
       !resource_manager_->prepare_command_mode_switch(
-        {}, switch_params_.activate_command_interface_request) ||
+        {}, switch_params_.activate_command_interface_request, rollback_switch_id) ||
       !resource_manager_->perform_command_mode_switch(
-        {}, switch_params_.activate_command_interface_request))
+        {}, switch_params_.activate_command_interface_request, rollback_switch_id))
     {
-      RCLCPP_ERROR(
-        get_logger(),
+      rt_logger_->error(
         "Error switching back the interfaces in the hardware when the controller activation "
         "failed.");
     }
   }
   // Now prepare and perform the stop interface switching as this is needed for exclusive
   // interfaces
+  uint64_t switch_id = 0;
   if (
     !failed_controllers_command_interfaces.empty() &&
-    (!resource_manager_->prepare_command_mode_switch({}, failed_controllers_command_interfaces) ||
-     !resource_manager_->perform_command_mode_switch({}, failed_controllers_command_interfaces)))
+    (!resource_manager_->prepare_command_mode_switch(
+       {}, failed_controllers_command_interfaces, switch_id) ||
+     !resource_manager_->perform_command_mode_switch(
+       {}, failed_controllers_command_interfaces, switch_id)))
   {
-    RCLCPP_ERROR(
-      get_logger(),
+    rt_logger_->error(
       "Error switching back the interfaces in the hardware when the controller activation "
       "failed.");
   }
@@ -2886,42 +3429,82 @@ void ControllerManager::read(const rclcpp::Time & time, const rclcpp::Duration &
       rt_buffer_.deactivate_controllers_list.insert(
         rt_buffer_.deactivate_controllers_list.end(), controllers.begin(), controllers.end());
     }
-    RCLCPP_ERROR(
-      get_logger(),
-      "Deactivating following hardware components as their read cycle resulted in an error: [ %s]",
-      rt_buffer_.get_concatenated_string(failed_hardware_names).c_str());
-    RCLCPP_ERROR_EXPRESSION(
-      get_logger(), !rt_buffer_.deactivate_controllers_list.empty(),
-      "Deactivating following controllers as their hardware components read cycle resulted in an "
-      "error: [ %s]",
-      rt_buffer_.get_concatenated_string(rt_buffer_.deactivate_controllers_list).c_str());
+    rt_logger_->error(
+      "Deactivating following hardware components as their read cycle resulted in an error: [ {}]",
+      rt_buffer_.get_concatenated_string(failed_hardware_names));
+    if (!rt_buffer_.deactivate_controllers_list.empty())
+    {
+      rt_logger_->error(
+        "Deactivating following controllers as their hardware components read cycle resulted in an "
+        "error: [ {}]",
+        rt_buffer_.get_concatenated_string(rt_buffer_.deactivate_controllers_list));
+    }
     std::vector<ControllerSpec> & rt_controller_list =
       rt_controllers_wrapper_.update_and_get_used_by_rt_list();
-    perform_hardware_command_mode_change(
-      rt_controller_list, {}, rt_buffer_.deactivate_controllers_list, "read");
-    deactivate_controllers(rt_controller_list, rt_buffer_.deactivate_controllers_list);
+    deactivate_controllers_of_failed_hardware(rt_controller_list, "read");
     // TODO(destogl): do auto-start of broadcasters
   }
+  const auto & stale_hardware_names = resource_manager_->get_stale_hardware_names();
+  if (
+    !stale_hardware_names.empty() &&
+    hardware_interface::RealtimeLogger::throttle(
+      last_stale_state_warning_time_, std::chrono::milliseconds(1000)))
+  {
+    rt_logger_->warn(
+      "The state interfaces of the following hardware components were not updated for at least {} "
+      "read cycles: [ {}]",
+      params_->hardware_components_stale_state_read_cycles,
+      rt_buffer_.get_concatenated_string(stale_hardware_names));
+  }
   execution_time_.read_time =
     std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
       .count();
 }
 
-void ControllerManager::manage_switch()
+void ControllerManager::deactivate_controllers_of_failed_hardware(
+  const std::vector<ControllerSpec> & rt_controller_list, const std::string & rt_cycle_name)
 {
-  std::unique_lock<std::mutex> guard(switch_params_.mutex, std::try_to_lock);
-  if (!guard.owns_lock())
+  // the rate domains must not update the controllers while they are deactivated
+  RateDomainsLock rate_domains_lock(*this);
+  if (!rate_domains_lock.owns_lock())
+  {
+    rt_logger_->debug("Unable to lock the rate domains. Deactivating controllers in next update.");
+    request_controllers_deactivation(rt_controller_list, rt_buffer_.deactivate_controllers_list);
+    return;
+  }
+  perform_hardware_command_mode_change(
+    rt_controller_list, {}, rt_buffer_.deactivate_controllers_list, rt_cycle_name);
+  deactivate_controllers(rt_controller_list, rt_buffer_.deactivate_controllers_list);
+}
+
+void ControllerManager::manage_switch(bool blocking)
+{
+  std::unique_lock<std::mutex> guard(switch_params_.mutex, std::defer_lock);
+  if (blocking)
+  {
+    guard.lock();
+  }
+  else if (!guard.try_lock())
   {
-    RCLCPP_DEBUG(get_logger(), "Unable to lock switch mutex. Retrying in next cycle.");
+    rt_logger_->debug("Unable to lock switch mutex. Retrying in next cycle.");
+    return;
+  }
+  // the rate domains must not update the controllers while they are switched, the non-realtime
+  // switch has no next cycle to retry in and waits for them to finish their current cycle
+  RateDomainsLock rate_domains_lock(*this, blocking);
+  if (!rate_domains_lock.owns_lock())
+  {
+    rt_logger_->debug("Unable to lock the rate domains. Retrying in next cycle.");
     return;
   }
   const auto start_time = std::chrono::steady_clock::now();
   // Ask hardware interfaces to change mode
   if (!resource_manager_->perform_command_mode_switch(
         switch_params_.activate_command_interface_request,
-        switch_params_.deactivate_command_interface_request))
+        switch_params_.deactivate_command_interface_request,
+        switch_params_.command_mode_switch_id))
   {
-    RCLCPP_ERROR(get_logger(), "Error while performing mode switch.");
+    rt_logger_->error("Error while performing mode switch.");
   }
   execution_time_.switch_perform_mode_time =
     std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
@@ -2939,14 +3522,20 @@ void ControllerManager::manage_switch()
   const auto chain_start_time = std::chrono::steady_clock::now();
   switch_chained_mode(switch_params_.to_chained_mode_request, true);
   switch_chained_mode(switch_params_.from_chained_mode_request, false);
-  RCLCPP_DEBUG(
-    get_logger(),
-    "Switching  %lu controllers to chained mode and %lu controllers from chained mode",
+  rt_logger_->debug(
+    "Switching  {} controllers to chained mode and {} controllers from chained mode",
     switch_params_.to_chained_mode_request.size(), switch_params_.from_chained_mode_request.size());
   execution_time_.switch_chained_mode_time =
     std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - chain_start_time)
       .count();
 
+  // the schedules are applied before the activation, so that the activated controllers are
+  // updated in their first scheduled tick
+  for (const auto & [schedule, value] : switch_params_.update_schedule_request)
+  {
+    *schedule = value;
+  }
+
   // activate controllers once the switch is fully complete
   const auto act_start_time = std::chrono::steady_clock::now();
   activate_controllers(
@@ -2978,6 +3567,7 @@ controller_interface::return_type ControllerManager::update(
   auto ret = controller_interface::return_type::OK;
   ++update_loop_counter_;
   update_loop_counter_ %= update_rate_;
+  const uint64_t update_tick = update_tick_++;
 
   // Check for valid time
   if (!get_clock()->started())
@@ -2991,117 +3581,58 @@ controller_interface::return_type ControllerManager::update(
     }
 
     // this can happen with use_sim_time=true until the /clock is received
-    rclcpp::Clock clock = rclcpp::Clock();
-    RCLCPP_WARN_THROTTLE(
-      get_logger(), clock, 1000,
-      "No clock received, using time argument instead! Check your node's clock "
-      "configuration (use_sim_time parameter) and if a valid clock source is available");
+    if (hardware_interface::RealtimeLogger::throttle(
+          last_no_clock_warning_time_, std::chrono::milliseconds(1000)))
+    {
+      rt_logger_->warn(
+        "No clock received, using time argument instead! Check your node's clock "
+        "configuration (use_sim_time parameter) and if a valid clock source is available");
+    }
   }
 
   rt_buffer_.deactivate_controllers_list.clear();
   for (const auto & loaded_controller : rt_controller_list)
   {
+    // requested by the rate domains, or postponed while a rate domain was in its cycle
+    if (loaded_controller.deactivation_requested->exchange(false))
+    {
+      rt_buffer_.deactivate_controllers_list.push_back(loaded_controller.info.name);
+      continue;
+    }
+    if (loaded_controller.rate_domain != 0)
+    {
+      // updated by the loop of its rate domain
+      continue;
+    }
     if (
       switch_params_.do_switch && !switch_params_.activate_asap &&
       switch_params_.skip_cycle(loaded_controller))
     {
-      RCLCPP_DEBUG(
-        get_logger(), "Skipping update for controller '%s' as it is being switched",
-        loaded_controller.info.name.c_str());
+      rt_logger_->debug(
+        "Skipping update for controller '{}' as it is being switched", loaded_controller.info.name);
       continue;
     }
     // TODO(v-lopez) we could cache this information
     // https://github.com/ros-controls/ros2_control/issues/153
     if (is_controller_active(*loaded_controller.c))
     {
-      if (
-        switch_params_.do_switch && loaded_controller.c->is_async() &&
-        std::find(
-          switch_params_.deactivate_request.begin(), switch_params_.deactivate_request.end(),
-          loaded_controller.info.name) != switch_params_.deactivate_request.end())
-      {
-        RCLCPP_DEBUG(
-          get_logger(), "Skipping update for async controller '%s' as it is being deactivated",
-          loaded_controller.info.name.c_str());
-        continue;
-      }
-      const auto controller_update_rate = loaded_controller.c->get_update_rate();
-      const bool run_controller_at_cm_rate = (controller_update_rate >= update_rate_);
-      const auto controller_period =
-        run_controller_at_cm_rate ? period
-                                  : rclcpp::Duration::from_seconds((1.0 / controller_update_rate));
-
-      const bool first_update_cycle =
-        (*loaded_controller.last_update_cycle_time ==
-         rclcpp::Time(0, 0, this->get_trigger_clock()->get_clock_type()));
-      const rclcpp::Time current_time = get_clock()->started() ? get_trigger_clock()->now() : time;
-      const auto controller_actual_period =
-        first_update_cycle ? controller_period
-                           : (current_time - *loaded_controller.last_update_cycle_time);
-
-      const double error_now =
-        std::abs((controller_actual_period.seconds() * controller_update_rate) - 1.0);
-      const double error_if_skipped = std::abs(
-        ((controller_actual_period.seconds() + (1.0 / static_cast<double>(update_rate_))) *
-         controller_update_rate) -
-        1.0);
-      const bool controller_go =
-        run_controller_at_cm_rate ||
-        (time == rclcpp::Time(0, 0, this->get_trigger_clock()->get_clock_type())) ||
-        (error_now <= error_if_skipped) || first_update_cycle;
-
-      RCLCPP_DEBUG(
-        get_logger(), "update_loop_counter: '%d ' controller_go: '%s ' controller_name: '%s '",
-        update_loop_counter_, controller_go ? "True" : "False",
-        loaded_controller.info.name.c_str());
-
-      if (controller_go)
+      rt_logger_->debug(
+        "update_loop_counter: '{} ' controller_name: '{} '", update_loop_counter_,
+        loaded_controller.info.name);
+      if (update_controller(loaded_controller, time, period, update_rate_, update_tick, ret))
       {
-        auto controller_ret = controller_interface::return_type::OK;
-        bool trigger_status = true;
-        // Catch exceptions thrown by the controller update function
-        try
-        {
-          const auto trigger_result =
-            loaded_controller.c->trigger_update(this->now(), controller_actual_period);
-          trigger_status = trigger_result.successful;
-          controller_ret = trigger_result.result;
-          if (trigger_status && trigger_result.execution_time.has_value())
-          {
-            loaded_controller.execution_time_statistics->add_measurement(
-              static_cast<double>(trigger_result.execution_time.value().count()) / 1.e3);
-          }
-          if (!first_update_cycle && trigger_status && trigger_result.period.has_value())
-          {
-            loaded_controller.periodicity_statistics->add_measurement(
-              1.0 / trigger_result.period.value().seconds());
-          }
-        }
-        catch (const std::exception & e)
-        {
-          RCLCPP_ERROR(
-            get_logger(), "Caught exception of type : %s while updating controller '%s': %s",
-            typeid(e).name(), loaded_controller.info.name.c_str(), e.what());
-          controller_ret = controller_interface::return_type::ERROR;
-        }
-        catch (...)
-        {
-          RCLCPP_ERROR(
-            get_logger(), "Caught unknown exception while updating controller '%s'",
-            loaded_controller.info.name.c_str());
-          controller_ret = controller_interface::return_type::ERROR;
-        }
-
-        *loaded_controller.last_update_cycle_time = current_time;
-
-        if (controller_ret != controller_interface::return_type::OK)
-        {
-          rt_buffer_.deactivate_controllers_list.push_back(loaded_controller.info.name);
-          ret = controller_ret;
-        }
+        rt_buffer_.deactivate_controllers_list.push_back(loaded_controller.info.name);
       }
     }
   }
+  // the rate domains must not update the controllers while they are (de)activated
+  RateDomainsLock rate_domains_lock(*this);
+  if (!rt_buffer_.deactivate_controllers_list.empty() && !rate_domains_lock.owns_lock())
+  {
+    rt_logger_->debug("Unable to lock the rate domains. Deactivating controllers in next cycle.");
+    request_controllers_deactivation(rt_controller_list, rt_buffer_.deactivate_controllers_list);
+    rt_buffer_.deactivate_controllers_list.clear();
+  }
   if (!rt_buffer_.deactivate_controllers_list.empty())
   {
     rt_buffer_.fallback_controllers_list.clear();
@@ -3124,19 +3655,22 @@ controller_interface::return_type ControllerManager::update(
       }
     }
 
-    RCLCPP_ERROR(
-      get_logger(), "Deactivating controllers : [ %s] as their update resulted in an error!",
-      rt_buffer_.get_concatenated_string(rt_buffer_.deactivate_controllers_list).c_str());
-    RCLCPP_ERROR_EXPRESSION(
-      get_logger(), !rt_buffer_.activate_controllers_using_interfaces_list.empty(),
-      "Deactivating controllers : [ %s] using the command interfaces needed for the fallback "
-      "controllers to activate.",
-      rt_buffer_.get_concatenated_string(rt_buffer_.activate_controllers_using_interfaces_list)
-        .c_str());
-    RCLCPP_ERROR_EXPRESSION(
-      get_logger(), !rt_buffer_.fallback_controllers_list.empty(),
-      "Activating fallback controllers : [ %s]",
-      rt_buffer_.get_concatenated_string(rt_buffer_.fallback_controllers_list).c_str());
+    rt_logger_->error(
+      "Deactivating controllers : [ {}] as their update resulted in an error!",
+      rt_buffer_.get_concatenated_string(rt_buffer_.deactivate_controllers_list));
+    if (!rt_buffer_.activate_controllers_using_interfaces_list.empty())
+    {
+      rt_logger_->error(
+        "Deactivating controllers : [ {}] using the command interfaces needed for the fallback "
+        "controllers to activate.",
+        rt_buffer_.get_concatenated_string(rt_buffer_.activate_controllers_using_interfaces_list));
+    }
+    if (!rt_buffer_.fallback_controllers_list.empty())
+    {
+      rt_logger_->error(
+        "Activating fallback controllers : [ {}]",
+        rt_buffer_.get_concatenated_string(rt_buffer_.fallback_controllers_list));
+    }
     std::for_each(
       rt_buffer_.activate_controllers_using_interfaces_list.begin(),
       rt_buffer_.activate_controllers_using_interfaces_list.end(),
@@ -3157,6 +3691,7 @@ controller_interface::return_type ControllerManager::update(
     // To publish the activity of the failing controllers and the fallback controllers
     publish_activity();
   }
+  rate_domains_lock.unlock();
   resource_manager_->enforce_command_limits(period);
 
   // there are controllers to (de)activate
@@ -3175,6 +3710,127 @@ controller_interface::return_type ControllerManager::update(
   return ret;
 }
 
+bool ControllerManager::update_controller(
+  const ControllerSpec & controller, const rclcpp::Time & time, const rclcpp::Duration & period,
+  unsigned int update_rate, uint64_t update_tick, controller_interface::return_type & ret)
+{
+  if (
+    switch_params_.do_switch && controller.c->is_async() &&
+    ros2_control::has_item(switch_params_.deactivate_request, controller.info.name))
+  {
+    rt_logger_->debug(
+      "Skipping update for async controller '{}' as it is being deactivated", controller.info.name);
+    return false;
+  }
+  const auto controller_update_rate = controller.c->get_update_rate();
+  const bool run_controller_at_cm_rate = (controller_update_rate >= update_rate);
+  const auto controller_period =
+    run_controller_at_cm_rate ? period
+                              : rclcpp::Duration::from_seconds((1.0 / controller_update_rate));
+
+  const bool first_update_cycle =
+    (*controller.last_update_cycle_time ==
+     rclcpp::Time(0, 0, this->get_trigger_clock()->get_clock_type()));
+  const rclcpp::Time current_time = get_clock()->started() ? get_trigger_clock()->now() : time;
+  const auto controller_actual_period =
+    first_update_cycle ? controller_period : (current_time - *controller.last_update_cycle_time);
+
+  const double error_now =
+    std::abs((controller_actual_period.seconds() * controller_update_rate) - 1.0);
+  const double error_if_skipped = std::abs(
+    ((controller_actual_period.seconds() + (1.0 / static_cast<double>(update_rate))) *
+     controller_update_rate) -
+    1.0);
+  bool controller_go = false;
+  if (params_->tick_scheduling)
+  {
+    auto & schedule = *controller.update_schedule;
+    if (!schedule.is_scheduled())
+    {
+      // not scheduled by a switch, e.g., a fallback controller, so it starts in this tick
+      schedule.divisor = hardware_interface::to_tick_divisor(update_rate, controller_update_rate);
+      schedule.phase = static_cast<unsigned int>(update_tick % schedule.divisor);
+    }
+    controller_go = run_controller_at_cm_rate || schedule.is_due(update_tick);
+  }
+  else
+  {
+    controller_go =
+      run_controller_at_cm_rate ||
+      (time == rclcpp::Time(0, 0, this->get_trigger_clock()->get_clock_type())) ||
+      (error_now <= error_if_skipped) || first_update_cycle;
+  }
+  // only the main control loop sheds the updates of its controllers
+  if (
+    controller_go && controller.rate_domain == 0 && load_shedding_.level > 0 &&
+    is_update_shed(controller, update_tick))
+  {
+    ++load_shedding_.shed_updates;
+    controller_go = false;
+  }
+  // event-triggered controllers are only updated once their state interfaces got a new sample
+  if (controller_go && controller.c->is_state_triggered() && !controller.c->has_new_state_samples())
+  {
+    controller_go = false;
+  }
+
+  rt_logger_->debug(
+    "update_tick: '{} ' controller_go: '{} ' controller_name: '{} '", update_tick,
+    controller_go ? "True" : "False", controller.info.name);
+
+  if (!controller_go)
+  {
+    return false;
+  }
+
+  auto controller_ret = controller_interface::return_type::OK;
+  bool trigger_status = true;
+  const bool is_async = controller.c->is_async();
+  bool budget_exceeded = false;
+  // Catch exceptions thrown by the controller update function
+  try
+  {
+    const auto trigger_result = controller.c->trigger_update(this->now(), controller_actual_period);
+    trigger_status = trigger_result.successful;
+    controller_ret = trigger_result.result;
+    if (trigger_status && trigger_result.execution_time.has_value())
+    {
+      const double execution_time =
+        static_cast<double>(trigger_result.execution_time.value().count()) / 1.e3;
+      controller.execution_time_statistics->add_measurement(execution_time);
+      // async controllers don't delay the control loop, so their budget is not enforced
+      budget_exceeded = !is_async && enforce_execution_time_budget(controller, execution_time);
+    }
+    if (!first_update_cycle && trigger_status && trigger_result.period.has_value())
+    {
+      controller.periodicity_statistics->add_measurement(
+        1.0 / trigger_result.period.value().seconds());
+    }
+  }
+  catch (const std::exception & e)
+  {
+    rt_logger_->error(
+      "Caught exception of type : {} while updating controller '{}': {}", typeid(e).name(),
+      controller.info.name, e.what());
+    controller_ret = controller_interface::return_type::ERROR;
+  }
+  catch (...)
+  {
+    rt_logger_->error(
+      "Caught unknown exception while updating controller '{}'", controller.info.name);
+    controller_ret = controller_interface::return_type::ERROR;
+  }
+
+  *controller.last_update_cycle_time = current_time;
+
+  if (controller_ret != controller_interface::return_type::OK)
+  {
+    ret = controller_ret;
+    return true;
+  }
+  return budget_exceeded;
+}
+
 void ControllerManager::write(const rclcpp::Time & time, const rclcpp::Duration & period)
 {
   const auto start_time = std::chrono::steady_clock::now();
@@ -3190,22 +3846,20 @@ void ControllerManager::write(const rclcpp::Time & time, const rclcpp::Duration
       rt_buffer_.deactivate_controllers_list.insert(
         rt_buffer_.deactivate_controllers_list.end(), controllers.begin(), controllers.end());
     }
-    RCLCPP_ERROR(
-      get_logger(),
-      "Deactivating following hardware components as their write cycle resulted in an error: [ "
-      "%s]",
-      rt_buffer_.get_concatenated_string(failed_hardware_names).c_str());
-    RCLCPP_ERROR_EXPRESSION(
-      get_logger(), !rt_buffer_.deactivate_controllers_list.empty(),
-      "Deactivating following controllers as their hardware components write cycle resulted in an "
-      "error: [ %s]",
-      rt_buffer_.get_concatenated_string(rt_buffer_.deactivate_controllers_list).c_str());
+    rt_logger_->error(
+      "Deactivating following hardware components as their write cycle resulted in an error: "
+      "[ {}]",
+      rt_buffer_.get_concatenated_string(failed_hardware_names));
+    if (!rt_buffer_.deactivate_controllers_list.empty())
+    {
+      rt_logger_->error(
+        "Deactivating following controllers as their hardware components write cycle resulted in "
+        "an error: [ {}]",
+        rt_buffer_.get_concatenated_string(rt_buffer_.deactivate_controllers_list));
+    }
     std::vector<ControllerSpec> & rt_controller_list =
       rt_controllers_wrapper_.update_and_get_used_by_rt_list();
-
-    perform_hardware_command_mode_change(
-      rt_controller_list, {}, rt_buffer_.deactivate_controllers_list, "write");
-    deactivate_controllers(rt_controller_list, rt_buffer_.deactivate_controllers_list);
+    deactivate_controllers_of_failed_hardware(rt_controller_list, "write");
     // TODO(destogl): do auto-start of broadcasters
   }
   else if (result == hardware_interface::return_type::DEACTIVATE)
@@ -3224,11 +3878,10 @@ void ControllerManager::write(const rclcpp::Time & time, const rclcpp::Duration
           { return spec.c->get_name() == controller; });
         if (controller_spec == loaded_controllers.end())
         {
-          RCLCPP_WARN(
-            get_logger(),
-            "Deactivate failed to find controller [%s] in loaded controllers. "
-            "This can happen due to multiple returns of 'DEACTIVATE' from [%s] write()",
-            controller.c_str(), hardware_name.c_str());
+          rt_logger_->warn(
+            "Deactivate failed to find controller [{}] in loaded controllers. "
+            "This can happen due to multiple returns of 'DEACTIVATE' from [{}] write()",
+            controller, hardware_name);
           continue;
         }
         std::vector<std::string> command_interface_names;
@@ -3241,51 +3894,574 @@ void ControllerManager::write(const rclcpp::Time & time, const rclcpp::Duration
         }
       }
     }
-    RCLCPP_ERROR_EXPRESSION(
-      get_logger(), !rt_buffer_.deactivate_controllers_list.empty(),
-      "Deactivating controllers [%s] as their command interfaces are tied to DEACTIVATEing "
-      "hardware components",
-      rt_buffer_.get_concatenated_string(rt_buffer_.deactivate_controllers_list).c_str());
+    if (!rt_buffer_.deactivate_controllers_list.empty())
+    {
+      rt_logger_->error(
+        "Deactivating controllers [{}] as their command interfaces are tied to DEACTIVATEing "
+        "hardware components",
+        rt_buffer_.get_concatenated_string(rt_buffer_.deactivate_controllers_list));
+    }
     std::vector<ControllerSpec> & rt_controller_list =
       rt_controllers_wrapper_.update_and_get_used_by_rt_list();
-
-    perform_hardware_command_mode_change(
-      rt_controller_list, {}, rt_buffer_.deactivate_controllers_list, "write");
-    deactivate_controllers(rt_controller_list, rt_buffer_.deactivate_controllers_list);
+    deactivate_controllers_of_failed_hardware(rt_controller_list, "write");
   }
   execution_time_.write_time =
     std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
       .count();
   execution_time_.total_time =
     execution_time_.write_time + execution_time_.update_time + execution_time_.read_time;
+  deadline_misses_.runtime_overruns = deadline_overrun_counter_.get_count();
   const double expected_cycle_time = 1.e6 / static_cast<double>(get_update_rate());
+  update_load_shedding(execution_time_.total_time, expected_cycle_time);
   if (params_->overruns.print_warnings && execution_time_.total_time > expected_cycle_time)
   {
-    if (execution_time_.switch_time > 0.0)
-    {
-      RCLCPP_WARN_THROTTLE(
-        get_logger(), *get_clock(), 1000,
-        "Overrun might occur, Total time : %.3f us (Expected < %.3f us) --> Read time : %.3f us, "
-        "Update time : %.3f us (Switch time : %.3f us (Switch chained mode time : %.3f us, perform "
-        "mode change time : %.3f us, Activation time : %.3f us, Deactivation time : %.3f us)), "
-        "Write "
-        "time : %.3f us",
-        execution_time_.total_time, expected_cycle_time, execution_time_.read_time,
-        execution_time_.update_time, execution_time_.switch_time,
-        execution_time_.switch_chained_mode_time, execution_time_.switch_perform_mode_time,
-        execution_time_.activation_time, execution_time_.deactivation_time,
-        execution_time_.write_time);
+    if (hardware_interface::RealtimeLogger::throttle(
+          last_overrun_warning_time_, std::chrono::milliseconds(1000)))
+    {
+      if (execution_time_.switch_time > 0.0)
+      {
+        rt_logger_->warn(
+          "Overrun might occur, Total time : {:.3f} us (Expected < {:.3f} us) --> Read time : "
+          "{:.3f} us, Update time : {:.3f} us (Switch time : {:.3f} us (Switch chained mode time "
+          ": {:.3f} us, perform mode change time : {:.3f} us, Activation time : {:.3f} us, "
+          "Deactivation time : {:.3f} us)), Write time : {:.3f} us",
+          execution_time_.total_time, expected_cycle_time, execution_time_.read_time,
+          execution_time_.update_time, execution_time_.switch_time,
+          execution_time_.switch_chained_mode_time, execution_time_.switch_perform_mode_time,
+          execution_time_.activation_time, execution_time_.deactivation_time,
+          execution_time_.write_time);
+      }
+      else
+      {
+        rt_logger_->warn(
+          "Overrun might occur, Total time : {:.3f} us (Expected < {:.3f} us) --> Read time : "
+          "{:.3f} us, Update time : {:.3f} us, Write time : {:.3f} us",
+          execution_time_.total_time, expected_cycle_time, execution_time_.read_time,
+          execution_time_.update_time, execution_time_.write_time);
+      }
+    }
+  }
+}
+
+controller_interface::return_type ControllerManager::update_rate_domain(
+  unsigned int rate_domain, const rclcpp::Time & time, const rclcpp::Duration & period)
+{
+  if (rate_domain == 0 || rate_domain > rate_domain_cycles_.size())
+  {
+    rt_logger_->error("The rate domain {} doesn't exist.", rate_domain);
+    return controller_interface::return_type::ERROR;
+  }
+  if (!is_resource_manager_initialized())
+  {
+    // waiting for the robot description
+    return controller_interface::return_type::OK;
+  }
+  auto & cycles = *rate_domain_cycles_[rate_domain - 1];
+  std::unique_lock<std::mutex> guard(cycles.mutex, std::try_to_lock);
+  if (!guard.owns_lock())
+  {
+    // the main control loop is (de)activating controllers
+    ++cycles.skipped_cycles;
+    return controller_interface::return_type::OK;
+  }
+  const auto start_time = std::chrono::steady_clock::now();
+  const unsigned int update_rate = rate_domains_[rate_domain - 1].update_rate;
+  const uint64_t update_tick = cycles.update_tick++;
+  auto & rt_buffer = cycles.rt_buffer;
+  std::vector<ControllerSpec> & rt_controller_list =
+    rt_controllers_wrapper_.update_and_get_used_by_rt_list(rate_domain);
+
+  // the failing controllers are deactivated by the main control loop, as their deactivation can
+  // affect controllers of other rate domains
+  auto [read_result, failed_read_hardware_names] =
+    resource_manager_->read(time, period, rate_domain);
+  if (read_result != hardware_interface::return_type::OK)
+  {
+    rt_buffer.deactivate_controllers_list.clear();
+    for (const auto & hardware_name : failed_read_hardware_names)
+    {
+      auto controllers = resource_manager_->get_cached_controllers_to_hardware(hardware_name);
+      rt_buffer.deactivate_controllers_list.insert(
+        rt_buffer.deactivate_controllers_list.end(), controllers.begin(), controllers.end());
+    }
+    rt_logger_->error(
+      "Deactivating following hardware components of the rate domain '{}' as their read cycle "
+      "resulted in an error: [ {}]",
+      rate_domains_[rate_domain - 1].name,
+      rt_buffer.get_concatenated_string(failed_read_hardware_names));
+    request_controllers_deactivation(rt_controller_list, rt_buffer.deactivate_controllers_list);
+  }
+  const auto & stale_hardware_names = resource_manager_->get_stale_hardware_names(rate_domain);
+  if (
+    !stale_hardware_names.empty() &&
+    hardware_interface::RealtimeLogger::throttle(
+      cycles.last_stale_state_warning_time, std::chrono::milliseconds(1000)))
+  {
+    rt_logger_->warn(
+      "The state interfaces of the following hardware components were not updated for at least {} "
+      "read cycles: [ {}]",
+      params_->hardware_components_stale_state_read_cycles,
+      rt_buffer.get_concatenated_string(stale_hardware_names));
+  }
+
+  auto ret = controller_interface::return_type::OK;
+  for (const auto & loaded_controller : rt_controller_list)
+  {
+    if (
+      loaded_controller.rate_domain != rate_domain || !is_controller_active(*loaded_controller.c) ||
+      loaded_controller.deactivation_requested->load())
+    {
+      continue;
+    }
+    if (update_controller(loaded_controller, time, period, update_rate, update_tick, ret))
+    {
+      loaded_controller.deactivation_requested->store(true);
+    }
+  }
+
+  resource_manager_->enforce_command_limits(period, rate_domain);
+
+  auto [write_result, failed_write_hardware_names] =
+    resource_manager_->write(time, period, rate_domain);
+  if (write_result != hardware_interface::return_type::OK)
+  {
+    rt_buffer.deactivate_controllers_list.clear();
+    for (const auto & hardware_name : failed_write_hardware_names)
+    {
+      for (const auto & controller :
+           resource_manager_->get_cached_controllers_to_hardware(hardware_name))
+      {
+        // only the controllers commanding a DEACTIVATEing hardware component are deactivated
+        auto controller_spec = std::find_if(
+          rt_controller_list.begin(), rt_controller_list.end(),
+          std::bind(controller_name_compare, std::placeholders::_1, controller));
+        if (
+          write_result == hardware_interface::return_type::DEACTIVATE &&
+          (controller_spec == rt_controller_list.end() ||
+           controller_spec->c->command_interface_configuration().names.empty()))
+        {
+          continue;
+        }
+        rt_buffer.deactivate_controllers_list.push_back(controller);
+      }
+    }
+    rt_logger_->error(
+      "Deactivating controllers [ {}] of the hardware components of the rate domain '{}' as their "
+      "write cycle resulted in {}",
+      rt_buffer.get_concatenated_string(rt_buffer.deactivate_controllers_list),
+      rate_domains_[rate_domain - 1].name,
+      write_result == hardware_interface::return_type::ERROR ? "an error" : "a deactivation");
+    request_controllers_deactivation(rt_controller_list, rt_buffer.deactivate_controllers_list);
+  }
+
+  cycles.execution_time =
+    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
+      .count();
+  cycles.deadline_misses.runtime_overruns = cycles.deadline_overrun_counter.get_count();
+  rt_controllers_wrapper_.release_used_by_rt_list(rate_domain);
+  return ret;
+}
+
+uint64_t ControllerManager::get_rate_domain_skipped_cycles(unsigned int rate_domain) const
+{
+  return rate_domain_cycles_.at(rate_domain - 1)->skipped_cycles;
+}
+
+const ControllerManager::DeadlineMisses & ControllerManager::get_deadline_misses(
+  unsigned int rate_domain) const
+{
+  if (rate_domain == 0)
+  {
+    return deadline_misses_;
+  }
+  return rate_domain_cycles_.at(rate_domain - 1)->deadline_misses;
+}
+
+bool ControllerManager::attach_deadline_overrun_counter(unsigned int rate_domain)
+{
+  if (rate_domain > rate_domain_cycles_.size())
+  {
+    return false;
+  }
+  if (rate_domain == 0)
+  {
+    return deadline_overrun_counter_.attach_to_current_thread();
+  }
+  return rate_domain_cycles_[rate_domain - 1]->deadline_overrun_counter.attach_to_current_thread();
+}
+
+void ControllerManager::add_deadline_missed_cycles(unsigned int rate_domain, uint64_t cycles)
+{
+  if (rate_domain == 0)
+  {
+    deadline_misses_.missed_cycles += cycles;
+  }
+  else if (rate_domain <= rate_domain_cycles_.size())
+  {
+    rate_domain_cycles_[rate_domain - 1]->deadline_misses.missed_cycles += cycles;
+  }
+}
+
+std::vector<int> ControllerManager::get_planned_cpu_affinity(unsigned int rate_domain) const
+{
+  std::lock_guard<std::mutex> guard(cpu_placement_mutex_);
+  if (!cpu_placement_ || rate_domain > rate_domains_.size())
+  {
+    return {};
+  }
+  const auto * placement =
+    cpu_placement_->get_placement(get_rate_domain_thread_name(rate_domain));
+  if (!placement || placement->configured)
+  {
+    return {};
+  }
+  return placement->cpus;
+}
+
+std::string ControllerManager::get_cpu_placement_plan() const
+{
+  std::lock_guard<std::mutex> guard(cpu_placement_mutex_);
+  return cpu_placement_ ? cpu_placement_->to_string() : std::string();
+}
+
+void ControllerManager::init_cpu_placement()
+{
+  if (params_->cpu_placement.policy != "topology")
+  {
+    return;
+  }
+  auto topology = CpuTopology::read(params_->cpu_placement.sysfs_path);
+  if (topology.cpus.empty())
+  {
+    RCLCPP_WARN(
+      get_logger(),
+      "Could not read the CPU topology from '%s', the real-time threads are not placed.",
+      params_->cpu_placement.sysfs_path.c_str());
+    return;
+  }
+
+  std::lock_guard<std::mutex> guard(cpu_placement_mutex_);
+  cpu_placement_ = std::make_unique<CpuPlacementPlanner>(std::move(topology));
+  // threads scheduled with SCHED_DEADLINE are not pinned, as the kernel rejects the CPU affinity of
+  // deadline tasks narrower than their root domain
+  const std::string main_thread = get_rate_domain_thread_name(0);
+  rclcpp::Parameter cpu_affinity_param;
+  const auto main_cpus = get_parameter("cpu_affinity", cpu_affinity_param)
+                           ? get_cpus_from_parameter(cpu_affinity_param)
+                           : std::vector<int>();
+  if (!main_cpus.empty())
+  {
+    cpu_placement_->reserve(main_thread, main_cpus);
+  }
+  else if (get_parameter_or<int64_t>("sched_runtime", 0) <= 0)
+  {
+    cpu_placement_->place(main_thread);
+  }
+  // the rate domains exchange the commands and states of their chained controllers with the main
+  // control loop
+  for (unsigned int i = 0; i < rate_domains_.size(); ++i)
+  {
+    const std::string thread = get_rate_domain_thread_name(i + 1);
+    if (rate_domains_[i].deadline_scheduling.is_enabled())
+    {
+      continue;
+    }
+    if (rate_domains_[i].cpu_affinity.empty())
+    {
+      cpu_placement_->place(thread, main_thread);
     }
     else
     {
-      RCLCPP_WARN_THROTTLE(
-        get_logger(), *get_clock(), 1000,
-        "Overrun might occur, Total time : %.3f us (Expected < %.3f us) --> Read time : %.3f us, "
-        "Update time : %.3f us, Write time : %.3f us",
-        execution_time_.total_time, expected_cycle_time, execution_time_.read_time,
-        execution_time_.update_time, execution_time_.write_time);
+      cpu_placement_->reserve(thread, rate_domains_[i].cpu_affinity, main_thread);
+    }
+  }
+  RCLCPP_INFO(
+    get_logger(), "Placement of the real-time threads on the %zu online CPUs:\n%s",
+    cpu_placement_->get_topology().cpus.size(), cpu_placement_->to_string().c_str());
+}
+
+void ControllerManager::place_async_hardware_components()
+{
+  std::lock_guard<std::mutex> guard(cpu_placement_mutex_);
+  if (!cpu_placement_)
+  {
+    return;
+  }
+  const auto & components = resource_manager_->get_components_status();
+  std::vector<std::string> async_components;
+  for (const auto & [component_name, component_info] : components)
+  {
+    if (component_info.is_async && !component_info.async_deadline_scheduling)
+    {
+      async_components.push_back(component_name);
+    }
+  }
+  // placed in a deterministic order
+  std::sort(async_components.begin(), async_components.end());
+
+  for (const auto & component_name : async_components)
+  {
+    // the async thread exchanges the states and commands with the loop reading and writing it
+    unsigned int rate_domain = 0;
+    for (unsigned int i = 0; i < rate_domains_.size(); ++i)
+    {
+      if (ros2_control::has_item(rate_domains_[i].hardware_components, component_name))
+      {
+        rate_domain = i + 1;
+      }
+    }
+    const std::string thread = "hardware/" + component_name;
+    const std::string partner = get_rate_domain_thread_name(rate_domain);
+    const auto & configured_cpus = components.at(component_name).async_cpu_affinity;
+    if (!configured_cpus.empty())
+    {
+      cpu_placement_->reserve(thread, configured_cpus, partner);
+      continue;
+    }
+    const auto cpu = cpu_placement_->place(thread, partner);
+    if (!cpu)
+    {
+      RCLCPP_WARN(
+        get_logger(),
+        "No physical core is free for the async thread of the hardware component '%s', it keeps "
+        "its CPU affinity.",
+        component_name.c_str());
+      continue;
+    }
+    resource_manager_->set_async_component_cpu_affinity(component_name, {*cpu});
+  }
+  RCLCPP_INFO_EXPRESSION(
+    get_logger(), !async_components.empty(),
+    "Placement of the real-time threads with the async hardware components:\n%s",
+    cpu_placement_->to_string().c_str());
+}
+
+void ControllerManager::place_async_controller(const ControllerSpec & controller)
+{
+  std::lock_guard<std::mutex> guard(cpu_placement_mutex_);
+  if (
+    !cpu_placement_ || !controller.c->is_async() ||
+    controller.c->get_node()->get_parameter("async_parameters.sched_runtime").as_int() > 0)
+  {
+    return;
+  }
+  const std::string thread = "controller/" + controller.info.name;
+  const std::string partner = get_rate_domain_thread_name(controller.rate_domain);
+  rclcpp::Parameter cpu_affinity_param;
+  if (controller.c->get_node()->get_parameter("async_parameters.cpu_affinity", cpu_affinity_param))
+  {
+    const auto configured_cpus = get_cpus_from_parameter(cpu_affinity_param);
+    if (!configured_cpus.empty())
+    {
+      cpu_placement_->reserve(thread, configured_cpus, partner);
+      return;
+    }
+  }
+  const auto cpu = cpu_placement_->place(thread, partner);
+  if (!cpu)
+  {
+    RCLCPP_WARN(
+      get_logger(),
+      "No physical core is free for the async thread of the controller '%s', it keeps its CPU "
+      "affinity.",
+      controller.info.name.c_str());
+    return;
+  }
+  controller.c->set_async_thread_cpu_affinity({*cpu});
+  RCLCPP_INFO(
+    get_logger(), "Placed the async thread of the controller '%s' on %s",
+    controller.info.name.c_str(),
+    cpu_placement_->describe(*cpu_placement_->get_placement(thread)).c_str());
+}
+
+std::string ControllerManager::get_rate_domain_thread_name(unsigned int rate_domain) const
+{
+  return rate_domain == 0 ? std::string("main")
+                          : "rate_domain/" + rate_domains_[rate_domain - 1].name;
+}
+
+void ControllerManager::request_controllers_deactivation(
+  const std::vector<ControllerSpec> & rt_controller_list,
+  const std::vector<std::string> & controller_names) const
+{
+  for (const auto & controller : rt_controller_list)
+  {
+    if (ros2_control::has_item(controller_names, controller.info.name))
+    {
+      controller.deactivation_requested->store(true);
+    }
+  }
+}
+
+ControllerManager::RateDomainsLock::RateDomainsLock(ControllerManager & cm, bool blocking)
+: cm_(cm)
+{
+  for (; locked_ < cm_.rate_domain_cycles_.size(); ++locked_)
+  {
+    if (blocking)
+    {
+      cm_.rate_domain_cycles_[locked_]->mutex.lock();
+    }
+    else if (!cm_.rate_domain_cycles_[locked_]->mutex.try_lock())
+    {
+      unlock();
+      return;
     }
   }
+  owns_lock_ = true;
+}
+
+ControllerManager::RateDomainsLock::~RateDomainsLock() { unlock(); }
+
+void ControllerManager::RateDomainsLock::unlock()
+{
+  for (; locked_ > 0; --locked_)
+  {
+    cm_.rate_domain_cycles_[locked_ - 1]->mutex.unlock();
+  }
+  owns_lock_ = false;
+}
+
+void ControllerManager::update_load_shedding(double cycle_time, double expected_cycle_time)
+{
+  const auto & load_shedding_params = params_->overruns.load_shedding;
+  if (!load_shedding_params.enable)
+  {
+    load_shedding_.level = 0;
+    return;
+  }
+  constexpr auto max_level = static_cast<unsigned int>(ControllerPriority::CRITICAL);
+  if (cycle_time > load_shedding_params.threshold * expected_cycle_time)
+  {
+    load_shedding_.headroom_cycles = 0;
+    if (load_shedding_.level < max_level)
+    {
+      ++load_shedding_.level;
+      ++load_shedding_.events;
+      if (hardware_interface::RealtimeLogger::throttle(
+            last_load_shedding_warning_time_, std::chrono::milliseconds(1000)))
+      {
+        rt_logger_->warn(
+          "Total time : {:.3f} us exceeds the load shedding threshold of {:.3f} us, raised the "
+          "load shedding level to {} ({} shedding events, {} shed controller updates)",
+          cycle_time, load_shedding_params.threshold * expected_cycle_time, load_shedding_.level,
+          load_shedding_.events, load_shedding_.shed_updates);
+      }
+    }
+  }
+  else if (
+    load_shedding_.level > 0 &&
+    cycle_time < load_shedding_params.recovery_threshold * expected_cycle_time)
+  {
+    if (
+      ++load_shedding_.headroom_cycles >=
+      static_cast<unsigned int>(load_shedding_params.recovery_cycles))
+    {
+      --load_shedding_.level;
+      load_shedding_.headroom_cycles = 0;
+      rt_logger_->info("Lowered the load shedding level to {}", load_shedding_.level);
+    }
+  }
+  else
+  {
+    load_shedding_.headroom_cycles = 0;
+  }
+}
+
+bool ControllerManager::enforce_execution_time_budget(
+  const ControllerSpec & controller, double execution_time)
+{
+  auto & budget = *controller.execution_time_budget;
+  if (budget.limit <= 0.0 || execution_time <= budget.limit)
+  {
+    budget.consecutive_violations = 0;
+    return false;
+  }
+  ++budget.violations;
+  if (
+    ++budget.consecutive_violations <
+    static_cast<unsigned int>(params_->execution_time_budget.violation_cycles))
+  {
+    return false;
+  }
+  budget.consecutive_violations = 0;
+
+  switch (budget.policy)
+  {
+    case BudgetViolationPolicy::ASYNC:
+      if (controller.c->demote_to_async())
+      {
+        rt_logger_->warn(
+          "Controller '{}' exceeded its execution time budget of {:.3f} us in {} consecutive "
+          "updates, the last one took {:.3f} us. Running it asynchronously until it is "
+          "deactivated.",
+          controller.info.name, budget.limit, params_->execution_time_budget.violation_cycles,
+          execution_time);
+        return false;
+      }
+      rt_logger_->error(
+        "Controller '{}' exceeded its execution time budget of {:.3f} us, but it can't be demoted "
+        "to run asynchronously.",
+        controller.info.name, budget.limit);
+      return false;
+    case BudgetViolationPolicy::FALLBACK:
+      rt_logger_->error(
+        "Controller '{}' exceeded its execution time budget of {:.3f} us in {} consecutive "
+        "updates, the last one took {:.3f} us. Deactivating it and activating its fallback "
+        "controllers.",
+        controller.info.name, budget.limit, params_->execution_time_budget.violation_cycles,
+        execution_time);
+      return true;
+    case BudgetViolationPolicy::WARN:
+    default:
+      if (hardware_interface::RealtimeLogger::throttle(
+            budget.last_warning_time, std::chrono::milliseconds(1000)))
+      {
+        rt_logger_->warn(
+          "Controller '{}' exceeded its execution time budget of {:.3f} us in {} consecutive "
+          "updates, the last one took {:.3f} us ({} violations in total).",
+          controller.info.name, budget.limit, params_->execution_time_budget.violation_cycles,
+          execution_time, budget.violations);
+      }
+      return false;
+  }
+}
+
+bool ControllerManager::is_update_shed(
+  const ControllerSpec & controller, uint64_t update_tick) const
+{
+  // controllers owning commands or serving preceding controllers are never shed
+  if (
+    static_cast<unsigned int>(controller.priority) >= load_shedding_.level ||
+    controller.priority == ControllerPriority::CRITICAL ||
+    !controller.info.claimed_interfaces.empty() || controller.c->is_in_chained_mode())
+  {
+    return false;
+  }
+  const auto decimation = static_cast<uint64_t>(params_->overruns.load_shedding.decimation);
+  return decimation == 0 || update_tick % decimation != 0;
+}
+
+controller_interface::return_type ControllerManager::step(
+  const rclcpp::Time & time, const rclcpp::Duration & period, unsigned int cycles)
+{
+  controller_interface::return_type ret = controller_interface::return_type::OK;
+  rclcpp::Time cycle_time = time;
+  for (unsigned int i = 0; i < cycles; ++i)
+  {
+    const auto start_time = std::chrono::steady_clock::now();
+    read(cycle_time, period);
+    if (update(cycle_time, period) != controller_interface::return_type::OK)
+    {
+      ret = controller_interface::return_type::ERROR;
+    }
+    write(cycle_time, period);
+    step_stats_.add_measurement(
+      std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
+        .count());
+    cycle_time += period;
+  }
+  return ret;
 }
 
 std::vector<ControllerSpec> &
@@ -3295,6 +4471,25 @@ ControllerManager::RTControllerListWrapper::update_and_get_used_by_rt_list()
   return controllers_lists_[used_by_realtime_controllers_index_];
 }
 
+std::vector<ControllerSpec> &
+ControllerManager::RTControllerListWrapper::update_and_get_used_by_rt_list(unsigned int rate_domain)
+{
+  int & used_index = used_by_rate_domains_controllers_indices_[rate_domain - 1];
+  used_index = updated_controllers_index_;
+  return controllers_lists_[used_index];
+}
+
+void ControllerManager::RTControllerListWrapper::release_used_by_rt_list(unsigned int rate_domain)
+{
+  used_by_rate_domains_controllers_indices_[rate_domain - 1] = -1;
+}
+
+void ControllerManager::RTControllerListWrapper::set_rate_domains_count(size_t count)
+{
+  std::lock_guard<std::recursive_mutex> guard(controllers_lock_);
+  used_by_rate_domains_controllers_indices_.assign(count, -1);
+}
+
 std::vector<ControllerSpec> & ControllerManager::RTControllerListWrapper::get_unused_list(
   const std::lock_guard<std::recursive_mutex> &)
 {
@@ -3354,7 +4549,9 @@ int ControllerManager::RTControllerListWrapper::get_other_list(int index) const
 void ControllerManager::RTControllerListWrapper::wait_until_rt_not_using(
   int index, std::chrono::microseconds sleep_period) const
 {
-  while (used_by_realtime_controllers_index_ == index)
+  while (
+    used_by_realtime_controllers_index_ == index ||
+    ros2_control::has_item(used_by_rate_domains_controllers_indices_, index))
   {
     if (!rclcpp::ok())
     {
@@ -3375,6 +4572,11 @@ std::pair<std::string, std::string> ControllerManager::split_command_interface(
 
 unsigned int ControllerManager::get_update_rate() const { return update_rate_; }
 
+unsigned int ControllerManager::get_rate_domain_update_rate(unsigned int rate_domain) const
+{
+  return rate_domain == 0 ? update_rate_ : rate_domains_.at(rate_domain - 1).update_rate;
+}
+
 rclcpp::Clock::SharedPtr ControllerManager::get_trigger_clock() const { return trigger_clock_; }
 
 void ControllerManager::perform_hardware_command_mode_change(
@@ -3392,15 +4594,15 @@ void ControllerManager::perform_hardware_command_mode_change(
     rt_buffer_.interfaces_to_start);
   if (!rt_buffer_.interfaces_to_stop.empty() || !rt_buffer_.interfaces_to_start.empty())
   {
+    uint64_t switch_id = 0;
     if (!(resource_manager_->prepare_command_mode_switch(
-            rt_buffer_.interfaces_to_start, rt_buffer_.interfaces_to_stop) &&
+            rt_buffer_.interfaces_to_start, rt_buffer_.interfaces_to_stop, switch_id) &&
           resource_manager_->perform_command_mode_switch(
-            rt_buffer_.interfaces_to_start, rt_buffer_.interfaces_to_stop)))
+            rt_buffer_.interfaces_to_start, rt_buffer_.interfaces_to_stop, switch_id)))
     {
-      RCLCPP_ERROR(
-        get_logger(),
-        "Error while attempting mode switch when deactivating controllers in %s cycle!",
-        rt_cycle_name.c_str());
+      rt_logger_->error(
+        "Error while attempting mode switch when deactivating controllers in {} cycle!",
+        rt_cycle_name);
     }
   }
 }
@@ -3922,10 +5124,152 @@ controller_interface::return_type ControllerManager::check_for_interfaces_availa
         return controller_interface::return_type::ERROR;
       }
     }
+    // the commands are only exchanged within a rate domain, the states can cross rate domains
+    const auto rate_domain_name = [this](unsigned int rate_domain)
+    { return rate_domain == 0 ? std::string("main") : rate_domains_[rate_domain - 1].name; };
+    for (const auto & cmd_itf : controller_cmd_interfaces)
+    {
+      const unsigned int itf_rate_domain = get_interface_rate_domain(controllers, cmd_itf, true);
+      if (itf_rate_domain != controller_it->rate_domain)
+      {
+        message = fmt::format(
+          FMT_COMPILE(
+            "Unable to activate controller '{}' of the rate domain '{}' since the command "
+            "interface '{}' belongs to the rate domain '{}'."),
+          controller_it->info.name, rate_domain_name(controller_it->rate_domain), cmd_itf,
+          rate_domain_name(itf_rate_domain));
+        RCLCPP_WARN(get_logger(), "%s", message.c_str());
+        return controller_interface::return_type::ERROR;
+      }
+    }
+    // the states of another rate domain are read from a copy published by their writer, so that
+    // neither of the rate domains fails to lock them. The copy is allocated here, outside of the
+    // real-time loops.
+    const auto claimed_state_interfaces =
+      controller_it->c->state_interface_configuration().type ==
+          controller_interface::interface_configuration_type::ALL
+        ? resource_manager_->available_state_interfaces()
+        : controller_state_interfaces;
+    for (const auto & state_itf : claimed_state_interfaces)
+    {
+      const unsigned int itf_rate_domain = get_interface_rate_domain(controllers, state_itf, false);
+      if (
+        itf_rate_domain != controller_it->rate_domain &&
+        !resource_manager_->enable_state_interface_published_copy(state_itf))
+      {
+        message = fmt::format(
+          FMT_COMPILE(
+            "Unable to activate controller '{}' of the rate domain '{}' since the state interface "
+            "'{}' of the rate domain '{}' is bound to memory and can't be shared across rate "
+            "domains."),
+          controller_it->info.name, rate_domain_name(controller_it->rate_domain), state_itf,
+          rate_domain_name(itf_rate_domain));
+        RCLCPP_WARN(get_logger(), "%s", message.c_str());
+        return controller_interface::return_type::ERROR;
+      }
+    }
   }
   return controller_interface::return_type::OK;
 }
 
+unsigned int ControllerManager::get_interface_rate_domain(
+  const std::vector<ControllerSpec> & controllers, const std::string & interface_name,
+  bool is_command_interface)
+{
+  if (rate_domains_.empty())
+  {
+    return 0;
+  }
+  // reference and exported state interfaces of chainable controllers
+  for (const auto & controller : controllers)
+  {
+    if (interface_name.rfind(controller.info.name + "/", 0) == 0)
+    {
+      return controller.rate_domain;
+    }
+  }
+  for (const auto & [component_name, component_info] : resource_manager_->get_components_status())
+  {
+    const auto & component_interfaces =
+      is_command_interface ? component_info.command_interfaces : component_info.state_interfaces;
+    if (!ros2_control::has_item(component_interfaces, interface_name))
+    {
+      continue;
+    }
+    for (unsigned int i = 0; i < rate_domains_.size(); ++i)
+    {
+      if (ros2_control::has_item(rate_domains_[i].hardware_components, component_name))
+      {
+        return i + 1;
+      }
+    }
+    return 0;
+  }
+  return 0;
+}
+
+controller_interface::return_type ControllerManager::check_switch_plan_is_valid(
+  const std::vector<ControllerSpec> & controllers, const SwitchPlan & plan,
+  std::string & message) const
+{
+  if (
+    plan.activate_indices.size() != plan.activate_request.size() ||
+    plan.deactivate_indices.size() != plan.deactivate_request.size())
+  {
+    message = "The switch plan is not compiled. Use 'prepare_switch' to compile it.";
+    RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+    return controller_interface::return_type::ERROR;
+  }
+
+  const auto check_controllers =
+    [&](
+      const std::vector<std::string> & names, const std::vector<size_t> & indices,
+      const std::string & action) -> controller_interface::return_type
+  {
+    for (size_t i = 0; i < names.size(); ++i)
+    {
+      const auto & controller_name = names[i];
+      if (indices[i] >= controllers.size() || controllers[indices[i]].info.name != controller_name)
+      {
+        message = fmt::format(
+          FMT_COMPILE(
+            "The switch plan is outdated: the controllers list has changed since controller '{}' "
+            "was checked. Prepare the switch again."),
+          controller_name);
+        RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+        return controller_interface::return_type::ERROR;
+      }
+      const auto & controller = controllers[indices[i]];
+      // controllers restarted by the switch (e.g. to change their chained mode) are in both lists
+      const bool expect_active = action == "deactivate" ||
+                                 ros2_control::has_item(plan.deactivate_request, controller_name);
+      const bool state_matches =
+        expect_active ? is_controller_active(controller.c) : is_controller_inactive(controller.c);
+      if (!state_matches)
+      {
+        message = fmt::format(
+          FMT_COMPILE(
+            "The switch plan is outdated: controller '{}' to {} is in state '{}' and not '{}' as "
+            "expected. Prepare the switch again."),
+          controller_name, action, controller.c->get_lifecycle_state().label(),
+          expect_active ? hardware_interface::lifecycle_state_names::ACTIVE
+                        : hardware_interface::lifecycle_state_names::INACTIVE);
+        RCLCPP_ERROR(get_logger(), "%s", message.c_str());
+        return controller_interface::return_type::ERROR;
+      }
+    }
+    return controller_interface::return_type::OK;
+  };
+
+  if (
+    check_controllers(plan.deactivate_request, plan.deactivate_indices, "deactivate") !=
+    controller_interface::return_type::OK)
+  {
+    return controller_interface::return_type::ERROR;
+  }
+  return check_controllers(plan.activate_request, plan.activate_indices, "activate");
+}
+
 void ControllerManager::controller_activity_diagnostic_callback(
   diagnostic_updater::DiagnosticStatusWrapper & stat)
 {
@@ -3983,6 +5327,26 @@ void ControllerManager::controller_activity_diagnostic_callback(
       const auto exec_time_stats = controllers[i].execution_time_statistics->get_statistics();
       stat.add(
         controllers[i].info.name + exec_time_suffix, make_stats_string(exec_time_stats, "us"));
+      if (controllers[i].execution_time_budget->limit > 0.0)
+      {
+        stat.add(
+          controllers[i].info.name + ".execution_time_budget_violations",
+          std::to_string(controllers[i].execution_time_budget->violations));
+      }
+      const auto arena_statistics = controllers[i].c->get_realtime_memory_arena_statistics();
+      if (arena_statistics.capacity > 0)
+      {
+        stat.add(
+          controllers[i].info.name + ".realtime_memory_arena",
+          make_arena_stats_string(arena_statistics));
+      }
+      const uint64_t deadline_overruns = controllers[i].c->get_deadline_overruns();
+      if (deadline_overruns > 0)
+      {
+        stat.add(
+          controllers[i].info.name + ".async_thread.deadline_overruns",
+          std::to_string(deadline_overruns));
+      }
       const bool publish_periodicity_stats =
         is_async || (controllers[i].c->get_update_rate() != this->get_update_rate());
       if (publish_periodicity_stats)
@@ -4151,6 +5515,18 @@ void ControllerManager::hardware_components_diagnostic_callback(
   for (const auto & [component_name, component_info] : hw_components_info)
   {
     stat.add(component_name + state_suffix, component_info.state.label());
+    if (component_info.realtime_memory_arena.capacity > 0)
+    {
+      stat.add(
+        component_name + ".realtime_memory_arena",
+        make_arena_stats_string(component_info.realtime_memory_arena));
+    }
+    if (component_info.deadline_overruns > 0)
+    {
+      stat.add(
+        component_name + ".async_thread.deadline_overruns",
+        std::to_string(component_info.deadline_overruns));
+    }
     if (component_info.state.id() != lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
     {
       all_active = false;
@@ -4283,6 +5659,42 @@ void ControllerManager::controller_manager_diagnostic_callback(
     periodicity_stat_name + ".standard_deviation", std::to_string(cm_stats.standard_deviation));
   stat.add(periodicity_stat_name + ".min", std::to_string(cm_stats.min));
   stat.add(periodicity_stat_name + ".max", std::to_string(cm_stats.max));
+  const auto step_stats = step_stats_.get_statistics();
+  if (step_stats.sample_count > 0)
+  {
+    const std::string step_stat_name = "step_time";
+    stat.add(step_stat_name + ".average", std::to_string(step_stats.average));
+    stat.add(
+      step_stat_name + ".standard_deviation", std::to_string(step_stats.standard_deviation));
+    stat.add(step_stat_name + ".min", std::to_string(step_stats.min));
+    stat.add(step_stat_name + ".max", std::to_string(step_stats.max));
+  }
+  stat.add(
+    "deadline_misses.runtime_overruns", std::to_string(deadline_misses_.runtime_overruns));
+  stat.add("deadline_misses.missed_cycles", std::to_string(deadline_misses_.missed_cycles));
+  for (size_t i = 0; i < rate_domains_.size(); ++i)
+  {
+    const std::string prefix = "rate_domains." + rate_domains_[i].name + ".deadline_misses";
+    const auto & deadline_misses = rate_domain_cycles_[i]->deadline_misses;
+    stat.add(prefix + ".runtime_overruns", std::to_string(deadline_misses.runtime_overruns));
+    stat.add(prefix + ".missed_cycles", std::to_string(deadline_misses.missed_cycles));
+  }
+  if (params_->overruns.load_shedding.enable)
+  {
+    stat.add("load_shedding.level", std::to_string(load_shedding_.level));
+    stat.add("load_shedding.events", std::to_string(load_shedding_.events));
+    stat.add("load_shedding.shed_updates", std::to_string(load_shedding_.shed_updates));
+  }
+  {
+    std::lock_guard<std::mutex> guard(cpu_placement_mutex_);
+    if (cpu_placement_)
+    {
+      for (const auto & placement : cpu_placement_->get_plan())
+      {
+        stat.add("cpu_placement." + placement.thread_name, cpu_placement_->describe(placement));
+      }
+    }
+  }
   if (is_resource_manager_initialized())
   {
     stat.summary(diagnostic_msgs::msg::DiagnosticStatus::OK, "Controller Manager is running");
@@ -4322,6 +5734,14 @@ void ControllerManager::controller_manager_diagnostic_callback(
   {
     stat.mergeSummary(diagnostic_msgs::msg::DiagnosticStatus::WARN, diag_summary);
   }
+  if (load_shedding_.level > 0)
+  {
+    stat.mergeSummary(
+      diagnostic_msgs::msg::DiagnosticStatus::WARN,
+      fmt::format(
+        FMT_COMPILE("Controller Manager is shedding controller updates at level {}"),
+        load_shedding_.level));
+  }
 }
 
 void ControllerManager::update_list_with_controller_chain(
@@ -0,0 +1,411 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "controller_manager/cpu_placement.hpp"
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace controller_manager
+{
+namespace
+{
+/// Content of a sysfs file without the trailing whitespace, std::nullopt if it can't be read.
+std::optional<std::string> read_sysfs_file(const std::string & path)
+{
+  std::ifstream file(path);
+  if (!file)
+  {
+    return std::nullopt;
+  }
+  std::stringstream content;
+  content << file.rdbuf();
+  std::string value = content.str();
+  while (!value.empty() && std::isspace(static_cast<unsigned char>(value.back())))
+  {
+    value.pop_back();
+  }
+  return value;
+}
+
+std::optional<int> read_sysfs_int(const std::string & path)
+{
+  const auto value = read_sysfs_file(path);
+  if (!value)
+  {
+    return std::nullopt;
+  }
+  try
+  {
+    return std::stoi(*value);
+  }
+  catch (const std::exception &)
+  {
+    return std::nullopt;
+  }
+}
+
+int parse_cpu(const std::string & cpu, const std::string & cpu_list)
+{
+  if (
+    cpu.empty() ||
+    !std::all_of(cpu.begin(), cpu.end(), [](unsigned char c) { return std::isdigit(c); }))
+  {
+    throw std::invalid_argument(
+      fmt::format(FMT_COMPILE("Invalid CPU '{}' in the CPU list '{}'."), cpu, cpu_list));
+  }
+  try
+  {
+    return std::stoi(cpu);
+  }
+  catch (const std::out_of_range &)
+  {
+    throw std::invalid_argument(
+      fmt::format(FMT_COMPILE("Invalid CPU '{}' in the CPU list '{}'."), cpu, cpu_list));
+  }
+}
+
+bool is_same_core(const CpuInfo & lhs, const CpuInfo & rhs)
+{
+  return lhs.package_id == rhs.package_id && lhs.core_id == rhs.core_id;
+}
+}  // namespace
+
+std::vector<int> parse_cpu_list(const std::string & cpu_list)
+{
+  std::vector<int> cpus;
+  if (std::all_of(
+        cpu_list.begin(), cpu_list.end(), [](unsigned char c) { return std::isspace(c); }))
+  {
+    return cpus;
+  }
+  std::stringstream stream(cpu_list);
+  std::string item;
+  while (std::getline(stream, item, ','))
+  {
+    item.erase(
+      std::remove_if(item.begin(), item.end(), [](unsigned char c) { return std::isspace(c); }),
+      item.end());
+    const auto dash = item.find('-');
+    if (dash == std::string::npos)
+    {
+      cpus.push_back(parse_cpu(item, cpu_list));
+      continue;
+    }
+    const int first = parse_cpu(item.substr(0, dash), cpu_list);
+    const int last = parse_cpu(item.substr(dash + 1), cpu_list);
+    if (last < first)
+    {
+      throw std::invalid_argument(
+        fmt::format(FMT_COMPILE("Invalid CPU range '{}' in the CPU list '{}'."), item, cpu_list));
+    }
+    for (int cpu = first; cpu <= last; ++cpu)
+    {
+      cpus.push_back(cpu);
+    }
+  }
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+  return cpus;
+}
+
+CpuTopology CpuTopology::read(const std::string & sysfs_cpu_path)
+{
+  CpuTopology topology;
+  std::vector<int> online_cpus;
+  std::vector<int> isolated_cpus;
+  try
+  {
+    const auto online = read_sysfs_file(sysfs_cpu_path + "/online");
+    if (!online)
+    {
+      return topology;
+    }
+    online_cpus = parse_cpu_list(*online);
+    isolated_cpus = parse_cpu_list(read_sysfs_file(sysfs_cpu_path + "/isolated").value_or(""));
+  }
+  catch (const std::invalid_argument &)
+  {
+    return topology;
+  }
+
+  for (const int id : online_cpus)
+  {
+    const std::string cpu_path = sysfs_cpu_path + "/cpu" + std::to_string(id);
+    CpuInfo cpu;
+    cpu.id = id;
+    cpu.core_id = read_sysfs_int(cpu_path + "/topology/core_id").value_or(id);
+    cpu.package_id = read_sysfs_int(cpu_path + "/topology/physical_package_id").value_or(0);
+    cpu.isolated = std::binary_search(isolated_cpus.begin(), isolated_cpus.end(), id);
+    try
+    {
+      cpu.smt_siblings =
+        parse_cpu_list(read_sysfs_file(cpu_path + "/topology/thread_siblings_list").value_or(""));
+    }
+    catch (const std::invalid_argument &)
+    {
+      cpu.smt_siblings.clear();
+    }
+    if (cpu.smt_siblings.empty())
+    {
+      cpu.smt_siblings = {id};
+    }
+
+    // the unified or data cache with the highest level
+    cpu.last_level_cache = -1;
+    int last_level = 0;
+    for (int index = 0;; ++index)
+    {
+      const std::string cache_path = cpu_path + "/cache/index" + std::to_string(index);
+      const auto level = read_sysfs_int(cache_path + "/level");
+      if (!level)
+      {
+        break;
+      }
+      if (*level <= last_level || read_sysfs_file(cache_path + "/type") == "Instruction")
+      {
+        continue;
+      }
+      try
+      {
+        const auto shared_cpus =
+          parse_cpu_list(read_sysfs_file(cache_path + "/shared_cpu_list").value_or(""));
+        last_level = *level;
+        cpu.last_level_cache = shared_cpus.empty() ? id : shared_cpus.front();
+      }
+      catch (const std::invalid_argument &)
+      {
+      }
+    }
+    topology.cpus.push_back(std::move(cpu));
+  }
+
+  for (auto & cpu : topology.cpus)
+  {
+    if (cpu.last_level_cache < 0)
+    {
+      // the lowest CPU of the package, as the CPUs are sorted
+      cpu.last_level_cache = std::find_if(
+                               topology.cpus.begin(), topology.cpus.end(),
+                               [&cpu](const CpuInfo & other)
+                               { return other.package_id == cpu.package_id; })
+                               ->id;
+    }
+  }
+  return topology;
+}
+
+const CpuInfo * CpuTopology::find(int cpu) const
+{
+  const auto it = std::lower_bound(
+    cpus.begin(), cpus.end(), cpu, [](const CpuInfo & info, int id) { return info.id < id; });
+  return it != cpus.end() && it->id == cpu ? &*it : nullptr;
+}
+
+CpuPlacementPlanner::CpuPlacementPlanner(CpuTopology topology) : topology_(std::move(topology))
+{
+  has_isolated_cpus_ = std::any_of(
+    topology_.cpus.begin(), topology_.cpus.end(), [](const CpuInfo & cpu) { return cpu.isolated; });
+}
+
+void CpuPlacementPlanner::reserve(
+  const std::string & thread_name, const std::vector<int> & cpus, const std::string & partner)
+{
+  release(thread_name);
+  CpuPlacement placement;
+  placement.thread_name = thread_name;
+  placement.partner = partner;
+  placement.configured = true;
+  for (const int cpu : cpus)
+  {
+    if (topology_.find(cpu))
+    {
+      placement.cpus.push_back(cpu);
+    }
+  }
+  placement.shares_cache_with_partner = shares_cache(placement.cpus, get_placement(partner));
+  plan_.push_back(std::move(placement));
+}
+
+std::optional<int> CpuPlacementPlanner::place(
+  const std::string & thread_name, const std::string & partner)
+{
+  if (const auto * placement = get_placement(thread_name))
+  {
+    if (!placement->cpus.empty())
+    {
+      return placement->cpus.front();
+    }
+    // retry the placement of a thread for which no core was free
+    release(thread_name);
+  }
+
+  const CpuPlacement * partner_placement = get_placement(partner);
+  const CpuInfo * partner_cpu = partner_placement && !partner_placement->cpus.empty()
+                                  ? topology_.find(partner_placement->cpus.front())
+                                  : nullptr;
+  const CpuInfo * housekeeping_cpu = topology_.find(0);
+
+  const CpuInfo * best_cpu = nullptr;
+  std::array<bool, 5> best_score{};
+  for (const auto & cpu : topology_.cpus)
+  {
+    if (!is_core_free(cpu))
+    {
+      continue;
+    }
+    // compared lexicographically, ties are resolved by the lower CPU id
+    const std::array<bool, 5> score = {
+      has_isolated_cpus_ && cpu.isolated,
+      partner_cpu && cpu.last_level_cache == partner_cpu->last_level_cache,
+      partner_cpu && cpu.package_id == partner_cpu->package_id,
+      !housekeeping_cpu || !is_same_core(cpu, *housekeeping_cpu),
+      cpu.id == cpu.smt_siblings.front()};
+    if (!best_cpu || score > best_score)
+    {
+      best_cpu = &cpu;
+      best_score = score;
+    }
+  }
+
+  CpuPlacement placement;
+  placement.thread_name = thread_name;
+  placement.partner = partner;
+  if (best_cpu)
+  {
+    placement.cpus = {best_cpu->id};
+    placement.shares_cache_with_partner = shares_cache(placement.cpus, partner_placement);
+  }
+  plan_.push_back(std::move(placement));
+  return best_cpu ? std::optional<int>(best_cpu->id) : std::nullopt;
+}
+
+void CpuPlacementPlanner::release(const std::string & thread_name)
+{
+  plan_.erase(
+    std::remove_if(
+      plan_.begin(), plan_.end(),
+      [&thread_name](const CpuPlacement & placement)
+      { return placement.thread_name == thread_name; }),
+    plan_.end());
+}
+
+const CpuPlacement * CpuPlacementPlanner::get_placement(const std::string & thread_name) const
+{
+  if (thread_name.empty())
+  {
+    return nullptr;
+  }
+  const auto it = std::find_if(
+    plan_.begin(), plan_.end(),
+    [&thread_name](const CpuPlacement & placement)
+    { return placement.thread_name == thread_name; });
+  return it != plan_.end() ? &*it : nullptr;
+}
+
+std::string CpuPlacementPlanner::describe(const CpuPlacement & placement) const
+{
+  if (placement.cpus.empty())
+  {
+    return placement.configured ? "configured CPUs are not online"
+                                : "not placed, no physical core is free";
+  }
+  std::string description = "CPU";
+  for (size_t i = 0; i < placement.cpus.size(); ++i)
+  {
+    description += fmt::format(FMT_COMPILE("{} {}"), i == 0 ? "" : ",", placement.cpus[i]);
+  }
+  if (placement.configured)
+  {
+    description += " (configured)";
+  }
+  else
+  {
+    const CpuInfo * cpu = topology_.find(placement.cpus.front());
+    description += fmt::format(
+      FMT_COMPILE(" (core {} of package {}{})"), cpu->core_id, cpu->package_id,
+      cpu->isolated ? ", isolated" : "");
+  }
+  if (!placement.partner.empty())
+  {
+    description += fmt::format(
+      FMT_COMPILE(", {} the last level cache with '{}'"),
+      placement.shares_cache_with_partner ? "sharing" : "not sharing", placement.partner);
+  }
+  return description;
+}
+
+std::string CpuPlacementPlanner::to_string() const
+{
+  std::string description;
+  for (const auto & placement : plan_)
+  {
+    if (!description.empty())
+    {
+      description += "\n";
+    }
+    description += fmt::format(FMT_COMPILE("'{}': {}"), placement.thread_name, describe(placement));
+  }
+  return description;
+}
+
+bool CpuPlacementPlanner::is_core_free(const CpuInfo & cpu) const
+{
+  for (const auto & placement : plan_)
+  {
+    for (const int placed_cpu : placement.cpus)
+    {
+      const CpuInfo * placed_cpu_info = topology_.find(placed_cpu);
+      if (placed_cpu_info && is_same_core(cpu, *placed_cpu_info))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool CpuPlacementPlanner::shares_cache(
+  const std::vector<int> & cpus, const CpuPlacement * partner) const
+{
+  if (!partner)
+  {
+    return false;
+  }
+  for (const int cpu : cpus)
+  {
+    for (const int partner_cpu : partner->cpus)
+    {
+      const CpuInfo * cpu_info = topology_.find(cpu);
+      const CpuInfo * partner_cpu_info = topology_.find(partner_cpu);
+      if (
+        cpu_info && partner_cpu_info &&
+        cpu_info->last_level_cache == partner_cpu_info->last_level_cache)
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+}  // namespace controller_manager
@@ -0,0 +1,155 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "controller_manager/load_generator_controller.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace controller_manager
+{
+namespace
+{
+std::chrono::nanoseconds to_nanoseconds(double microseconds)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::duration<double, std::micro>(microseconds));
+}
+
+size_t to_size(const std::string & name, int64_t value)
+{
+  if (value < 0)
+  {
+    throw std::invalid_argument("Parameter '" + name + "' can't be negative.");
+  }
+  return static_cast<size_t>(value);
+}
+}  // namespace
+
+controller_interface::CallbackReturn LoadGeneratorController::on_init()
+{
+  auto_declare<std::vector<std::string>>("command_interfaces", {});
+  auto_declare<std::vector<std::string>>("state_interfaces", {});
+  auto_declare<std::vector<std::string>>("reference_interfaces", {});
+  auto_declare<std::vector<std::string>>("exported_state_interfaces", {});
+  auto_declare<double>("cpu_time_us", 0.0);
+  auto_declare<int64_t>("memory_footprint_bytes", 0);
+  auto_declare<int64_t>("cache_footprint_bytes", 0);
+  auto_declare<std::string>("jitter_distribution", "none");
+  auto_declare<double>("jitter_us", 0.0);
+  auto_declare<double>("failure_rate", 0.0);
+  auto_declare<int64_t>("seed", 0);
+  return controller_interface::CallbackReturn::SUCCESS;
+}
+
+controller_interface::InterfaceConfiguration
+LoadGeneratorController::command_interface_configuration() const
+{
+  return {controller_interface::interface_configuration_type::INDIVIDUAL, command_interface_names_};
+}
+
+controller_interface::InterfaceConfiguration
+LoadGeneratorController::state_interface_configuration() const
+{
+  return {controller_interface::interface_configuration_type::INDIVIDUAL, state_interface_names_};
+}
+
+controller_interface::CallbackReturn LoadGeneratorController::on_configure(
+  const rclcpp_lifecycle::State & /*previous_state*/)
+{
+  const auto node = get_node();
+  command_interface_names_ = node->get_parameter("command_interfaces").as_string_array();
+  state_interface_names_ = node->get_parameter("state_interfaces").as_string_array();
+  exported_reference_interface_names_ =
+    node->get_parameter("reference_interfaces").as_string_array();
+  exported_state_interface_names_ =
+    node->get_parameter("exported_state_interfaces").as_string_array();
+
+  try
+  {
+    mock_components::SyntheticLoadParameters parameters;
+    parameters.cpu_time = to_nanoseconds(node->get_parameter("cpu_time_us").as_double());
+    parameters.memory_footprint =
+      to_size("memory_footprint_bytes", node->get_parameter("memory_footprint_bytes").as_int());
+    parameters.cache_footprint =
+      to_size("cache_footprint_bytes", node->get_parameter("cache_footprint_bytes").as_int());
+    parameters.jitter_distribution = mock_components::parse_jitter_distribution(
+      node->get_parameter("jitter_distribution").as_string());
+    parameters.jitter = to_nanoseconds(node->get_parameter("jitter_us").as_double());
+    parameters.failure_rate = node->get_parameter("failure_rate").as_double();
+    parameters.seed = static_cast<uint32_t>(node->get_parameter("seed").as_int());
+    load_ = mock_components::SyntheticLoad(parameters);
+  }
+  catch (const std::invalid_argument & e)
+  {
+    RCLCPP_ERROR(node->get_logger(), "Invalid synthetic load: %s", e.what());
+    return controller_interface::CallbackReturn::ERROR;
+  }
+  return controller_interface::CallbackReturn::SUCCESS;
+}
+
+controller_interface::return_type LoadGeneratorController::update_reference_from_subscribers(
+  const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/)
+{
+  // the references are only written by preceding controllers, otherwise the states are forwarded
+  return controller_interface::return_type::OK;
+}
+
+controller_interface::return_type LoadGeneratorController::update_and_write_commands(
+  const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/)
+{
+  if (!load_.run_cycle())
+  {
+    return controller_interface::return_type::ERROR;
+  }
+
+  const bool use_references = is_in_chained_mode();
+  for (size_t i = 0; i < command_interfaces_.size(); ++i)
+  {
+    if (
+      use_references && i < reference_interfaces_.size() && std::isfinite(reference_interfaces_[i]))
+    {
+      std::ignore = command_interfaces_[i].set_value(reference_interfaces_[i]);
+    }
+    else if (i < state_interfaces_.size())
+    {
+      const auto state = state_interfaces_[i].get_optional();
+      if (state.has_value())
+      {
+        std::ignore = command_interfaces_[i].set_value(state.value());
+      }
+    }
+  }
+  for (size_t i = 0; i < state_interfaces_values_.size() && i < state_interfaces_.size(); ++i)
+  {
+    const auto state = state_interfaces_[i].get_optional();
+    if (state.has_value())
+    {
+      state_interfaces_values_[i] = state.value();
+    }
+  }
+  return controller_interface::return_type::OK;
+}
+
+}  // namespace controller_manager
+
+#include "pluginlib/class_list_macros.hpp"
+
+PLUGINLIB_EXPORT_CLASS(
+  controller_manager::LoadGeneratorController, controller_interface::ChainableControllerInterface)
@@ -0,0 +1,99 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "controller_manager/controller_manager.hpp"
+#include "controller_manager_msgs/srv/step_control_loop.hpp"
+#include "rclcpp/executors.hpp"
+
+using StepControlLoop = controller_manager_msgs::srv::StepControlLoop;
+
+// Instead of running the control loop in a thread at the update rate, this node executes the
+// requested number of cycles back to back in the `~/step_control_loop` service, so that a
+// simulator or a test can step the controller manager in lockstep and faster than real time.
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+
+  std::shared_ptr<rclcpp::Executor> executor =
+    std::make_shared<rclcpp::executors::MultiThreadedExecutor>();
+  std::string manager_node_name = "controller_manager";
+
+  rclcpp::NodeOptions cm_node_options = controller_manager::get_cm_node_options();
+  std::vector<std::string> node_arguments = cm_node_options.arguments();
+  for (int i = 1; i < argc; ++i)
+  {
+    if (node_arguments.empty() && std::string(argv[i]) != "--ros-args")
+    {
+      // A simple way to reject non ros args
+      continue;
+    }
+    node_arguments.push_back(argv[i]);
+  }
+  cm_node_options.arguments(node_arguments);
+
+  auto cm = std::make_shared<controller_manager::ControllerManager>(
+    executor, manager_node_name, "", cm_node_options);
+
+  RCLCPP_INFO(
+    cm->get_logger(), "Running in lockstep mode, the control loop is stepped by '%s/%s'",
+    cm->get_fully_qualified_name(), "step_control_loop");
+
+  // the step requests are served one at a time, the switch requests of the other services are
+  // executed by the next step
+  auto step_callback_group =
+    cm->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  rclcpp::Time next_time = cm->get_trigger_clock()->now();
+  auto step_service = cm->create_service<StepControlLoop>(
+    "~/step_control_loop",
+    [cm, &next_time](
+      const std::shared_ptr<StepControlLoop::Request> request,
+      std::shared_ptr<StepControlLoop::Response> response)
+    {
+      const rclcpp::Duration period =
+        (request->period.sec == 0 && request->period.nanosec == 0)
+          ? rclcpp::Duration::from_seconds(1.0 / cm->get_update_rate())
+          : rclcpp::Duration(request->period);
+      if (request->cycles == 0 || period.nanoseconds() <= 0)
+      {
+        RCLCPP_ERROR(
+          cm->get_logger(), "Invalid step request: the cycles and the period have to be positive.");
+        response->ok = false;
+        response->time = next_time;
+        return;
+      }
+      if (request->time.sec != 0 || request->time.nanosec != 0)
+      {
+        next_time = rclcpp::Time(request->time, next_time.get_clock_type());
+      }
+
+      const auto start_time = std::chrono::steady_clock::now();
+      response->ok =
+        cm->step(next_time, period, request->cycles) == controller_interface::return_type::OK;
+      response->execution_time =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+      next_time += period * static_cast<double>(request->cycles);
+      response->time = next_time;
+    },
+    rclcpp::ServicesQoS(), step_callback_group);
+
+  executor->add_node(cm);
+  executor->spin();
+  rclcpp::shutdown();
+  return 0;
+}
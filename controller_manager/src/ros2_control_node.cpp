@@ -13,12 +13,19 @@
 // limitations under the License.
 
 #include <errno.h>
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "controller_manager/controller_manager.hpp"
+#include "hardware_interface/deadline_scheduling.hpp"
+#include "hardware_interface/realtime_memory.hpp"
 #include "rclcpp/executors.hpp"
 #include "realtime_tools/realtime_helpers.hpp"
 
@@ -31,6 +38,145 @@ namespace
 // We use a midpoint RT priority to allow maximum flexibility to users
 int const kSchedPriority = 50;
 
+// Bytes of the stack of the real-time threads touched at their start if the memory is locked
+int64_t const kDefaultStackPrefaultSize = 512 * 1024;
+
+/// Configures the calling thread and runs the real-time loop calling \p cycle at \p update_rate.
+/**
+ * The thread is scheduled with SCHED_DEADLINE if \p deadline_scheduling is enabled, and with
+ * SCHED_FIFO and \p thread_priority otherwise or if the reservation is rejected by the kernel.
+ * The first \p stack_prefault_size bytes of its stack are touched before the loop starts.
+ */
+void run_realtime_loop(
+  const std::shared_ptr<controller_manager::ControllerManager> & cm, const std::string & loop_name,
+  unsigned int rate_domain, unsigned int update_rate, const std::vector<int> & cpus,
+  int thread_priority, const hardware_interface::DeadlineSchedulingParams & deadline_scheduling,
+  size_t stack_prefault_size, bool use_sim_time, bool manage_overruns,
+  const std::function<void(const rclcpp::Duration &)> & cycle)
+{
+  if (!cpus.empty())
+  {
+    const auto affinity_result = realtime_tools::set_current_thread_affinity(cpus);
+    if (!affinity_result.first)
+    {
+      RCLCPP_WARN(
+        cm->get_logger(), "Unable to set the CPU affinity of the %s : '%s'", loop_name.c_str(),
+        affinity_result.second.c_str());
+    }
+  }
+
+  bool deadline_scheduled = false;
+  if (deadline_scheduling.is_enabled())
+  {
+    const auto [success, reason] =
+      hardware_interface::configure_sched_deadline(deadline_scheduling);
+    if (success)
+    {
+      deadline_scheduled = true;
+      RCLCPP_INFO(
+        cm->get_logger(),
+        "Successful set up SCHED_DEADLINE scheduling policy of the %s with runtime %ld us, "
+        "deadline %ld us and period %ld us.",
+        loop_name.c_str(), static_cast<long>(deadline_scheduling.runtime.count()),  // NOLINT
+        static_cast<long>(deadline_scheduling.deadline.count()),                    // NOLINT
+        static_cast<long>(deadline_scheduling.period.count()));                     // NOLINT
+      if (!cm->attach_deadline_overrun_counter(rate_domain))
+      {
+        RCLCPP_WARN(
+          cm->get_logger(), "The runtime overruns of the %s are not counted.", loop_name.c_str());
+      }
+    }
+    else
+    {
+      RCLCPP_WARN(
+        cm->get_logger(),
+        "Could not enable SCHED_DEADLINE scheduling policy of the %s, falling back to FIFO RT "
+        "scheduling: %s",
+        loop_name.c_str(), reason.c_str());
+    }
+  }
+
+  if (!deadline_scheduled)
+  {
+    if (!realtime_tools::configure_sched_fifo(thread_priority))
+    {
+      RCLCPP_WARN(
+        cm->get_logger(),
+        "Could not enable FIFO RT scheduling policy: with error number <%i>(%s). See "
+        "[https://control.ros.org/master/doc/ros2_control/controller_manager/doc/userdoc.html] "
+        "for details on how to enable realtime scheduling.",
+        errno, strerror(errno));
+    }
+    else
+    {
+      RCLCPP_INFO(
+        cm->get_logger(), "Successful set up FIFO RT scheduling policy of the %s with priority %i.",
+        loop_name.c_str(), thread_priority);
+    }
+  }
+
+  if (stack_prefault_size > 0)
+  {
+    const size_t prefaulted_size =
+      hardware_interface::prefault_current_thread_stack(stack_prefault_size);
+    RCLCPP_INFO(
+      cm->get_logger(), "Pre-faulted %zu bytes of the stack of the %s.", prefaulted_size,
+      loop_name.c_str());
+  }
+
+  // wait for the clock to be available
+  cm->get_clock()->wait_until_started();
+  cm->get_clock()->sleep_for(rclcpp::Duration::from_seconds(1.0 / update_rate));
+
+  // for calculating sleep time
+  auto const period = std::chrono::nanoseconds(1'000'000'000 / update_rate);
+
+  // for calculating the measured period of the loop
+  rclcpp::Time previous_time = cm->get_trigger_clock()->now();
+  std::this_thread::sleep_for(period);
+
+  std::chrono::steady_clock::time_point next_iteration_time{std::chrono::steady_clock::now()};
+
+  while (rclcpp::ok())
+  {
+    // calculate measured period
+    auto const current_time = cm->get_trigger_clock()->now();
+    auto const measured_period = current_time - previous_time;
+    previous_time = current_time;
+
+    cycle(measured_period);
+
+    // wait until we hit the end of the period
+    if (use_sim_time)
+    {
+      cm->get_clock()->sleep_until(current_time + period);
+    }
+    else
+    {
+      next_iteration_time += period;
+      const auto time_now = std::chrono::steady_clock::now();
+      if (manage_overruns && next_iteration_time < time_now)
+      {
+        const double time_diff =
+          static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(time_now - next_iteration_time)
+              .count()) /
+          1.e6;
+        const double loop_period = 1.e3 / static_cast<double>(update_rate);
+        const int overrun_count = static_cast<int>(std::ceil(time_diff / loop_period));
+        RCLCPP_WARN_THROTTLE(
+          cm->get_logger(), *cm->get_clock(), 1000,
+          "Overrun detected! The %s missed its desired rate of %u Hz. The loop took %f ms (missed "
+          "cycles : %d).",
+          loop_name.c_str(), update_rate, time_diff + loop_period, overrun_count + 1);
+        next_iteration_time += (overrun_count * period);
+        cm->add_deadline_missed_cycles(rate_domain, static_cast<uint64_t>(overrun_count + 1));
+      }
+      std::this_thread::sleep_until(next_iteration_time);
+    }
+  }
+}
+
 }  // namespace
 
 int main(int argc, char ** argv)
@@ -69,6 +215,13 @@ int main(int argc, char ** argv)
       RCLCPP_WARN(cm->get_logger(), "Unable to lock the memory: '%s'", lock_result.second.c_str());
     }
   }
+  // the pre-faulted pages of the stacks stay resident only if the memory is locked
+  size_t stack_prefault_size = 0u;
+  if (lock_memory)
+  {
+    stack_prefault_size = static_cast<size_t>(std::max<int64_t>(
+      cm->get_parameter_or<int64_t>("stack_prefault_size", kDefaultStackPrefaultSize), 0));
+  }
 
   RCLCPP_INFO(cm->get_logger(), "update rate is %d Hz", cm->get_update_rate());
   const bool manage_overruns = cm->get_parameter_or<bool>("overruns.manage", true);
@@ -79,107 +232,98 @@ int main(int argc, char ** argv)
     cm->get_logger(), "Spawning %s RT thread with scheduler priority: %d", cm->get_name(),
     thread_priority);
 
-  std::thread cm_thread(
-    [cm, thread_priority, use_sim_time, manage_overruns]()
+  hardware_interface::DeadlineSchedulingParams deadline_scheduling;
+  deadline_scheduling.runtime =
+    std::chrono::microseconds(cm->get_parameter_or<int64_t>("sched_runtime", 0));
+  deadline_scheduling.deadline =
+    std::chrono::microseconds(cm->get_parameter_or<int64_t>("sched_deadline", 0));
+  deadline_scheduling.period =
+    std::chrono::microseconds(cm->get_parameter_or<int64_t>("sched_period", 0));
+  if (deadline_scheduling.is_enabled())
+  {
+    try
     {
-      rclcpp::Parameter cpu_affinity_param;
-      if (cm->get_parameter("cpu_affinity", cpu_affinity_param))
-      {
-        std::vector<int> cpus = {};
-        if (cpu_affinity_param.get_type() == rclcpp::ParameterType::PARAMETER_INTEGER)
-        {
-          cpus = {static_cast<int>(cpu_affinity_param.as_int())};
-        }
-        else if (cpu_affinity_param.get_type() == rclcpp::ParameterType::PARAMETER_INTEGER_ARRAY)
-        {
-          const auto cpu_affinity_param_array = cpu_affinity_param.as_integer_array();
-          std::for_each(
-            cpu_affinity_param_array.begin(), cpu_affinity_param_array.end(),
-            [&cpus](int cpu) { cpus.push_back(static_cast<int>(cpu)); });
-        }
-        const auto affinity_result = realtime_tools::set_current_thread_affinity(cpus);
-        if (!affinity_result.first)
-        {
-          RCLCPP_WARN(
-            cm->get_logger(), "Unable to set the CPU affinity : '%s'",
-            affinity_result.second.c_str());
-        }
-      }
-
-      if (!realtime_tools::configure_sched_fifo(thread_priority))
-      {
-        RCLCPP_WARN(
-          cm->get_logger(),
-          "Could not enable FIFO RT scheduling policy: with error number <%i>(%s). See "
-          "[https://control.ros.org/master/doc/ros2_control/controller_manager/doc/userdoc.html] "
-          "for details on how to enable realtime scheduling.",
-          errno, strerror(errno));
-      }
-      else
-      {
-        RCLCPP_INFO(
-          cm->get_logger(), "Successful set up FIFO RT scheduling policy with priority %i.",
-          thread_priority);
-      }
-
-      // wait for the clock to be available
-      cm->get_clock()->wait_until_started();
-      cm->get_clock()->sleep_for(rclcpp::Duration::from_seconds(1.0 / cm->get_update_rate()));
-
-      // for calculating sleep time
-      auto const period = std::chrono::nanoseconds(1'000'000'000 / cm->get_update_rate());
-
-      // for calculating the measured period of the loop
-      rclcpp::Time previous_time = cm->get_trigger_clock()->now();
-      std::this_thread::sleep_for(period);
+      deadline_scheduling = hardware_interface::resolve_deadline_scheduling_params(
+        deadline_scheduling, std::chrono::microseconds(1'000'000 / cm->get_update_rate()));
+    }
+    catch (const std::invalid_argument & e)
+    {
+      RCLCPP_ERROR(
+        cm->get_logger(), "Ignoring the SCHED_DEADLINE parameters of the %s RT thread: %s",
+        cm->get_name(), e.what());
+      deadline_scheduling = {};
+    }
+  }
 
-      std::chrono::steady_clock::time_point next_iteration_time{std::chrono::steady_clock::now()};
+  rclcpp::Parameter cpu_affinity_param;
+  std::vector<int> cpus = {};
+  if (cm->get_parameter("cpu_affinity", cpu_affinity_param))
+  {
+    if (cpu_affinity_param.get_type() == rclcpp::ParameterType::PARAMETER_INTEGER)
+    {
+      cpus = {static_cast<int>(cpu_affinity_param.as_int())};
+    }
+    else if (cpu_affinity_param.get_type() == rclcpp::ParameterType::PARAMETER_INTEGER_ARRAY)
+    {
+      const auto cpu_affinity_param_array = cpu_affinity_param.as_integer_array();
+      std::for_each(
+        cpu_affinity_param_array.begin(), cpu_affinity_param_array.end(),
+        [&cpus](int cpu) { cpus.push_back(static_cast<int>(cpu)); });
+    }
+  }
+  if (cpus.empty())
+  {
+    // planned by the CPU placement of the controller manager, if enabled
+    cpus = cm->get_planned_cpu_affinity(0);
+  }
 
-      while (rclcpp::ok())
-      {
-        // calculate measured period
-        auto const current_time = cm->get_trigger_clock()->now();
-        auto const measured_period = current_time - previous_time;
-        previous_time = current_time;
-
-        // execute update loop
-        cm->read(cm->get_trigger_clock()->now(), measured_period);
-        cm->update(cm->get_trigger_clock()->now(), measured_period);
-        cm->write(cm->get_trigger_clock()->now(), measured_period);
-
-        // wait until we hit the end of the period
-        if (use_sim_time)
-        {
-          cm->get_clock()->sleep_until(current_time + period);
-        }
-        else
+  std::thread cm_thread(
+    [cm, cpus, thread_priority, deadline_scheduling, stack_prefault_size, use_sim_time,
+     manage_overruns]()
+    {
+      run_realtime_loop(
+        cm, "controller manager", 0, cm->get_update_rate(), cpus, thread_priority,
+        deadline_scheduling, stack_prefault_size, use_sim_time, manage_overruns,
+        [&cm](const rclcpp::Duration & measured_period)
         {
-          next_iteration_time += period;
-          const auto time_now = std::chrono::steady_clock::now();
-          if (manage_overruns && next_iteration_time < time_now)
-          {
-            const double time_diff =
-              static_cast<double>(
-                std::chrono::duration_cast<std::chrono::nanoseconds>(time_now - next_iteration_time)
-                  .count()) /
-              1.e6;
-            const double cm_period = 1.e3 / static_cast<double>(cm->get_update_rate());
-            const int overrun_count = static_cast<int>(std::ceil(time_diff / cm_period));
-            RCLCPP_WARN_THROTTLE(
-              cm->get_logger(), *cm->get_clock(), 1000,
-              "Overrun detected! The controller manager missed its desired rate of %d Hz. The loop "
-              "took %f ms (missed cycles : %d).",
-              cm->get_update_rate(), time_diff + cm_period, overrun_count + 1);
-            next_iteration_time += (overrun_count * period);
-          }
-          std::this_thread::sleep_until(next_iteration_time);
-        }
-      }
+          // execute update loop
+          cm->read(cm->get_trigger_clock()->now(), measured_period);
+          cm->update(cm->get_trigger_clock()->now(), measured_period);
+          cm->write(cm->get_trigger_clock()->now(), measured_period);
+        });
     });
 
+  // each rate domain is executed by its own real-time thread
+  std::vector<std::thread> rate_domain_threads;
+  const auto & rate_domains = cm->get_rate_domains();
+  for (unsigned int i = 0; i < rate_domains.size(); ++i)
+  {
+    const auto & rate_domain = rate_domains[i];
+    RCLCPP_INFO(
+      cm->get_logger(),
+      "Spawning RT thread of the rate domain '%s' at %u Hz with scheduler priority: %d",
+      rate_domain.name.c_str(), rate_domain.update_rate, rate_domain.thread_priority);
+    rate_domain_threads.emplace_back(
+      [cm, rate_domain, index = i + 1, stack_prefault_size, use_sim_time, manage_overruns]()
+      {
+        run_realtime_loop(
+          cm, "rate domain '" + rate_domain.name + "'", index, rate_domain.update_rate,
+          rate_domain.cpu_affinity.empty() ? cm->get_planned_cpu_affinity(index)
+                                           : rate_domain.cpu_affinity,
+          rate_domain.thread_priority, rate_domain.deadline_scheduling,
+          stack_prefault_size, use_sim_time, manage_overruns,
+          [&cm, index](const rclcpp::Duration & measured_period)
+          { cm->update_rate_domain(index, cm->get_trigger_clock()->now(), measured_period); });
+      });
+  }
+
   executor->add_node(cm);
   executor->spin();
   cm_thread.join();
+  for (auto & rate_domain_thread : rate_domain_threads)
+  {
+    rate_domain_thread.join();
+  }
   rclcpp::shutdown();
   return 0;
 }
@@ -69,6 +69,10 @@ controller_interface::return_type TestController::update(
   {
     std::this_thread::sleep_for(std::chrono::microseconds(1000000u / (2 * get_update_rate())));
   }
+  if (update_processing_time > 0.0)
+  {
+    std::this_thread::sleep_for(std::chrono::duration<double>(update_processing_time));
+  }
   update_period_ = period;
   ++internal_counter;
 
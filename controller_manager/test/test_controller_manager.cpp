@@ -11,8 +11,12 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <numeric>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "controller_manager/controller_manager.hpp"
@@ -2457,3 +2461,452 @@ TEST_F(
       test_controller->get_lifecycle_state().id());
   }
 }
+
+class TestControllerManagerLockstep
+: public ControllerManagerFixture<controller_manager::ControllerManager>
+{
+};
+
+TEST_F(TestControllerManagerLockstep, step_executes_cycles_with_fixed_period)
+{
+  auto test_controller = std::make_shared<test_controller::TestController>();
+  cm_->add_controller(
+    test_controller, test_controller::TEST_CONTROLLER_NAME,
+    test_controller::TEST_CONTROLLER_CLASS_NAME);
+  test_controller->get_node()->set_parameter({"update_rate", 10});
+  {
+    ControllerManagerRunner cm_runner(this);
+    cm_->configure_controller(test_controller::TEST_CONTROLLER_NAME);
+  }
+  ASSERT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
+    test_controller->get_lifecycle_state().id());
+
+  // the switch is executed by the next step
+  auto switch_future = std::async(
+    std::launch::async, &controller_manager::ControllerManager::switch_controller, cm_,
+    std::vector<std::string>{test_controller::TEST_CONTROLLER_NAME}, std::vector<std::string>{},
+    STRICT, true, rclcpp::Duration(0, 0));
+  ASSERT_EQ(std::future_status::timeout, switch_future.wait_for(std::chrono::milliseconds(100)))
+    << "switch_controller should be blocking until next step";
+  EXPECT_EQ(controller_interface::return_type::OK, cm_->step(time_, PERIOD));
+  ASSERT_EQ(controller_interface::return_type::OK, switch_future.get());
+  ASSERT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, test_controller->get_lifecycle_state().id());
+  EXPECT_EQ(1u, cm_->get_step_statistics().get_statistics().sample_count);
+
+  // one second of simulated time at the update rate of the controller manager, the controller is
+  // updated at its own rate based on the stepped time and not on the wall time
+  const auto start_counter = test_controller->internal_counter;
+  const auto wall_start = std::chrono::steady_clock::now();
+  EXPECT_EQ(
+    controller_interface::return_type::OK,
+    cm_->step(time_ + PERIOD, PERIOD, cm_->get_update_rate()));
+  EXPECT_LT(std::chrono::steady_clock::now() - wall_start, std::chrono::seconds(1))
+    << "steps should not wait for the period";
+  EXPECT_THAT(
+    test_controller->internal_counter - start_counter,
+    testing::AllOf(testing::Ge(9u), testing::Le(11u)));
+  EXPECT_EQ(cm_->get_update_rate() + 1u, cm_->get_step_statistics().get_statistics().sample_count);
+  EXPECT_GE(cm_->get_step_statistics().get_min(), 0.0);
+}
+
+class TestControllerManagerWithParameters
+: public ControllerManagerFixture<controller_manager::ControllerManager>
+{
+public:
+  /// Replaces the controller manager with one using the given parameters
+  void reset_controller_manager(const std::vector<rclcpp::Parameter> & parameters)
+  {
+    auto options = controller_manager::get_cm_node_options();
+    for (const auto & parameter : parameters)
+    {
+      options.parameter_overrides().push_back(parameter);
+    }
+    cm_.reset();
+    cm_ = std::make_shared<controller_manager::ControllerManager>(
+      std::make_unique<hardware_interface::ResourceManager>(
+        rm_node_->get_node_clock_interface(), rm_node_->get_node_logging_interface()),
+      executor_, TEST_CM_NAME, "", options);
+    pass_robot_description_to_cm_and_rm(robot_description_);
+  }
+};
+
+class TestControllerManagerTickScheduling : public TestControllerManagerWithParameters
+{
+public:
+  void SetUp() override
+  {
+    TestControllerManagerWithParameters::SetUp();
+    reset_controller_manager({rclcpp::Parameter("tick_scheduling", true)});
+  }
+};
+
+TEST_F(TestControllerManagerTickScheduling, decimated_controllers_are_spread_over_the_cycles)
+{
+  std::vector<std::shared_ptr<test_controller::TestController>> test_controllers;
+  std::vector<std::string> controller_names;
+  for (size_t i = 0; i < 4; ++i)
+  {
+    controller_names.push_back("test_controller_" + std::to_string(i));
+    test_controllers.push_back(std::make_shared<test_controller::TestController>());
+    cm_->add_controller(
+      test_controllers.back(), controller_names.back(),
+      test_controller::TEST_CONTROLLER_CLASS_NAME);
+    test_controllers.back()->get_node()->set_parameter({"update_rate", 10});
+    ControllerManagerRunner cm_runner(this);
+    cm_->configure_controller(controller_names.back());
+  }
+  EXPECT_TRUE(cm_->get_controller_load_profile().empty());
+
+  auto switch_future = std::async(
+    std::launch::async, &controller_manager::ControllerManager::switch_controller, cm_,
+    controller_names, std::vector<std::string>{}, STRICT, true, rclcpp::Duration(0, 0));
+  ASSERT_EQ(std::future_status::timeout, switch_future.wait_for(std::chrono::milliseconds(100)))
+    << "switch_controller should be blocking until next step";
+  EXPECT_EQ(controller_interface::return_type::OK, cm_->step(time_, PERIOD));
+  ASSERT_EQ(controller_interface::return_type::OK, switch_future.get());
+
+  // four 10 Hz controllers at 100 Hz, each of them updated in a different cycle
+  const auto load_profile = cm_->get_controller_load_profile();
+  ASSERT_THAT(load_profile, testing::SizeIs(10));
+  EXPECT_DOUBLE_EQ(1.0, *std::max_element(load_profile.begin(), load_profile.end()));
+  EXPECT_DOUBLE_EQ(4.0, std::accumulate(load_profile.begin(), load_profile.end(), 0.0));
+
+  std::vector<size_t> counters(test_controllers.size(), 0u);
+  for (size_t cycle = 0; cycle < 20; ++cycle)
+  {
+    EXPECT_EQ(
+      controller_interface::return_type::OK, cm_->step(time_ + PERIOD * (cycle + 1.0), PERIOD));
+    size_t updated_controllers = 0;
+    for (size_t i = 0; i < test_controllers.size(); ++i)
+    {
+      updated_controllers += test_controllers[i]->internal_counter != counters[i] ? 1u : 0u;
+      counters[i] = test_controllers[i]->internal_counter;
+    }
+    EXPECT_LE(updated_controllers, 1u) << "in cycle " << cycle;
+  }
+  for (const auto & test_controller : test_controllers)
+  {
+    EXPECT_EQ(2u, test_controller->internal_counter);
+  }
+}
+
+class TestControllerManagerLoadShedding : public TestControllerManagerWithParameters
+{
+public:
+  void SetUp() override
+  {
+    TestControllerManagerWithParameters::SetUp();
+    // a budget of 5 ms at 100 Hz, cycles below 2.5 ms have headroom
+    reset_controller_manager(
+      {rclcpp::Parameter("overruns.load_shedding.enable", true),
+       rclcpp::Parameter("overruns.load_shedding.threshold", 0.5),
+       rclcpp::Parameter("overruns.load_shedding.recovery_threshold", 0.25),
+       rclcpp::Parameter("overruns.load_shedding.recovery_cycles", 3)});
+  }
+
+  std::shared_ptr<test_controller::TestController> add_test_controller(
+    const std::string & name, controller_manager::ControllerPriority priority)
+  {
+    auto test_controller = std::make_shared<test_controller::TestController>();
+    controller_manager::ControllerSpec controller_spec;
+    controller_spec.c = test_controller;
+    controller_spec.info.name = name;
+    controller_spec.info.type = test_controller::TEST_CONTROLLER_CLASS_NAME;
+    controller_spec.last_update_cycle_time = std::make_shared<rclcpp::Time>(0);
+    controller_spec.priority = priority;
+    cm_->add_controller(controller_spec);
+    return test_controller;
+  }
+};
+
+TEST_F(TestControllerManagerLoadShedding, low_priority_controllers_are_shed_until_headroom_returns)
+{
+  using controller_manager::ControllerPriority;
+  auto low_controller = add_test_controller("low_controller", ControllerPriority::LOW);
+  auto critical_controller =
+    add_test_controller("critical_controller", ControllerPriority::CRITICAL);
+  // claims a command interface, so it is never shed despite its low priority
+  auto commanding_controller =
+    add_test_controller("commanding_controller", ControllerPriority::LOW);
+  commanding_controller->set_command_interface_configuration(
+    {controller_interface::interface_configuration_type::INDIVIDUAL, {"joint1/position"}});
+  const std::vector<std::string> controller_names = {
+    "low_controller", "critical_controller", "commanding_controller"};
+  for (const auto & controller_name : controller_names)
+  {
+    ControllerManagerRunner cm_runner(this);
+    cm_->configure_controller(controller_name);
+  }
+
+  auto switch_future = std::async(
+    std::launch::async, &controller_manager::ControllerManager::switch_controller, cm_,
+    controller_names, std::vector<std::string>{}, STRICT, true, rclcpp::Duration(0, 0));
+  ASSERT_EQ(std::future_status::timeout, switch_future.wait_for(std::chrono::milliseconds(100)))
+    << "switch_controller should be blocking until next step";
+  EXPECT_EQ(controller_interface::return_type::OK, cm_->step(time_, PERIOD));
+  ASSERT_EQ(controller_interface::return_type::OK, switch_future.get());
+  EXPECT_EQ(0u, cm_->get_load_shedding().level);
+
+  // the update of the low priority controller overruns the budget
+  low_controller->update_processing_time = 0.008;
+  rclcpp::Time time = time_ + PERIOD;
+  EXPECT_EQ(controller_interface::return_type::OK, cm_->step(time, PERIOD));
+  EXPECT_EQ(1u, low_controller->internal_counter);
+  EXPECT_EQ(1u, cm_->get_load_shedding().level);
+  EXPECT_EQ(1u, cm_->get_load_shedding().events);
+
+  // it is shed while the others are still updated, until the headroom lowers the level again
+  for (unsigned int cycle = 1; cycle <= 3; ++cycle)
+  {
+    time += PERIOD;
+    EXPECT_EQ(controller_interface::return_type::OK, cm_->step(time, PERIOD));
+    EXPECT_EQ(1u, low_controller->internal_counter);
+    EXPECT_EQ(1u + cycle, critical_controller->internal_counter);
+    EXPECT_EQ(1u + cycle, commanding_controller->internal_counter);
+  }
+  EXPECT_EQ(0u, cm_->get_load_shedding().level);
+  EXPECT_EQ(3u, cm_->get_load_shedding().shed_updates);
+
+  // restored, its next overrun is a new shedding event
+  time += PERIOD;
+  EXPECT_EQ(controller_interface::return_type::OK, cm_->step(time, PERIOD));
+  EXPECT_EQ(2u, low_controller->internal_counter);
+  EXPECT_EQ(1u, cm_->get_load_shedding().level);
+  EXPECT_EQ(2u, cm_->get_load_shedding().events);
+}
+
+class TestControllerManagerExecutionTimeBudget : public TestControllerManagerWithParameters
+{
+public:
+  void SetUp() override
+  {
+    TestControllerManagerWithParameters::SetUp();
+    reset_controller_manager({rclcpp::Parameter("execution_time_budget.violation_cycles", 3)});
+  }
+
+  std::shared_ptr<test_controller::TestController> add_test_controller(
+    const std::string & name, double budget, controller_manager::BudgetViolationPolicy policy,
+    const std::vector<std::string> & fallback_controllers = {})
+  {
+    auto test_controller = std::make_shared<test_controller::TestController>();
+    controller_manager::ControllerSpec controller_spec;
+    controller_spec.c = test_controller;
+    controller_spec.info.name = name;
+    controller_spec.info.type = test_controller::TEST_CONTROLLER_CLASS_NAME;
+    controller_spec.info.fallback_controllers_names = fallback_controllers;
+    controller_spec.last_update_cycle_time = std::make_shared<rclcpp::Time>(0);
+    controller_spec.execution_time_budget->limit = budget;
+    controller_spec.execution_time_budget->policy = policy;
+    cm_->add_controller(controller_spec);
+    {
+      ControllerManagerRunner cm_runner(this);
+      cm_->configure_controller(name);
+    }
+    return test_controller;
+  }
+
+  void activate_with_step(const std::vector<std::string> & controller_names)
+  {
+    auto switch_future = std::async(
+      std::launch::async, &controller_manager::ControllerManager::switch_controller, cm_,
+      controller_names, std::vector<std::string>{}, STRICT, true, rclcpp::Duration(0, 0));
+    ASSERT_EQ(std::future_status::timeout, switch_future.wait_for(std::chrono::milliseconds(100)))
+      << "switch_controller should be blocking until next step";
+    EXPECT_EQ(controller_interface::return_type::OK, cm_->step(time_, PERIOD));
+    ASSERT_EQ(controller_interface::return_type::OK, switch_future.get());
+  }
+};
+
+TEST_F(
+  TestControllerManagerExecutionTimeBudget, sustained_violation_activates_fallback_controllers)
+{
+  using controller_manager::BudgetViolationPolicy;
+  auto slow_controller = add_test_controller(
+    "slow_controller", 1000.0, BudgetViolationPolicy::FALLBACK, {"fallback_controller"});
+  auto fallback_controller =
+    add_test_controller("fallback_controller", 0.0, BudgetViolationPolicy::WARN);
+  activate_with_step({"slow_controller"});
+
+  // a single violation is tolerated
+  slow_controller->update_processing_time = 0.003;
+  rclcpp::Time time = time_ + PERIOD;
+  EXPECT_EQ(controller_interface::return_type::OK, cm_->step(time, PERIOD));
+  slow_controller->update_processing_time = 0.0;
+  time += PERIOD;
+  EXPECT_EQ(controller_interface::return_type::OK, cm_->step(time, PERIOD));
+  ASSERT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, slow_controller->get_lifecycle_state().id());
+
+  // the third consecutive violation deactivates it in favor of its fallback controller
+  slow_controller->update_processing_time = 0.003;
+  for (unsigned int cycle = 0; cycle < 3; ++cycle)
+  {
+    EXPECT_EQ(
+      lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE,
+      slow_controller->get_lifecycle_state().id());
+    time += PERIOD;
+    EXPECT_EQ(controller_interface::return_type::OK, cm_->step(time, PERIOD));
+  }
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
+    slow_controller->get_lifecycle_state().id());
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE,
+    fallback_controller->get_lifecycle_state().id());
+  EXPECT_EQ(5u, slow_controller->internal_counter);
+}
+
+TEST_F(TestControllerManagerExecutionTimeBudget, sustained_violation_demotes_controller_to_async)
+{
+  auto slow_controller = add_test_controller(
+    "slow_controller", 1000.0, controller_manager::BudgetViolationPolicy::ASYNC);
+  activate_with_step({"slow_controller"});
+  ASSERT_FALSE(slow_controller->is_async());
+
+  slow_controller->update_processing_time = 0.003;
+  rclcpp::Time time = time_;
+  for (unsigned int cycle = 0; cycle < 3; ++cycle)
+  {
+    EXPECT_FALSE(slow_controller->is_async());
+    time += PERIOD;
+    EXPECT_EQ(controller_interface::return_type::OK, cm_->step(time, PERIOD));
+  }
+  EXPECT_TRUE(slow_controller->is_async());
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, slow_controller->get_lifecycle_state().id());
+
+  // the following updates are triggered in the async thread
+  const auto start_counter = slow_controller->internal_counter;
+  for (unsigned int cycle = 0; cycle < 10; ++cycle)
+  {
+    time += PERIOD;
+    EXPECT_EQ(controller_interface::return_type::OK, cm_->step(time, PERIOD));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_GT(slow_controller->internal_counter, start_counter);
+}
+
+class TestControllerManagerRateDomains : public TestControllerManagerWithParameters
+{
+public:
+  void SetUp() override
+  {
+    TestControllerManagerWithParameters::SetUp();
+    reset_controller_manager(
+      {rclcpp::Parameter("rate_domains.names", std::vector<std::string>{"fast"}),
+       rclcpp::Parameter("rate_domains.fast.update_rate", 1000),
+       rclcpp::Parameter(
+         "rate_domains.fast.hardware_components",
+         std::vector<std::string>{ros2_control_test_assets::TEST_ACTUATOR_HARDWARE_NAME})});
+  }
+
+  std::shared_ptr<test_controller::TestController> add_test_controller(
+    const std::string & name, unsigned int rate_domain, const std::string & command_interface)
+  {
+    auto test_controller = std::make_shared<test_controller::TestController>();
+    test_controller->set_command_interface_configuration(
+      {controller_interface::interface_configuration_type::INDIVIDUAL, {command_interface}});
+    controller_manager::ControllerSpec controller_spec;
+    controller_spec.c = test_controller;
+    controller_spec.info.name = name;
+    controller_spec.info.type = test_controller::TEST_CONTROLLER_CLASS_NAME;
+    controller_spec.last_update_cycle_time = std::make_shared<rclcpp::Time>(0);
+    controller_spec.rate_domain = rate_domain;
+    cm_->add_controller(controller_spec);
+    {
+      ControllerManagerRunner cm_runner(this);
+      cm_->configure_controller(name);
+    }
+    return test_controller;
+  }
+};
+
+TEST_F(TestControllerManagerRateDomains, controllers_are_updated_by_their_rate_domain)
+{
+  ASSERT_THAT(cm_->get_rate_domains(), testing::SizeIs(1));
+  EXPECT_EQ(1000u, cm_->get_rate_domains()[0].update_rate);
+  auto fast_controller = add_test_controller("fast_controller", 1, "joint1/position");
+  auto main_controller = add_test_controller("main_controller", 0, "joint2/velocity");
+  // the states of the fast rate domain are read by the main control loop through a published copy
+  main_controller->set_state_interface_configuration(
+    {controller_interface::interface_configuration_type::INDIVIDUAL, {"joint1/position"}});
+  EXPECT_EQ(1000u, fast_controller->get_update_rate());
+  EXPECT_EQ(cm_->get_update_rate(), main_controller->get_update_rate());
+
+  // the commands of the fast rate domain can't be claimed by the main control loop
+  auto wrong_controller = add_test_controller("wrong_controller", 0, "joint1/max_velocity");
+  EXPECT_EQ(
+    controller_interface::return_type::ERROR,
+    cm_->switch_controller(
+      {"wrong_controller"}, {}, STRICT, true, rclcpp::Duration::from_seconds(0.0)));
+
+  const std::vector<std::string> controller_names = {"fast_controller", "main_controller"};
+  auto switch_future = std::async(
+    std::launch::async, &controller_manager::ControllerManager::switch_controller, cm_,
+    controller_names, std::vector<std::string>{}, STRICT, true, rclcpp::Duration(0, 0));
+  ASSERT_EQ(std::future_status::timeout, switch_future.wait_for(std::chrono::milliseconds(100)))
+    << "switch_controller should be blocking until next step";
+  EXPECT_EQ(controller_interface::return_type::OK, cm_->step(time_, PERIOD));
+  ASSERT_EQ(controller_interface::return_type::OK, switch_future.get());
+  ASSERT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, fast_controller->get_lifecycle_state().id());
+  EXPECT_EQ(0u, fast_controller->internal_counter);
+
+  const rclcpp::Duration fast_period = rclcpp::Duration::from_seconds(0.001);
+  rclcpp::Time time = time_;
+  for (unsigned int cycle = 0; cycle < 10; ++cycle)
+  {
+    time += fast_period;
+    EXPECT_EQ(controller_interface::return_type::OK, cm_->update_rate_domain(1, time, fast_period));
+  }
+  EXPECT_EQ(10u, fast_controller->internal_counter);
+  const auto main_counter = main_controller->internal_counter;
+
+  // the main control loop doesn't update the controllers of the rate domain
+  EXPECT_EQ(controller_interface::return_type::OK, cm_->step(time, PERIOD));
+  EXPECT_EQ(10u, fast_controller->internal_counter);
+  EXPECT_EQ(main_counter + 1u, main_controller->internal_counter);
+  EXPECT_EQ(0u, cm_->get_rate_domain_skipped_cycles(1));
+
+  EXPECT_EQ(
+    controller_interface::return_type::ERROR, cm_->update_rate_domain(2, time, fast_period));
+}
+
+TEST_F(TestControllerManagerRateDomains, non_realtime_switch_waits_for_the_rate_domain_cycle)
+{
+  auto fast_controller = add_test_controller("fast_controller", 1, "joint1/position");
+
+  // the rate domain is running its cycles while the controller is switched
+  std::atomic_bool stop_rate_domain{false};
+  std::thread rate_domain_thread(
+    [&]()
+    {
+      const rclcpp::Duration fast_period = rclcpp::Duration::from_seconds(0.001);
+      rclcpp::Time time = time_;
+      while (!stop_rate_domain)
+      {
+        time += fast_period;
+        cm_->update_rate_domain(1, time, fast_period);
+      }
+    });
+
+  EXPECT_EQ(
+    controller_interface::return_type::OK,
+    cm_->switch_controller(
+      {"fast_controller"}, {}, STRICT, false, rclcpp::Duration::from_seconds(0.0)));
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, fast_controller->get_lifecycle_state().id());
+
+  EXPECT_EQ(
+    controller_interface::return_type::OK,
+    cm_->switch_controller(
+      {}, {"fast_controller"}, STRICT, false, rclcpp::Duration::from_seconds(0.0)));
+  EXPECT_EQ(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE,
+    fast_controller->get_lifecycle_state().id());
+
+  stop_rate_domain = true;
+  rate_domain_thread.join();
+}
@@ -0,0 +1,168 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "controller_manager/cpu_placement.hpp"
+
+using controller_manager::CpuPlacementPlanner;
+using controller_manager::CpuTopology;
+using controller_manager::parse_cpu_list;
+using ::testing::ElementsAre;
+using ::testing::HasSubstr;
+
+namespace
+{
+/// Fake sysfs of 4 cores with 2 SMT threads each, CPU i and i + 4 are siblings. The cores 0 and 1
+/// share an L3 cache, as do the cores 2 and 3.
+class FakeSysfs
+{
+public:
+  explicit FakeSysfs(const std::string & isolated)
+  : path_(
+      std::filesystem::temp_directory_path() /
+      ("test_cpu_placement_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) +
+       "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name()))
+  {
+    std::filesystem::remove_all(path_);
+    write("online", "0-7\n");
+    write("isolated", isolated + "\n");
+    for (int cpu = 0; cpu < 8; ++cpu)
+    {
+      const int core = cpu % 4;
+      const std::string siblings = std::to_string(core) + "," + std::to_string(core + 4);
+      const std::string l3 = core < 2 ? "0-1,4-5" : "2-3,6-7";
+      const std::string prefix = "cpu" + std::to_string(cpu) + "/";
+      write(prefix + "topology/core_id", std::to_string(core));
+      write(prefix + "topology/physical_package_id", "0");
+      write(prefix + "topology/thread_siblings_list", siblings);
+      write_cache(prefix + "cache/index0/", "1", "Data", siblings);
+      write_cache(prefix + "cache/index1/", "1", "Instruction", siblings);
+      write_cache(prefix + "cache/index2/", "2", "Unified", siblings);
+      write_cache(prefix + "cache/index3/", "3", "Unified", l3);
+    }
+  }
+
+  ~FakeSysfs() { std::filesystem::remove_all(path_); }
+
+  std::string get_path() const { return path_.string(); }
+
+private:
+  void write(const std::string & file, const std::string & content)
+  {
+    const auto file_path = path_ / file;
+    std::filesystem::create_directories(file_path.parent_path());
+    std::ofstream(file_path) << content;
+  }
+
+  void write_cache(
+    const std::string & prefix, const std::string & level, const std::string & type,
+    const std::string & shared_cpus)
+  {
+    write(prefix + "level", level);
+    write(prefix + "type", type);
+    write(prefix + "shared_cpu_list", shared_cpus);
+  }
+
+  std::filesystem::path path_;
+};
+}  // namespace
+
+TEST(TestCpuPlacement, parse_cpu_list)
+{
+  EXPECT_THAT(parse_cpu_list("0-3,8"), ElementsAre(0, 1, 2, 3, 8));
+  EXPECT_THAT(parse_cpu_list(" 5,1,1\n"), ElementsAre(1, 5));
+  EXPECT_TRUE(parse_cpu_list("").empty());
+  EXPECT_TRUE(parse_cpu_list("\n").empty());
+  EXPECT_THROW(parse_cpu_list("3-1"), std::invalid_argument);
+  EXPECT_THROW(parse_cpu_list("1,,2"), std::invalid_argument);
+  EXPECT_THROW(parse_cpu_list("cpu1"), std::invalid_argument);
+}
+
+TEST(TestCpuPlacement, read_topology)
+{
+  FakeSysfs sysfs("3,7");
+  const auto topology = CpuTopology::read(sysfs.get_path());
+  ASSERT_EQ(8u, topology.cpus.size());
+  const auto * cpu = topology.find(5);
+  ASSERT_NE(nullptr, cpu);
+  EXPECT_EQ(1, cpu->core_id);
+  EXPECT_EQ(0, cpu->package_id);
+  EXPECT_THAT(cpu->smt_siblings, ElementsAre(1, 5));
+  EXPECT_EQ(0, cpu->last_level_cache);
+  EXPECT_FALSE(cpu->isolated);
+  EXPECT_EQ(2, topology.find(6)->last_level_cache);
+  EXPECT_TRUE(topology.find(7)->isolated);
+  EXPECT_EQ(nullptr, topology.find(8));
+
+  EXPECT_TRUE(CpuTopology::read(sysfs.get_path() + "/missing").cpus.empty());
+  EXPECT_EQ(std::nullopt, CpuPlacementPlanner(CpuTopology{}).place("main"));
+}
+
+TEST(TestCpuPlacement, place_threads_on_separate_cores_sharing_the_cache_with_their_partner)
+{
+  FakeSysfs sysfs("");
+  CpuPlacementPlanner planner(CpuTopology::read(sysfs.get_path()));
+
+  // the core of CPU 0 is used last for a thread without partner
+  EXPECT_EQ(1, planner.place("main"));
+  EXPECT_EQ(1, planner.place("main"));
+  // the last free core sharing the L3 cache with the partner, instead of the sibling of CPU 1
+  EXPECT_EQ(0, planner.place("hardware/arm", "main"));
+  EXPECT_TRUE(planner.get_placement("hardware/arm")->shares_cache_with_partner);
+  EXPECT_EQ(2, planner.place("controller/arm_controller", "main"));
+  EXPECT_FALSE(planner.get_placement("controller/arm_controller")->shares_cache_with_partner);
+  EXPECT_EQ(3, planner.place("rate_domain/fast", "main"));
+  // all physical cores are used, the SMT siblings are not assigned
+  EXPECT_EQ(std::nullopt, planner.place("controller/gripper_controller", "main"));
+  EXPECT_THAT(
+    planner.to_string(),
+    HasSubstr("'controller/gripper_controller': not placed, no physical core is free"));
+
+  planner.release("controller/arm_controller");
+  EXPECT_EQ(nullptr, planner.get_placement("controller/arm_controller"));
+  EXPECT_EQ(2, planner.place("controller/gripper_controller", "main"));
+  EXPECT_THAT(
+    planner.to_string(),
+    HasSubstr("'hardware/arm': CPU 0 (core 0 of package 0), sharing the last level cache with "
+              "'main'"));
+}
+
+TEST(TestCpuPlacement, prefer_isolated_cpus_and_respect_configured_cpus)
+{
+  FakeSysfs sysfs("2-3,6-7");
+  CpuPlacementPlanner planner(CpuTopology::read(sysfs.get_path()));
+
+  planner.reserve("main", {6});
+  EXPECT_TRUE(planner.get_placement("main")->configured);
+  // the sibling of the configured CPU is not used
+  EXPECT_EQ(3, planner.place("hardware/arm", "main"));
+  EXPECT_TRUE(planner.get_placement("hardware/arm")->shares_cache_with_partner);
+  // no isolated core is left
+  EXPECT_EQ(1, planner.place("controller/arm_controller", "hardware/arm"));
+  EXPECT_THAT(planner.to_string(), HasSubstr("'main': CPU 6 (configured)"));
+  EXPECT_THAT(
+    planner.to_string(), HasSubstr("'hardware/arm': CPU 3 (core 3 of package 0, isolated)"));
+
+  // CPUs that are not online are ignored
+  planner.reserve("rate_domain/fast", {0, 42});
+  EXPECT_THAT(planner.get_placement("rate_domain/fast")->cpus, ElementsAre(0));
+  EXPECT_EQ(std::nullopt, planner.place("controller/gripper_controller"));
+}
@@ -0,0 +1,120 @@
+# Copyright 2025 ros2_control development team
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+import xml.etree.ElementTree as ET
+
+import pytest
+import yaml
+
+from controller_manager.load_generator_config import (
+    generate_controllers_config,
+    generate_robot_description,
+    joint_names,
+    load_parameters,
+    main,
+)
+
+
+def test_robot_description_contains_components_and_joints():
+    urdf = generate_robot_description(3, 2, load_parameters(cpu_time_us=20, seed=5))
+    robot = ET.fromstring(urdf)
+    assert len(robot.findall("joint")) == 6
+    components = robot.findall("ros2_control")
+    assert len(components) == 3
+    for index, component in enumerate(components):
+        assert component.find("hardware/plugin").text == "mock_components/LoadGeneratorSystem"
+        parameters = {p.get("name"): p.text for p in component.findall("hardware/param")}
+        assert parameters["cpu_time_us"] == "20.0"
+        assert parameters["seed"] == str(5 + index)
+        assert [j.get("name") for j in component.findall("joint")] == [
+            f"joint{2 * index}",
+            f"joint{2 * index + 1}",
+        ]
+
+
+def test_controllers_are_chained_and_claim_each_interface_once():
+    joints = joint_names(2, 3)
+    config = generate_controllers_config(5, 2, joints, 2000, load_parameters(cpu_time_us=5))
+    assert config["controller_manager"]["ros__parameters"]["update_rate"] == 2000
+    controllers = {
+        name: parameters["ros__parameters"]
+        for name, parameters in config.items()
+        if name != "controller_manager"
+    }
+    assert len(controllers) == 5
+
+    # chains: [0, 1], [2, 3], [4], the joints are distributed round-robin over them
+    assert controllers["load_generator_0"]["command_interfaces"] == [
+        "load_generator_1/joint0/position",
+        "load_generator_1/joint3/position",
+    ]
+    assert "reference_interfaces" not in controllers["load_generator_0"]
+    assert controllers["load_generator_1"]["reference_interfaces"] == [
+        "joint0/position",
+        "joint3/position",
+    ]
+    assert controllers["load_generator_1"]["command_interfaces"] == [
+        "joint0/position",
+        "joint3/position",
+    ]
+    assert controllers["load_generator_4"]["command_interfaces"] == [
+        "joint2/position",
+        "joint5/position",
+    ]
+
+    claimed = [c for p in controllers.values() for c in p.get("command_interfaces", [])]
+    assert len(claimed) == len(set(claimed))
+    hardware_commands = [c for c in claimed if not c.startswith("load_generator_")]
+    assert sorted(hardware_commands) == sorted(f"{joint}/position" for joint in joints)
+
+    with pytest.raises(ValueError):
+        generate_controllers_config(1, 0, joints, 2000, load_parameters())
+
+
+def test_controllers_without_joints_omit_empty_lists():
+    config = generate_controllers_config(3, 1, joint_names(1, 1), 1000, load_parameters())
+    assert "command_interfaces" not in config["load_generator_2"]["ros__parameters"]
+    assert "state_interfaces" not in config["load_generator_2"]["ros__parameters"]
+
+
+def test_files_are_written(tmp_path):
+    output_dir = str(tmp_path / "load")
+    assert (
+        main(
+            [
+                "--output-dir",
+                output_dir,
+                "--hardware-components",
+                "2",
+                "--joints-per-component",
+                "4",
+                "--controllers",
+                "4",
+                "--chain-length",
+                "2",
+                "--controller-jitter-distribution",
+                "exponential",
+            ]
+        )
+        == 0
+    )
+    with open(os.path.join(output_dir, "load_generator_controllers.yaml")) as config_file:
+        config = yaml.safe_load(config_file)
+    assert config["load_generator_3"]["ros__parameters"]["jitter_distribution"] == "exponential"
+    ET.parse(os.path.join(output_dir, "load_generator.urdf"))
+    with open(os.path.join(output_dir, "load_generator.launch.py")) as launch_file:
+        launch = launch_file.read()
+    compile(launch, "load_generator.launch.py", "exec")
+    assert "'load_generator_0', 'load_generator_1'" in launch
@@ -0,0 +1,143 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "controller_manager/load_generator_controller.hpp"
+#include "gmock/gmock.h"
+#include "hardware_interface/loaned_command_interface.hpp"
+#include "hardware_interface/loaned_state_interface.hpp"
+#include "lifecycle_msgs/msg/state.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+using controller_manager::LoadGeneratorController;
+using hardware_interface::CommandInterface;
+using hardware_interface::InterfaceDescription;
+using hardware_interface::InterfaceInfo;
+using hardware_interface::StateInterface;
+
+namespace
+{
+constexpr char CONTROLLER_NAME[] = "load_generator";
+const auto TIME = rclcpp::Time(0, 0, RCL_ROS_TIME);
+const auto PERIOD = rclcpp::Duration::from_seconds(0.0005);
+
+InterfaceDescription make_description(const std::string & initial_value)
+{
+  InterfaceInfo info;
+  info.name = "position";
+  info.initial_value = initial_value;
+  return InterfaceDescription("joint1", info);
+}
+}  // namespace
+
+class TestLoadGeneratorController : public ::testing::Test
+{
+public:
+  static void SetUpTestCase() { rclcpp::init(0, nullptr); }
+
+  static void TearDownTestCase() { rclcpp::shutdown(); }
+
+protected:
+  void init_controller(double failure_rate)
+  {
+    controller_interface::ControllerInterfaceParams params;
+    params.controller_name = CONTROLLER_NAME;
+    params.update_rate = 2000;
+    params.node_options = controller_.define_custom_node_options();
+    params.node_options.parameter_overrides(
+      {{"command_interfaces", std::vector<std::string>{"joint1/position"}},
+       {"state_interfaces", std::vector<std::string>{"joint1/position"}},
+       {"reference_interfaces", std::vector<std::string>{"joint1/position"}},
+       {"exported_state_interfaces", std::vector<std::string>{"joint1/position"}},
+       {"cpu_time_us", 100.0},
+       {"cache_footprint_bytes", 65536},
+       {"jitter_distribution", "normal"},
+       {"jitter_us", 5.0},
+       {"failure_rate", failure_rate}});
+    ASSERT_EQ(controller_.init(params), controller_interface::return_type::OK);
+  }
+
+  void assign_interfaces()
+  {
+    std::vector<hardware_interface::LoanedCommandInterface> command_interfaces;
+    command_interfaces.emplace_back(command_);
+    std::vector<hardware_interface::LoanedStateInterface> state_interfaces;
+    state_interfaces.emplace_back(state_);
+    controller_.assign_interfaces(std::move(command_interfaces), std::move(state_interfaces));
+  }
+
+  LoadGeneratorController controller_;
+  std::shared_ptr<StateInterface> state_ =
+    std::make_shared<StateInterface>(make_description("1.5"));
+  std::shared_ptr<CommandInterface> command_ =
+    std::make_shared<CommandInterface>(make_description("0.0"));
+};
+
+TEST_F(TestLoadGeneratorController, interfaces_are_configured_by_parameters)
+{
+  init_controller(0.0);
+  ASSERT_EQ(controller_.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+  EXPECT_THAT(
+    controller_.command_interface_configuration().names, testing::ElementsAre("joint1/position"));
+  EXPECT_THAT(
+    controller_.state_interface_configuration().names, testing::ElementsAre("joint1/position"));
+  const auto reference_interfaces = controller_.export_reference_interfaces();
+  ASSERT_THAT(reference_interfaces, testing::SizeIs(1));
+  EXPECT_EQ("load_generator/joint1/position", reference_interfaces[0]->get_name());
+  const auto state_interfaces = controller_.export_state_interfaces();
+  ASSERT_THAT(state_interfaces, testing::SizeIs(1));
+  EXPECT_EQ(
+    std::chrono::microseconds(100), controller_.get_synthetic_load().get_parameters().cpu_time);
+}
+
+TEST_F(TestLoadGeneratorController, states_and_references_are_forwarded_with_synthetic_load)
+{
+  init_controller(0.0);
+  ASSERT_EQ(controller_.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+  const auto reference_interfaces = controller_.export_reference_interfaces();
+  const auto exported_state_interfaces = controller_.export_state_interfaces();
+  assign_interfaces();
+
+  // without a preceding controller, the state is forwarded
+  ASSERT_EQ(controller_.update(TIME, PERIOD), controller_interface::return_type::OK);
+  EXPECT_DOUBLE_EQ(1.5, command_->get_optional().value());
+  EXPECT_DOUBLE_EQ(1.5, exported_state_interfaces[0]->get_optional().value());
+  EXPECT_GE(controller_.get_synthetic_load().get_last_cycle_time(), std::chrono::microseconds(50));
+
+  ASSERT_TRUE(controller_.set_chained_mode(true));
+  ASSERT_TRUE(reference_interfaces[0]->set_value(2.5));
+  ASSERT_EQ(controller_.update(TIME, PERIOD), controller_interface::return_type::OK);
+  EXPECT_DOUBLE_EQ(2.5, command_->get_optional().value());
+}
+
+TEST_F(TestLoadGeneratorController, synthetic_failures_are_reported_by_update)
+{
+  init_controller(1.0);
+  ASSERT_EQ(controller_.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+  std::ignore = controller_.export_reference_interfaces();
+  std::ignore = controller_.export_state_interfaces();
+  assign_interfaces();
+  EXPECT_EQ(controller_.update(TIME, PERIOD), controller_interface::return_type::ERROR);
+}
+
+TEST_F(TestLoadGeneratorController, invalid_load_fails_configuration)
+{
+  init_controller(-0.5);
+  EXPECT_NE(controller_.configure().id(), lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+}
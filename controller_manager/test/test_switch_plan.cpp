@@ -0,0 +1,258 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "controller_manager/controller_manager.hpp"
+#include "controller_manager_test_common.hpp"
+#include "gmock/gmock.h"
+#include "lifecycle_msgs/msg/state.hpp"
+#include "test_controller/test_controller.hpp"
+
+/// Test controller counting the cancelled activations, with a configurable preparation result
+class TestControllerWithPreparation : public test_controller::TestController
+{
+public:
+  controller_interface::CallbackReturn on_prepare_activation(
+    const rclcpp_lifecycle::State & /*previous_state*/) override
+  {
+    return prepare_activation_result;
+  }
+
+  controller_interface::CallbackReturn on_cancel_activation(
+    const rclcpp_lifecycle::State & /*previous_state*/) override
+  {
+    ++cancel_activation_calls;
+    return controller_interface::CallbackReturn::SUCCESS;
+  }
+
+  controller_interface::CallbackReturn prepare_activation_result =
+    controller_interface::CallbackReturn::SUCCESS;
+  size_t cancel_activation_calls = 0;
+};
+
+class TestSwitchPlan : public ControllerManagerFixture<controller_manager::ControllerManager>
+{
+public:
+  std::vector<std::shared_ptr<TestControllerWithPreparation>> add_test_controllers(
+    size_t number_of_controllers)
+  {
+    std::vector<std::shared_ptr<TestControllerWithPreparation>> controllers;
+    for (size_t i = 0; i < number_of_controllers; ++i)
+    {
+      auto controller = std::make_shared<TestControllerWithPreparation>();
+      const std::string name = "test_controller_" + std::to_string(i);
+      cm_->add_controller(controller, name, test_controller::TEST_CONTROLLER_CLASS_NAME);
+      EXPECT_EQ(controller_interface::return_type::OK, cm_->configure_controller(name));
+      controller_names_.push_back(name);
+      controllers.push_back(controller);
+    }
+    return controllers;
+  }
+
+  std::vector<std::string> controller_names_;
+};
+
+TEST_F(TestSwitchPlan, prepared_switch_is_executed_and_outdated_afterwards)
+{
+  // the controllers list is only swapped when the control loop is running
+  ControllerManagerRunner cm_runner(this);
+  auto controllers = add_test_controllers(2);
+
+  controller_manager::SwitchPlan activate_plan;
+  std::string message;
+  ASSERT_EQ(
+    controller_interface::return_type::OK,
+    cm_->prepare_switch(controller_names_, {}, STRICT, activate_plan, message));
+  ASSERT_EQ(2u, activate_plan.activate_request.size());
+  ASSERT_EQ(2u, activate_plan.activate_indices.size());
+  ASSERT_TRUE(activate_plan.deactivate_request.empty());
+
+  // preparing doesn't change the state of the controllers
+  for (const auto & controller : controllers)
+  {
+    EXPECT_EQ(
+      lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, controller->get_lifecycle_state().id());
+  }
+
+  // the deactivation can't be prepared while the controllers are inactive
+  controller_manager::SwitchPlan deactivate_plan;
+  EXPECT_EQ(
+    controller_interface::return_type::ERROR,
+    cm_->prepare_switch({}, controller_names_, STRICT, deactivate_plan, message));
+
+  EXPECT_EQ(
+    controller_interface::return_type::OK,
+    cm_->execute_switch(activate_plan, false, rclcpp::Duration(0, 0), message));
+  for (const auto & controller : controllers)
+  {
+    EXPECT_EQ(
+      lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, controller->get_lifecycle_state().id());
+    // the non real-time phase of the activation is run before handing the switch to the loop
+    EXPECT_TRUE(controller->is_activation_prepared());
+  }
+
+  // the controllers are already active, so the plan is outdated
+  EXPECT_EQ(
+    controller_interface::return_type::ERROR,
+    cm_->execute_switch(activate_plan, false, rclcpp::Duration(0, 0), message));
+  EXPECT_THAT(message, testing::HasSubstr("outdated"));
+
+  ASSERT_EQ(
+    controller_interface::return_type::OK,
+    cm_->prepare_switch({}, controller_names_, STRICT, deactivate_plan, message));
+  EXPECT_EQ(
+    controller_interface::return_type::OK,
+    cm_->execute_switch(deactivate_plan, false, rclcpp::Duration(0, 0), message));
+  for (const auto & controller : controllers)
+  {
+    EXPECT_EQ(
+      lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, controller->get_lifecycle_state().id());
+  }
+
+  // after deactivation the activation plan can be executed again
+  EXPECT_EQ(
+    controller_interface::return_type::OK,
+    cm_->execute_switch(activate_plan, false, rclcpp::Duration(0, 0), message));
+}
+
+TEST_F(TestSwitchPlan, aborted_strict_switch_cancels_the_prepared_activations)
+{
+  ControllerManagerRunner cm_runner(this);
+  auto controllers = add_test_controllers(2);
+  controllers[1]->prepare_activation_result = controller_interface::CallbackReturn::ERROR;
+
+  controller_manager::SwitchPlan activate_plan;
+  std::string message;
+  ASSERT_EQ(
+    controller_interface::return_type::OK,
+    cm_->prepare_switch(controller_names_, {}, STRICT, activate_plan, message));
+  EXPECT_EQ(
+    controller_interface::return_type::ERROR,
+    cm_->execute_switch(activate_plan, false, rclcpp::Duration(0, 0), message));
+  EXPECT_THAT(message, testing::HasSubstr(controller_names_[1]));
+
+  // the first controller was prepared before the second one failed, its preparation is undone
+  EXPECT_FALSE(controllers[0]->is_activation_prepared());
+  EXPECT_EQ(1u, controllers[0]->cancel_activation_calls);
+  EXPECT_FALSE(controllers[1]->is_activation_prepared());
+  EXPECT_EQ(0u, controllers[1]->cancel_activation_calls);
+  for (const auto & controller : controllers)
+  {
+    EXPECT_EQ(
+      lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, controller->get_lifecycle_state().id());
+  }
+
+  // the switch succeeds once the second controller can be prepared
+  controllers[1]->prepare_activation_result = controller_interface::CallbackReturn::SUCCESS;
+  EXPECT_EQ(
+    controller_interface::return_type::OK,
+    cm_->execute_switch(activate_plan, false, rclcpp::Duration(0, 0), message));
+  for (const auto & controller : controllers)
+  {
+    EXPECT_EQ(
+      lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, controller->get_lifecycle_state().id());
+  }
+  EXPECT_EQ(1u, controllers[0]->cancel_activation_calls);
+}
+
+TEST_F(TestSwitchPlan, empty_plan_is_not_executed)
+{
+  controller_manager::SwitchPlan plan;
+  std::string message;
+  EXPECT_EQ(
+    controller_interface::return_type::OK,
+    cm_->execute_switch(plan, false, rclcpp::Duration(0, 0), message));
+  EXPECT_THAT(message, testing::HasSubstr("empty"));
+}
+
+class TestSwitchLatency : public TestSwitchPlan,
+                          public testing::WithParamInterface<std::tuple<size_t, bool>>
+{
+};
+
+// Measures the latency from the switch request until the controllers are active, once with the
+// switch being validated and executed at the request (switch_controller) and once with a plan
+// that was prepared beforehand (execute_switch). With activate_asap, the switch is executed by the
+// control loop of the ControllerManagerRunner. The results are reported as test properties.
+TEST_P(TestSwitchLatency, request_to_active_latency)
+{
+  const auto [number_of_controllers, activate_asap] = GetParam();
+  constexpr int kRepetitions = 10;
+  // the controllers list is only swapped when the control loop is running
+  ControllerManagerRunner cm_runner(this);
+  auto controllers = add_test_controllers(number_of_controllers);
+
+  std::string message;
+  controller_manager::SwitchPlan activate_plan;
+  controller_manager::SwitchPlan deactivate_plan;
+  double switch_controller_time = 0.0;
+  double execute_switch_time = 0.0;
+  for (int i = 0; i < kRepetitions; ++i)
+  {
+    auto start_time = std::chrono::steady_clock::now();
+    ASSERT_EQ(
+      controller_interface::return_type::OK,
+      cm_->switch_controller(
+        controller_names_, {}, STRICT, activate_asap, rclcpp::Duration(0, 0)));
+    switch_controller_time +=
+      std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
+        .count();
+    ASSERT_EQ(
+      controller_interface::return_type::OK,
+      cm_->switch_controller(
+        {}, controller_names_, STRICT, activate_asap, rclcpp::Duration(0, 0)));
+
+    ASSERT_EQ(
+      controller_interface::return_type::OK,
+      cm_->prepare_switch(controller_names_, {}, STRICT, activate_plan, message));
+    start_time = std::chrono::steady_clock::now();
+    ASSERT_EQ(
+      controller_interface::return_type::OK,
+      cm_->execute_switch(activate_plan, activate_asap, rclcpp::Duration(0, 0), message));
+    execute_switch_time +=
+      std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
+        .count();
+    for (const auto & controller : controllers)
+    {
+      ASSERT_EQ(
+        lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, controller->get_lifecycle_state().id());
+    }
+    ASSERT_EQ(
+      controller_interface::return_type::OK,
+      cm_->prepare_switch({}, controller_names_, STRICT, deactivate_plan, message));
+    ASSERT_EQ(
+      controller_interface::return_type::OK,
+      cm_->execute_switch(deactivate_plan, activate_asap, rclcpp::Duration(0, 0), message));
+  }
+
+  switch_controller_time /= kRepetitions;
+  execute_switch_time /= kRepetitions;
+  RCLCPP_INFO(
+    cm_->get_logger(),
+    "Activating %zu controllers (activate_asap: %s): switch_controller took %.1f us, "
+    "execute_switch took %.1f us",
+    number_of_controllers, activate_asap ? "true" : "false", switch_controller_time,
+    execute_switch_time);
+  RecordProperty("switch_controller_us", std::to_string(switch_controller_time));
+  RecordProperty("execute_switch_us", std::to_string(execute_switch_time));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  number_of_controllers_and_activate_asap, TestSwitchLatency,
+  testing::Combine(testing::Values<size_t>(1u, 10u, 100u), testing::Bool()));
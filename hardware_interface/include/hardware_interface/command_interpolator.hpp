@@ -0,0 +1,103 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__COMMAND_INTERPOLATOR_HPP_
+#define HARDWARE_INTERFACE__COMMAND_INTERPOLATOR_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hardware_interface
+{
+/// Interpolation of the commands between two cycles of the controller manager
+enum class CommandInterpolation : uint8_t
+{
+  NONE,
+  LINEAR,
+  CUBIC
+};
+
+/// Name of the parameter of a command interface selecting its interpolation
+constexpr auto kCommandInterpolationParameter = "interpolation";
+
+/// Converts the value of the `interpolation` parameter of a command interface.
+/**
+ * \param[in] interpolation "none", "linear" or "cubic", case insensitive.
+ * \returns the interpolation.
+ * \throws std::invalid_argument if the value is unknown.
+ */
+CommandInterpolation parse_command_interpolation(const std::string & interpolation);
+
+/// Interpolates the setpoints of a command interface for hardware running faster than the loop.
+/**
+ * The setpoints are added with the time of the cycle of the controller manager they were written
+ * in. The interpolated command moves from the previous to the latest setpoint within the time
+ * between them, i.e., it is delayed by one cycle of the controller manager and reaches the latest
+ * setpoint when the next one is expected. Linear interpolation is continuous, cubic interpolation
+ * is a Hermite spline starting with the slope of the previous segment and ending with the slope
+ * between the previous and the latest setpoint, thus also continuous in the velocity.
+ *
+ * Real-time safe, the last three setpoints are kept in a fixed-size buffer.
+ */
+class CommandInterpolator
+{
+public:
+  explicit CommandInterpolator(CommandInterpolation interpolation = CommandInterpolation::LINEAR)
+  : interpolation_(interpolation)
+  {
+  }
+
+  /// Adds the setpoint of a cycle of the controller manager.
+  /**
+   * A setpoint with the time of the latest one replaces it. A non-finite setpoint, e.g., NaN to
+   * stop commanding, is not interpolated: the interpolation restarts after it.
+   *
+   * \param[in] time time of the cycle in nanoseconds.
+   * \param[in] value the setpoint.
+   */
+  void add_setpoint(int64_t time, double value);
+
+  /// Get the interpolated command at the given time.
+  /**
+   * \param[in] time time in nanoseconds, e.g., of the write() call of the hardware component.
+   * \returns the interpolated command, the latest setpoint before the second setpoint or if the
+   * interpolation is disabled, NaN without setpoints.
+   */
+  double interpolate(int64_t time) const;
+
+  /// Removes all setpoints, e.g., when the hardware component is activated.
+  void reset() { number_of_setpoints_ = 0; }
+
+  size_t get_number_of_setpoints() const { return number_of_setpoints_; }
+
+  CommandInterpolation get_interpolation() const { return interpolation_; }
+
+private:
+  struct Setpoint
+  {
+    int64_t time = 0;
+    double value = 0.0;
+  };
+
+  CommandInterpolation interpolation_;
+  /// The latest setpoints, the oldest first
+  std::array<Setpoint, 3> setpoints_{};
+  size_t number_of_setpoints_ = 0;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__COMMAND_INTERPOLATOR_HPP_
@@ -0,0 +1,107 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__DEADLINE_SCHEDULING_HPP_
+#define HARDWARE_INTERFACE__DEADLINE_SCHEDULING_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace hardware_interface
+{
+/// Reservation of a thread scheduled with the SCHED_DEADLINE (earliest deadline first) policy.
+/**
+ * The thread is guaranteed to get its runtime within the deadline of each period, as long as the
+ * sum of the reservations of the CPUs is admitted by the kernel. A zero runtime disables the
+ * policy.
+ */
+struct DeadlineSchedulingParams
+{
+  /// CPU time reserved for the thread in each period
+  std::chrono::microseconds runtime{0};
+  /// Time after the start of each period by which the runtime is served, the period if zero
+  std::chrono::microseconds deadline{0};
+  /// Period of the reservation, usually the period of the loop executed by the thread
+  std::chrono::microseconds period{0};
+
+  bool is_enabled() const { return runtime.count() > 0; }
+};
+
+/// Completes and validates the reservation of a thread.
+/**
+ * \param[in] params the reservation, the deadline and the period may be zero.
+ * \param[in] default_period the period used if the period of the reservation is zero, e.g., the
+ * period of the update rate of the loop.
+ * \returns the reservation with the deadline and the period set.
+ * \throws std::invalid_argument unless 0 < runtime <= deadline <= period.
+ */
+DeadlineSchedulingParams resolve_deadline_scheduling_params(
+  const DeadlineSchedulingParams & params, std::chrono::microseconds default_period);
+
+/// Schedules the calling thread with the SCHED_DEADLINE policy.
+/**
+ * The kernel signals runtime overruns of the thread with SIGXCPU, which are counted by the
+ * DeadlineOverrunCounter attached to the thread. The signal handler is installed with the first
+ * call, unless the application handles SIGXCPU itself.
+ *
+ * \param[in] params the resolved reservation, see resolve_deadline_scheduling_params().
+ * \returns true and an empty string if successful, false and the reason otherwise, e.g., if the
+ * admission control of the kernel rejects the reservation as the CPUs are overcommitted, or if the
+ * CPU affinity of the thread doesn't span all CPUs of its scheduling domain.
+ */
+std::pair<bool, std::string> configure_sched_deadline(const DeadlineSchedulingParams & params);
+
+/// Counts the runtime overruns of a thread scheduled with SCHED_DEADLINE.
+/**
+ * The overruns are counted by the SIGXCPU handler in a fixed table of threads, so that the signal
+ * handler is async-signal-safe and the counter can be read from any thread. Destroying the counter
+ * or attaching another thread stops counting the overruns of the attached thread.
+ */
+class DeadlineOverrunCounter
+{
+public:
+  /// Maximum number of threads whose overruns are counted at the same time
+  static constexpr size_t kMaxThreads = 64;
+
+  DeadlineOverrunCounter() = default;
+
+  ~DeadlineOverrunCounter() { detach(); }
+
+  DeadlineOverrunCounter(const DeadlineOverrunCounter &) = delete;
+  DeadlineOverrunCounter & operator=(const DeadlineOverrunCounter &) = delete;
+
+  /// Start counting the overruns of the calling thread.
+  /**
+   * \returns false if the overruns of kMaxThreads threads are already counted.
+   */
+  bool attach_to_current_thread();
+
+  /// Stop counting the overruns of the attached thread, its overruns are kept in the count.
+  void detach();
+
+  /// Number of runtime overruns of the threads attached to the counter.
+  uint64_t get_count() const;
+
+private:
+  std::atomic<int> slot_{-1};
+  std::atomic<uint64_t> detached_count_{0};
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__DEADLINE_SCHEDULING_HPP_
@@ -18,11 +18,17 @@
 #include <fmt/compile.h>
 
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <optional>
 #include <shared_mutex>
 #include <stdexcept>
@@ -34,8 +40,10 @@
 #include "hardware_interface/introspection.hpp"
 #include "hardware_interface/lexical_casts.hpp"
 #include "hardware_interface/macros.hpp"
+#include "hardware_interface/types/span.hpp"
 
 #include "rclcpp/logging.hpp"
+#include "rclcpp/time.hpp"
 
 namespace
 {
@@ -61,7 +69,14 @@ std::string get_type_name()
 namespace hardware_interface
 {
 
-using HANDLE_DATATYPE = std::variant<std::monostate, double, bool>;
+using HANDLE_DATATYPE =
+  std::variant<std::monostate, double, bool, float, int32_t, int64_t, uint8_t, uint16_t>;
+
+template <typename HandleType, typename T>
+class InterfaceAccessor;
+
+template <typename HandleType, typename T>
+class ArrayInterfaceAccessor;
 
 /// A handle used to get and set a value on a given interface.
 class Handle
@@ -76,44 +91,66 @@ public:
   {
   }
 
+  /**
+   * \param[in] prefix_name name of the joint, sensor or gpio the interface belongs to.
+   * \param[in] interface_name name of the interface.
+   * \param[in] data_type name of the data type of the values.
+   * \param[in] initial_value initial value, for arrays either a single value used for all
+   * elements or a list of all elements, e.g. "[1, 2, 3]".
+   * \param[in] size number of values, the interface is an array if it is greater than one.
+   */
   explicit Handle(
     const std::string & prefix_name, const std::string & interface_name,
-    const std::string & data_type = "double", const std::string & initial_value = "")
+    const std::string & data_type = "double", const std::string & initial_value = "",
+    size_t size = 1)
   : prefix_name_(prefix_name),
     interface_name_(interface_name),
     handle_name_(prefix_name_ + "/" + interface_name_),
-    data_type_(data_type)
+    data_type_(data_type),
+    size_(std::max<size_t>(size, 1u))
   {
     // As soon as multiple datatypes are used in HANDLE_DATATYPE
     // we need to initialize according the type passed in interface description
-    if (data_type_ == hardware_interface::HandleDataType::DOUBLE)
+    try
     {
-      try
-      {
-        value_ = initial_value.empty() ? std::numeric_limits<double>::quiet_NaN()
-                                       : hardware_interface::stod(initial_value);
-        value_ptr_ = std::get_if<double>(&value_);
-      }
-      catch (const std::invalid_argument & err)
+      switch (data_type_)
       {
-        throw std::invalid_argument(
-          fmt::format(
-            FMT_COMPILE("Invalid initial value: '{}' parsed for interface: '{}' with type: '{}'"),
-            initial_value, handle_name_, data_type_.to_string()));
+        case HandleDataType::DOUBLE:
+          initialize_value<double>(initial_value);
+          break;
+        case HandleDataType::BOOL:
+          initialize_value<bool>(initial_value);
+          break;
+        case HandleDataType::FLOAT:
+          initialize_value<float>(initial_value);
+          break;
+        case HandleDataType::INT32:
+          initialize_value<int32_t>(initial_value);
+          break;
+        case HandleDataType::INT64:
+          initialize_value<int64_t>(initial_value);
+          break;
+        case HandleDataType::UINT8:
+          initialize_value<uint8_t>(initial_value);
+          break;
+        case HandleDataType::UINT16:
+          initialize_value<uint16_t>(initial_value);
+          break;
+        default:
+          throw std::runtime_error(
+            fmt::format(
+              FMT_COMPILE(
+                "Invalid data type: '{}' for interface: {}. Supported types are double, bool, "
+                "float, int32, int64, uint8 and uint16."),
+              data_type, handle_name_));
       }
     }
-    else if (data_type_ == hardware_interface::HandleDataType::BOOL)
+    catch (const std::invalid_argument & err)
     {
-      value_ptr_ = nullptr;
-      value_ = initial_value.empty() ? false : hardware_interface::parse_bool(initial_value);
-    }
-    else
-    {
-      throw std::runtime_error(
+      throw std::invalid_argument(
         fmt::format(
-          FMT_COMPILE(
-            "Invalid data type: '{}' for interface: {}. Supported types are double and bool."),
-          data_type, handle_name_));
+          FMT_COMPILE("Invalid initial value: '{}' parsed for interface: '{}' with type: '{}'"),
+          initial_value, handle_name_, data_type_.to_string()));
     }
   }
 
@@ -121,8 +158,13 @@ public:
   : Handle(
       interface_description.get_prefix_name(), interface_description.get_interface_name(),
       interface_description.get_data_type_string(),
-      interface_description.interface_info.initial_value)
+      interface_description.interface_info.initial_value,
+      static_cast<size_t>(std::max(interface_description.interface_info.size, 1)))
   {
+    if (interface_description.memory.data)
+    {
+      bind_memory(interface_description.memory);
+    }
   }
 
   [[deprecated("Use InterfaceDescription for initializing the Interface")]]
@@ -178,10 +220,16 @@ public:
    * @note When different threads access the same handle at same instance, and if they are unable to
    * lock the handle to access the value, the handle returns std::nullopt. If the operation is
    * successful, the value is returned.
+   * @note If a copy of the value is published, see enable_published_copy(), the copy is read
+   * without locking the handle. std::nullopt is returned if it is being updated.
    */
   template <typename T = double>
   [[nodiscard]] std::optional<T> get_optional() const
   {
+    if (has_published_copy())
+    {
+      return get_published_value<T>();
+    }
     std::shared_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
     return get_optional<T>(lock);
   }
@@ -203,6 +251,10 @@ public:
     {
       return std::nullopt;
     }
+    if (is_array())
+    {
+      throw_scalar_access_on_array();
+    }
     // BEGIN (Handle export change): for backward compatibility
     // TODO(saikishor) return value_ if old functionality is removed
     if constexpr (std::is_same_v<T, double>)
@@ -210,6 +262,10 @@ public:
       switch (data_type_)
       {
         case HandleDataType::DOUBLE:
+          if (!value_ptr_ && external_data_)
+          {
+            return load_external<double>();
+          }
           THROW_ON_NULLPTR(value_ptr_);
           return *value_ptr_;
         case HandleDataType::BOOL:
@@ -224,7 +280,17 @@ public:
               get_name().c_str());
             notified_ = true;
           }
-          return static_cast<double>(std::get<bool>(value_));
+          return static_cast<double>(load_value<bool>());
+        case HandleDataType::FLOAT:
+          return static_cast<double>(load_value<float>());
+        case HandleDataType::INT32:
+          return static_cast<double>(load_value<int32_t>());
+        case HandleDataType::INT64:
+          return static_cast<double>(load_value<int64_t>());
+        case HandleDataType::UINT8:
+          return static_cast<double>(load_value<uint8_t>());
+        case HandleDataType::UINT16:
+          return static_cast<double>(load_value<uint16_t>());
         default:
           throw std::runtime_error(
             fmt::format(
@@ -232,6 +298,11 @@ public:
               data_type_.to_string(), get_name()));
       }
     }
+    if (external_data_)
+    {
+      check_data_type<T>();
+      return load_external<T>();
+    }
     try
     {
       return std::get<T>(value_);
@@ -279,50 +350,849 @@ public:
   template <typename T>
   [[nodiscard]] bool set_value(std::unique_lock<std::shared_mutex> & lock, const T & value)
   {
-    if (!lock.owns_lock())
+    if (!store_value(lock, value))
     {
       return false;
     }
-    // BEGIN (Handle export change): for backward compatibility
-    // TODO(Manuel) set value_ directly if old functionality is removed
-    if constexpr (std::is_same_v<T, double>)
+    mark_updated();
+    return true;
+  }
+
+  /// Returns the number of values of the interface, 1 for scalar interfaces.
+  size_t get_size() const { return size_; }
+
+  /// Returns true if the interface holds a contiguous array of values.
+  bool is_array() const { return size_ > 1; }
+
+  /**
+   * @brief Get a view of the values of an array interface.
+   * @tparam T The type of the values, has to match the data type of the interface.
+   * @param lock The lock to access the values, the view is only valid while it is held.
+   * @return The values of the interface, an empty span if the lock is not owned.
+   * @throws std::runtime_error if the interface is not an array or T doesn't match its data type.
+   */
+  template <typename T>
+  [[nodiscard]] Span<const T> get_array(std::shared_lock<std::shared_mutex> & lock) const
+  {
+    T * values = get_array_data<T>();
+    return lock.owns_lock() ? Span<const T>(values, size_) : Span<const T>();
+  }
+
+  /**
+   * @brief Get a mutable view of the values of an array interface.
+   * @tparam T The type of the values, has to match the data type of the interface.
+   * @param lock The lock to access the values, the view is only valid while it is held.
+   * @return The values of the interface, an empty span if the lock is not owned.
+   * @throws std::runtime_error if the interface is not an array or T doesn't match its data type.
+   */
+  template <typename T>
+  [[nodiscard]] Span<T> get_array(std::unique_lock<std::shared_mutex> & lock)
+  {
+    T * values = get_array_data<T>();
+    if (!lock.owns_lock())
     {
-      // If the template is of type double, check if the value_ptr_ is not nullptr
-      THROW_ON_NULLPTR(value_ptr_);
-      *value_ptr_ = value;
+      return Span<T>();
     }
-    else
+    // the values might be changed through the view
+    mark_changed();
+    mark_updated();
+    return Span<T>(values, size_);
+  }
+
+  /**
+   * @brief Copy all values of an array interface at once.
+   * @tparam T The type of the values, has to match the data type of the interface.
+   * @param values The destination, has to have the size of the interface.
+   * @return true if the values are copied, false if the handle couldn't be locked.
+   *
+   * @note The method is thread-safe and non-blocking.
+   * @note If a copy of the values is published, see enable_published_copy(), the copy is read
+   * without locking the handle. false is returned if it is being updated.
+   */
+  template <typename T>
+  [[nodiscard]] bool get_array_values(Span<T> values) const
+  {
+    if (has_published_copy())
     {
-      if (!std::holds_alternative<T>(value_))
+      check_array_size(values.size());
+      check_array_access<T>();
+      return read_published_elements(values);
+    }
+    std::shared_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
+    return get_array_values(lock, values);
+  }
+
+  /**
+   * @brief Copy all values of an array interface at once.
+   * @tparam T The type of the values, has to match the data type of the interface.
+   * @param lock The lock to access the values.
+   * @param values The destination, has to have the size of the interface.
+   * @return true if the values are copied, false if the lock is not owned.
+   */
+  template <typename T>
+  [[nodiscard]] bool get_array_values(
+    std::shared_lock<std::shared_mutex> & lock, Span<T> values) const
+  {
+    check_array_size(values.size());
+    if (external_data_ && !external_in_place_)
+    {
+      check_array_access<T>();
+      if (!lock.owns_lock())
+      {
+        return false;
+      }
+      for (size_t i = 0; i < size_; ++i)
+      {
+        values[i] = load_external<T>(i);
+      }
+      return true;
+    }
+    const auto array = get_array<T>(lock);
+    if (array.empty())
+    {
+      return false;
+    }
+    std::copy(array.begin(), array.end(), values.begin());
+    return true;
+  }
+
+  /**
+   * @brief Set all values of an array interface at once.
+   * @tparam T The type of the values, has to match the data type of the interface.
+   * @param values The new values, have to have the size of the interface.
+   * @return true if the values are set, false if the handle couldn't be locked.
+   *
+   * @note The method is thread-safe and non-blocking.
+   */
+  template <typename T>
+  [[nodiscard]] bool set_array_values(Span<const T> values)
+  {
+    std::unique_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
+    return set_array_values(lock, values);
+  }
+
+  /**
+   * @brief Set all values of an array interface at once.
+   * @tparam T The type of the values, has to match the data type of the interface.
+   * @param lock The lock to set the values.
+   * @param values The new values, have to have the size of the interface.
+   * @return true if the values are set, false if the lock is not owned.
+   */
+  template <typename T>
+  [[nodiscard]] bool set_array_values(
+    std::unique_lock<std::shared_mutex> & lock, Span<const T> values)
+  {
+    check_array_size(values.size());
+    if (external_data_ && !external_in_place_)
+    {
+      check_array_access<T>();
+      if (!lock.owns_lock())
+      {
+        return false;
+      }
+      bool changed = false;
+      for (size_t i = 0; i < size_; ++i)
       {
+        if (!is_same_value(load_external<T>(i), values[i]))
+        {
+          store_external(values[i], i);
+          changed = true;
+        }
+      }
+      if (changed)
+      {
+        mark_changed();
+      }
+      mark_updated();
+      update_published_copy();
+      return true;
+    }
+    T * array = get_array_data<T>();
+    if (!lock.owns_lock())
+    {
+      return false;
+    }
+    if (!std::equal(values.begin(), values.end(), array, is_same_value<T>))
+    {
+      std::copy(values.begin(), values.end(), array);
+      mark_changed();
+    }
+    mark_updated();
+    update_published_copy();
+    return true;
+  }
+
+  /**
+   * @brief Copy the values of another interface with the same data type and size.
+   *
+   * Used to hand over the values between the two sets of interfaces of pipelined hardware
+   * components. The copy counts as update, and as change if any value differs. The update time of
+   * the other interface is taken over.
+   * @param other The interface to copy the values from.
+   * @return true if the values are copied, false if one of the handles couldn't be locked.
+   * @throws std::runtime_error if the data types or the sizes of the interfaces differ.
+   *
+   * @note The method is thread-safe and non-blocking.
+   */
+  [[nodiscard]] bool copy_values_from(const Handle & other)
+  {
+    if (data_type_ != other.data_type_ || size_ != other.size_)
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE(
+            "Cannot copy the values of interface: {} of type: '{}' and size: {} to interface: {} "
+            "of type: '{}' and size: {}"),
+          other.get_name(), other.data_type_.to_string(), other.size_, get_name(),
+          data_type_.to_string(), size_));
+    }
+    std::unique_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+      return false;
+    }
+    std::shared_lock<std::shared_mutex> other_lock(other.handle_mutex_, std::try_to_lock);
+    if (!other_lock.owns_lock())
+    {
+      return false;
+    }
+    bool changed = false;
+    switch (data_type_)
+    {
+      case HandleDataType::DOUBLE:
+        changed = copy_elements<double>(other);
+        break;
+      case HandleDataType::BOOL:
+        changed = copy_elements<bool>(other);
+        break;
+      case HandleDataType::FLOAT:
+        changed = copy_elements<float>(other);
+        break;
+      case HandleDataType::INT32:
+        changed = copy_elements<int32_t>(other);
+        break;
+      case HandleDataType::INT64:
+        changed = copy_elements<int64_t>(other);
+        break;
+      case HandleDataType::UINT8:
+        changed = copy_elements<uint8_t>(other);
+        break;
+      case HandleDataType::UINT16:
+        changed = copy_elements<uint16_t>(other);
+        break;
+      default:
         throw std::runtime_error(
           fmt::format(
-            FMT_COMPILE("Invalid data type: '{}' access for interface: {} expected: '{}'"),
-            get_type_name<T>(), get_name(), data_type_.to_string()));
-      }
-      value_ = value;
+            FMT_COMPILE("Cannot copy the values of interface: {} with data type: '{}'"),
+            get_name(), data_type_.to_string()));
+    }
+    if (changed)
+    {
+      mark_changed();
     }
+    mark_updated();
+    update_time_ = other.update_time_;
+    update_published_copy();
     return true;
-    // END
   }
 
+  /// Publish a copy of the values that is read without locking the handle.
+  /**
+   * Used for interfaces written and read by different threads, e.g., states claimed by controllers
+   * of another rate domain than the one of their hardware component. With the non-blocking locks of
+   * the handle, a reader holding the lock makes the writes of the other thread fail, and a writer
+   * holding it makes the reads fail. Once the copy is published, every write through the handle
+   * also updates the copy, guarded by a sequence counter, and get_optional() and
+   * get_array_values() read the copy instead of locking the handle. Values changed through the
+   * mutable view of get_array() are published with the next write through the handle.
+   *
+   * Not real-time safe, the copy is allocated while waiting for the lock of the handle.
+   *
+   * @return true if the copy is published, false if the values can be written without the handle,
+   * i.e., they are bound to memory of the hardware component or referenced through the deprecated
+   * value pointer, such that the copy couldn't be kept up to date.
+   */
+  bool enable_published_copy() const
+  {
+    std::unique_lock<std::shared_mutex> lock(handle_mutex_);
+    if (has_published_copy())
+    {
+      return true;
+    }
+    if (external_data_ || (!array_values_ && std::holds_alternative<std::monostate>(value_)))
+    {
+      return false;
+    }
+    const size_t number_of_words =
+      (size_ * data_type_.get_type_size() + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    published_words_ = std::make_unique<std::atomic<uint64_t>[]>(number_of_words);
+    publish_values();
+    // the copy is complete before the readers switch to it
+    has_published_copy_.store(true, std::memory_order_release);
+    return true;
+  }
+
+  /// Returns true if a copy of the values is published, see enable_published_copy().
+  bool has_published_copy() const { return has_published_copy_.load(std::memory_order_acquire); }
+
   std::shared_mutex & get_mutex() const { return handle_mutex_; }
 
   HandleDataType get_data_type() const { return data_type_; }
 
+  /// Returns true if the values are stored in memory owned by the hardware component.
+  bool is_bound_to_memory() const { return external_data_ != nullptr; }
+
+  /// Returns the number of changes of the value by set_value() or set_array_values().
+  /**
+   * Setting the current value again doesn't count as change, NaN is considered equal to NaN.
+   * Handing out a mutable view with get_array() counts as change.
+   */
+  uint64_t get_change_count() const { return change_count_.load(std::memory_order_acquire); }
+
+  /// Returns the number of updates of the value by set_value() or set_array_values().
+  /**
+   * In contrast to get_change_count(), setting the current value again counts as update. Used to
+   * distinguish fresh from stale values, e.g., of asynchronous or decimated hardware components.
+   */
+  uint64_t get_update_sequence() const
+  {
+    return update_sequence_.load(std::memory_order_acquire);
+  }
+
+  /// Set the time of the cycle in which the value was updated.
+  /**
+   * @param lock The lock used to update the value.
+   * @param time The time of the cycle, e.g. of the read() call of the hardware component.
+   */
+  void set_update_time(std::unique_lock<std::shared_mutex> & lock, const rclcpp::Time & time)
+  {
+    if (lock.owns_lock())
+    {
+      update_time_ = time;
+    }
+  }
+
+  /// Get the time of the cycle in which the value was updated last.
+  /**
+   * @return The time, with the clock type RCL_CLOCK_UNINITIALIZED if it was never set, std::nullopt
+   * if the handle couldn't be locked.
+   *
+   * @note The method is thread-safe and non-blocking.
+   */
+  [[nodiscard]] std::optional<rclcpp::Time> get_update_time() const
+  {
+    std::shared_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+      return std::nullopt;
+    }
+    return update_time_;
+  }
+
   /// Returns true if the handle data type can be casted to double.
   bool is_castable_to_double() const { return data_type_.is_castable_to_double(); }
 
+protected:
+  /// Returns true if the value is published to the introspection, all numeric types except bool.
+  bool is_introspected() const
+  {
+    return value_ptr_ || (!std::holds_alternative<std::monostate>(value_) &&
+                          !std::holds_alternative<bool>(value_));
+  }
+
+  /// Returns the value casted to double without locking the handle, used by the introspection.
+  double get_introspection_value() const
+  {
+    if (value_ptr_)
+    {
+      return *value_ptr_;
+    }
+    if (external_data_)
+    {
+      switch (data_type_)
+      {
+        case HandleDataType::DOUBLE:
+          return load_external<double>();
+        case HandleDataType::FLOAT:
+          return static_cast<double>(load_external<float>());
+        case HandleDataType::INT32:
+          return static_cast<double>(load_external<int32_t>());
+        case HandleDataType::INT64:
+          return static_cast<double>(load_external<int64_t>());
+        case HandleDataType::UINT8:
+          return static_cast<double>(load_external<uint8_t>());
+        case HandleDataType::UINT16:
+          return static_cast<double>(load_external<uint16_t>());
+        default:
+          return std::numeric_limits<double>::quiet_NaN();
+      }
+    }
+    return std::visit(
+      [](const auto & value) -> double
+      {
+        if constexpr (std::is_arithmetic_v<std::decay_t<decltype(value)>>)
+        {
+          return static_cast<double>(value);
+        }
+        else
+        {
+          return std::numeric_limits<double>::quiet_NaN();
+        }
+      },
+      value_);
+  }
+
 private:
+  template <typename T>
+  static T parse_value(const std::string & value)
+  {
+    if constexpr (std::is_same_v<T, bool>)
+    {
+      return hardware_interface::parse_bool(value);
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+      return static_cast<T>(hardware_interface::stod(value));
+    }
+    else
+    {
+      return hardware_interface::parse_integer<T>(value);
+    }
+  }
+
+  template <typename T>
+  static T parse_value_or_default(const std::string & value)
+  {
+    if (!value.empty())
+    {
+      return parse_value<T>(value);
+    }
+    if constexpr (std::is_floating_point_v<T>)
+    {
+      return std::numeric_limits<T>::quiet_NaN();
+    }
+    return T{};
+  }
+
+  template <typename T>
+  void initialize_value(const std::string & initial_value)
+  {
+    value_ptr_ = nullptr;
+    if (!is_array())
+    {
+      value_ = parse_value_or_default<T>(initial_value);
+      if constexpr (std::is_same_v<T, double>)
+      {
+        value_ptr_ = std::get_if<double>(&value_);
+      }
+      return;
+    }
+
+    array_values_ = std::make_unique<std::byte[]>(size_ * sizeof(T));
+    T * values = reinterpret_cast<T *>(array_values_.get());
+    if (!initial_value.empty() && initial_value.front() == '[')
+    {
+      const auto initial_values = hardware_interface::parse_string_array(initial_value);
+      if (initial_values.size() != size_)
+      {
+        throw std::invalid_argument(
+          fmt::format(
+            FMT_COMPILE("Expected {} initial values, got {}"), size_, initial_values.size()));
+      }
+      for (size_t i = 0; i < size_; ++i)
+      {
+        new (values + i) T(parse_value<T>(initial_values[i]));
+      }
+    }
+    else
+    {
+      std::uninitialized_fill_n(values, size_, parse_value_or_default<T>(initial_value));
+    }
+  }
+
+  void bind_memory(const InterfaceMemory & memory)
+  {
+    external_data_ = static_cast<std::byte *>(memory.data);
+    // the supported types are aligned to their size
+    external_in_place_ =
+      memory.is_native_byte_order() && memory.alignment % data_type_.get_type_size() == 0;
+    external_swap_bytes_ = !memory.is_native_byte_order();
+    array_values_.reset();
+    value_ptr_ = nullptr;
+    if (external_in_place_ && data_type_ == HandleDataType::DOUBLE && !is_array())
+    {
+      // keeps the fast path of double values
+      value_ptr_ = reinterpret_cast<double *>(external_data_);
+    }
+  }
+
+  template <typename T>
+  static T swap_bytes(const T & value)
+  {
+    std::array<std::byte, sizeof(T)> bytes;
+    std::memcpy(bytes.data(), &value, sizeof(T));
+    std::reverse(bytes.begin(), bytes.end());
+    T swapped;
+    std::memcpy(&swapped, bytes.data(), sizeof(T));
+    return swapped;
+  }
+
+  template <typename T>
+  T load_external(size_t index = 0) const
+  {
+    const std::byte * address = external_data_ + index * sizeof(T);
+    if (external_in_place_)
+    {
+      return *reinterpret_cast<const T *>(address);
+    }
+    T value;
+    std::memcpy(&value, address, sizeof(T));
+    return external_swap_bytes_ ? swap_bytes(value) : value;
+  }
+
+  template <typename T>
+  void store_external(const T & value, size_t index = 0)
+  {
+    std::byte * address = external_data_ + index * sizeof(T);
+    if (external_in_place_)
+    {
+      *reinterpret_cast<T *>(address) = value;
+      return;
+    }
+    const T stored = external_swap_bytes_ ? swap_bytes(value) : value;
+    std::memcpy(address, &stored, sizeof(T));
+  }
+
+  template <typename T>
+  static bool is_same_value(const T & current, const T & value)
+  {
+    if constexpr (std::is_floating_point_v<T>)
+    {
+      return current == value || (std::isnan(current) && std::isnan(value));
+    }
+    else
+    {
+      return current == value;
+    }
+  }
+
+  void mark_changed()
+  {
+    // only called while the handle is locked exclusively
+    change_count_.store(
+      change_count_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  void mark_updated()
+  {
+    // only called while the handle is locked exclusively
+    update_sequence_.store(
+      update_sequence_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  template <typename T>
+  T load_value() const
+  {
+    return external_data_ ? load_external<T>() : std::get<T>(value_);
+  }
+
+  template <typename T>
+  T load_element(size_t index) const
+  {
+    if (external_data_)
+    {
+      return load_external<T>(index);
+    }
+    if (array_values_)
+    {
+      return std::launder(reinterpret_cast<const T *>(array_values_.get()))[index];
+    }
+    if constexpr (std::is_same_v<T, double>)
+    {
+      // BEGIN (Handle export change): for backward compatibility
+      if (std::holds_alternative<std::monostate>(value_))
+      {
+        THROW_ON_NULLPTR(value_ptr_);
+        return *value_ptr_;
+      }
+      // END
+    }
+    return std::get<T>(value_);
+  }
+
+  template <typename T>
+  void store_element(const T & value, size_t index)
+  {
+    if (external_data_)
+    {
+      store_external(value, index);
+    }
+    else if (array_values_)
+    {
+      std::launder(reinterpret_cast<T *>(array_values_.get()))[index] = value;
+    }
+    else if (std::holds_alternative<std::monostate>(value_))
+    {
+      // BEGIN (Handle export change): for backward compatibility
+      THROW_ON_NULLPTR(value_ptr_);
+      *value_ptr_ = static_cast<double>(value);
+      // END
+    }
+    else
+    {
+      std::get<T>(value_) = value;
+    }
+  }
+
+  /// Copies the values of the other handle of the same type and size, returns true on any change.
+  template <typename T>
+  bool copy_elements(const Handle & other)
+  {
+    // only called while both handles are locked
+    bool changed = false;
+    for (size_t i = 0; i < size_; ++i)
+    {
+      const T value = other.load_element<T>(i);
+      if (!is_same_value(load_element<T>(i), value))
+      {
+        store_element(value, i);
+        changed = true;
+      }
+    }
+    return changed;
+  }
+
+  /// Updates the published copy after a write, only called by the single writer of the handle.
+  void update_published_copy() const
+  {
+    if (has_published_copy())
+    {
+      publish_values();
+    }
+  }
+
+  void publish_values() const
+  {
+    // the sequence is odd while the copy is updated
+    const uint64_t sequence = published_sequence_.load(std::memory_order_relaxed);
+    published_sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    switch (data_type_)
+    {
+      case HandleDataType::DOUBLE:
+        publish_elements<double>();
+        break;
+      case HandleDataType::BOOL:
+        publish_elements<bool>();
+        break;
+      case HandleDataType::FLOAT:
+        publish_elements<float>();
+        break;
+      case HandleDataType::INT32:
+        publish_elements<int32_t>();
+        break;
+      case HandleDataType::INT64:
+        publish_elements<int64_t>();
+        break;
+      case HandleDataType::UINT8:
+        publish_elements<uint8_t>();
+        break;
+      case HandleDataType::UINT16:
+        publish_elements<uint16_t>();
+        break;
+      default:
+        break;
+    }
+    published_sequence_.store(sequence + 2, std::memory_order_release);
+  }
+
+  template <typename T>
+  void publish_elements() const
+  {
+    static_assert(sizeof(uint64_t) % sizeof(T) == 0, "The values have to pack into 64-bit words");
+    constexpr size_t elements_per_word = sizeof(uint64_t) / sizeof(T);
+    for (size_t i = 0, word = 0; i < size_; i += elements_per_word, ++word)
+    {
+      std::array<T, elements_per_word> elements{};
+      for (size_t j = 0; j < elements_per_word && i + j < size_; ++j)
+      {
+        elements[j] = load_element<T>(i + j);
+      }
+      uint64_t bits;
+      std::memcpy(&bits, elements.data(), sizeof(bits));
+      published_words_[word].store(bits, std::memory_order_relaxed);
+    }
+  }
+
+  /// Copies the published values, returns false if they were updated meanwhile.
+  template <typename T>
+  bool read_published_elements(Span<T> values) const
+  {
+    constexpr size_t elements_per_word = sizeof(uint64_t) / sizeof(T);
+    const uint64_t sequence = published_sequence_.load(std::memory_order_acquire);
+    if (sequence % 2 != 0)
+    {
+      return false;
+    }
+    for (size_t i = 0, word = 0; i < size_; i += elements_per_word, ++word)
+    {
+      const uint64_t bits = published_words_[word].load(std::memory_order_relaxed);
+      std::array<T, elements_per_word> elements;
+      std::memcpy(elements.data(), &bits, sizeof(bits));
+      for (size_t j = 0; j < elements_per_word && i + j < size_; ++j)
+      {
+        values[i + j] = elements[j];
+      }
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return published_sequence_.load(std::memory_order_relaxed) == sequence;
+  }
+
+  template <typename T, typename U = T>
+  std::optional<T> read_published_value() const
+  {
+    U value;
+    if (!read_published_elements(Span<U>(&value, 1u)))
+    {
+      return std::nullopt;
+    }
+    return static_cast<T>(value);
+  }
+
+  template <typename T>
+  std::optional<T> get_published_value() const
+  {
+    if (is_array())
+    {
+      throw_scalar_access_on_array();
+    }
+    if constexpr (std::is_same_v<T, double>)
+    {
+      switch (data_type_)
+      {
+        case HandleDataType::DOUBLE:
+          return read_published_value<double>();
+        case HandleDataType::BOOL:
+          return read_published_value<double, bool>();
+        case HandleDataType::FLOAT:
+          return read_published_value<double, float>();
+        case HandleDataType::INT32:
+          return read_published_value<double, int32_t>();
+        case HandleDataType::INT64:
+          return read_published_value<double, int64_t>();
+        case HandleDataType::UINT8:
+          return read_published_value<double, uint8_t>();
+        case HandleDataType::UINT16:
+          return read_published_value<double, uint16_t>();
+        default:
+          throw std::runtime_error(
+            fmt::format(
+              FMT_COMPILE("Data type: '{}' cannot be casted to double for interface: {}"),
+              data_type_.to_string(), get_name()));
+      }
+    }
+    else
+    {
+      check_data_type<T>();
+      return read_published_value<T>();
+    }
+  }
+
+  template <typename T>
+  void check_data_type() const
+  {
+    if (data_type_ != HandleDataType::of<T>())
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Invalid data type: '{}' access for interface: {} expected: '{}'"),
+          get_type_name<T>(), get_name(), data_type_.to_string()));
+    }
+  }
+
+  template <typename T>
+  void check_array_access() const
+  {
+    if (!is_array())
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Interface: {} is not an array, use get_optional and set_value instead."),
+          get_name()));
+    }
+    check_data_type<T>();
+  }
+
+  template <typename T>
+  T * get_array_data() const
+  {
+    check_array_access<T>();
+    if (external_data_)
+    {
+      if (!external_in_place_)
+      {
+        throw std::runtime_error(
+          fmt::format(
+            FMT_COMPILE(
+              "The values of interface: {} are not aligned or not in the native byte order, use "
+              "get_array_values and set_array_values instead."),
+            get_name()));
+      }
+      return reinterpret_cast<T *>(external_data_);
+    }
+    return std::launder(reinterpret_cast<T *>(array_values_.get()));
+  }
+
+  void check_array_size(size_t size) const
+  {
+    if (size != size_)
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Invalid number of values: {} for interface: {} of size: {}"), size,
+          get_name(), size_));
+    }
+  }
+
+  [[noreturn]] void throw_scalar_access_on_array() const
+  {
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE(
+          "Interface: {} is an array of size {}, use get_array_values and set_array_values "
+          "instead."),
+        get_name(), size_));
+  }
+
   void copy(const Handle & other) noexcept
   {
     std::scoped_lock lock(other.handle_mutex_, handle_mutex_);
     prefix_name_ = other.prefix_name_;
     interface_name_ = other.interface_name_;
     handle_name_ = other.handle_name_;
+    data_type_ = other.data_type_;
+    size_ = other.size_;
     value_ = other.value_;
-    if (std::holds_alternative<std::monostate>(value_))
+    array_values_.reset();
+    if (other.array_values_)
+    {
+      // the values are trivially copyable
+      const size_t number_of_bytes = size_ * data_type_.get_type_size();
+      array_values_ = std::make_unique<std::byte[]>(number_of_bytes);
+      std::memcpy(array_values_.get(), other.array_values_.get(), number_of_bytes);
+    }
+    external_data_ = other.external_data_;
+    external_in_place_ = other.external_in_place_;
+    external_swap_bytes_ = other.external_swap_bytes_;
+    change_count_.store(other.change_count_.load());
+    update_sequence_.store(other.update_sequence_.load());
+    update_time_ = other.update_time_;
+    // the copy is published again for the handle read by other threads
+    has_published_copy_.store(false);
+    published_words_.reset();
+    if (external_data_ || std::holds_alternative<std::monostate>(value_))
     {
+      // the deprecated and the bound values are shared with the copy
       value_ptr_ = other.value_ptr_;
     }
     else
@@ -337,11 +1207,80 @@ private:
     std::swap(first.prefix_name_, second.prefix_name_);
     std::swap(first.interface_name_, second.interface_name_);
     std::swap(first.handle_name_, second.handle_name_);
+    std::swap(first.data_type_, second.data_type_);
+    std::swap(first.size_, second.size_);
     std::swap(first.value_, second.value_);
     std::swap(first.value_ptr_, second.value_ptr_);
+    std::swap(first.array_values_, second.array_values_);
+    std::swap(first.external_data_, second.external_data_);
+    std::swap(first.external_in_place_, second.external_in_place_);
+    std::swap(first.external_swap_bytes_, second.external_swap_bytes_);
+    first.change_count_.store(second.change_count_.exchange(first.change_count_.load()));
+    first.update_sequence_.store(
+      second.update_sequence_.exchange(first.update_sequence_.load()));
+    std::swap(first.update_time_, second.update_time_);
+    std::swap(first.published_words_, second.published_words_);
+    first.published_sequence_.store(
+      second.published_sequence_.exchange(first.published_sequence_.load()));
+    first.has_published_copy_.store(
+      second.has_published_copy_.exchange(first.has_published_copy_.load()));
   }
 
 protected:
+  /// Set the value without counting it as update, see set_value() and get_update_sequence().
+  template <typename T>
+  bool store_value(std::unique_lock<std::shared_mutex> & lock, const T & value)
+  {
+    if (!lock.owns_lock())
+    {
+      return false;
+    }
+    if (is_array())
+    {
+      throw_scalar_access_on_array();
+    }
+    // BEGIN (Handle export change): for backward compatibility
+    // TODO(Manuel) set value_ directly if old functionality is removed
+    if (external_data_ && !value_ptr_)
+    {
+      // values that are not accessed in place, or bound to memory of another type than double
+      check_data_type<T>();
+      if (!is_same_value(load_external<T>(), value))
+      {
+        store_external(value);
+        mark_changed();
+      }
+    }
+    else if constexpr (std::is_same_v<T, double>)
+    {
+      // If the template is of type double, check if the value_ptr_ is not nullptr
+      THROW_ON_NULLPTR(value_ptr_);
+      if (!is_same_value(*value_ptr_, value))
+      {
+        *value_ptr_ = value;
+        mark_changed();
+      }
+    }
+    else
+    {
+      if (!std::holds_alternative<T>(value_))
+      {
+        throw std::runtime_error(
+          fmt::format(
+            FMT_COMPILE("Invalid data type: '{}' access for interface: {} expected: '{}'"),
+            get_type_name<T>(), get_name(), data_type_.to_string()));
+      }
+      if (!is_same_value(std::get<T>(value_), value))
+      {
+        value_ = value;
+        mark_changed();
+      }
+    }
+    update_published_copy();
+    return true;
+    // END
+  }
+
   std::string prefix_name_;
   std::string interface_name_;
   std::string handle_name_;
@@ -351,9 +1290,33 @@ protected:
   // TODO(Manuel) redeclare as HANDLE_DATATYPE * value_ptr_ if old functionality is removed
   double * value_ptr_;
   // END
+  /// Number of values, greater than one for array interfaces
+  size_t size_ = 1;
+  /// Contiguous values of an array interface, nullptr for scalar interfaces
+  std::unique_ptr<std::byte[]> array_values_;
+  /// Values in memory owned by the hardware component, nullptr if the values are owned here
+  std::byte * external_data_ = nullptr;
+  /// The external values are aligned and in the native byte order, thus accessed in place
+  bool external_in_place_ = false;
+  bool external_swap_bytes_ = false;
+  /// Incremented on each change of the value, while the handle is locked exclusively
+  std::atomic<uint64_t> change_count_{0};
+  /// Incremented on each update of the value, while the handle is locked exclusively
+  std::atomic<uint64_t> update_sequence_{0};
+  rclcpp::Time update_time_{0, 0, RCL_CLOCK_UNINITIALIZED};
   mutable std::shared_mutex handle_mutex_;
+  /// Copy of the values read without locking, in 64-bit words, see enable_published_copy()
+  mutable std::unique_ptr<std::atomic<uint64_t>[]> published_words_;
+  /// Incremented before and after each update of the published copy
+  mutable std::atomic<uint64_t> published_sequence_{0};
+  mutable std::atomic_bool has_published_copy_{false};
 
 private:
+  template <typename HandleType, typename T>
+  friend class InterfaceAccessor;
+  template <typename HandleType, typename T>
+  friend class ArrayInterfaceAccessor;
+
   // TODO(christophfroehlich): remove once
   // https://github.com/ros2/rclcpp/issues/2587
   // is fixed
@@ -370,25 +1333,71 @@ public:
 
   void registerIntrospection() const
   {
-    if (value_ptr_ || std::holds_alternative<double>(value_))
+    if (is_introspected())
     {
-      std::function<double()> f = [this]()
-      { return value_ptr_ ? *value_ptr_ : std::get<double>(value_); };
+      std::function<double()> f = [this]() { return get_introspection_value(); };
       DEFAULT_REGISTER_ROS2_CONTROL_INTROSPECTION("state_interface." + get_name(), f);
     }
   }
 
   void unregisterIntrospection() const
   {
-    if (value_ptr_ || std::holds_alternative<double>(value_))
+    if (is_introspected())
     {
       DEFAULT_UNREGISTER_ROS2_CONTROL_INTROSPECTION("state_interface." + get_name());
     }
   }
 
-  StateInterface(const StateInterface & other) = default;
+  StateInterface(const StateInterface & other) noexcept
+  : Handle(other), predicted_(other.is_predicted())
+  {
+  }
+
+  StateInterface & operator=(const StateInterface & other)
+  {
+    Handle::operator=(other);
+    set_predicted(other.is_predicted());
+    return *this;
+  }
+
+  StateInterface(StateInterface && other) noexcept
+  : Handle(std::move(other)), predicted_(other.is_predicted())
+  {
+  }
+
+  StateInterface & operator=(StateInterface && other)
+  {
+    const bool predicted = other.is_predicted();
+    Handle::operator=(std::move(other));
+    set_predicted(predicted);
+    return *this;
+  }
+
+  /// Returns true if the value was predicted by the extrapolation of the state, false if it was
+  /// read from the hardware.
+  bool is_predicted() const { return predicted_.load(std::memory_order_acquire); }
+
+  /// Flag the value as predicted by the extrapolation of the state or as read from the hardware.
+  void set_predicted(bool predicted) { predicted_.store(predicted, std::memory_order_release); }
 
-  StateInterface(StateInterface && other) = default;
+  /// Set a value predicted by the extrapolation of the state and flag it as predicted.
+  /**
+   * In contrast to set_value(), the prediction doesn't count as update of the value, so that
+   * get_update_sequence() only advances with the values read from the hardware.
+   *
+   * @param value The predicted value.
+   * @return true if the value is set, false if the handle couldn't be locked.
+   */
+  [[nodiscard]] bool set_predicted_value(double value)
+  {
+    std::unique_lock<std::shared_mutex> lock(handle_mutex_, std::try_to_lock);
+    if (!store_value(lock, value))
+    {
+      return false;
+    }
+    set_predicted(true);
+    return true;
+  }
 
 // Disable deprecated warnings
 #pragma GCC diagnostic push
@@ -398,6 +1407,9 @@ public:
 
   using SharedPtr = std::shared_ptr<StateInterface>;
   using ConstSharedPtr = std::shared_ptr<const StateInterface>;
+
+private:
+  std::atomic<bool> predicted_ = false;
 };
 
 class CommandInterface : public Handle
@@ -442,12 +1454,35 @@ public:
 
   const bool & is_limited() const { return is_command_limited_; }
 
+  /// Returns true if the command was changed since the last call of clear_dirty().
+  /**
+   * Used by hardware components to transmit only changed commands. A command is not dirty before
+   * its value is changed for the first time.
+   */
+  bool is_dirty() const { return get_change_count() != clean_change_count_; }
+
+  /// Marks the current command as transmitted.
+  /**
+   * Call it before reading the command to transmit, so that a concurrent change marks the command
+   * as dirty again instead of getting lost.
+   */
+  void clear_dirty() { clean_change_count_ = get_change_count(); }
+
+  /// Marks the command as transmitted up to the given change, see get_change_count().
+  /**
+   * Call it after the command was transmitted with the change count read before reading the
+   * command, so that a concurrent change keeps the command dirty.
+   */
+  void clear_dirty(uint64_t change_count) { clean_change_count_ = change_count; }
+
+  /// Marks the command as dirty, e.g., to retransmit all commands after reconnecting to a device.
+  void mark_dirty() { clean_change_count_ = get_change_count() - 1u; }
+
   void registerIntrospection() const
   {
-    if (value_ptr_ || std::holds_alternative<double>(value_))
+    if (is_introspected())
     {
-      std::function<double()> f = [this]()
-      { return value_ptr_ ? *value_ptr_ : std::get<double>(value_); };
+      std::function<double()> f = [this]() { return get_introspection_value(); };
       DEFAULT_REGISTER_ROS2_CONTROL_INTROSPECTION("command_interface." + get_name(), f);
       DEFAULT_REGISTER_ROS2_CONTROL_INTROSPECTION(
         "command_interface." + get_name() + ".is_limited", &is_command_limited_);
@@ -456,7 +1491,7 @@ public:
 
   void unregisterIntrospection() const
   {
-    if (value_ptr_ || std::holds_alternative<double>(value_))
+    if (is_introspected())
     {
       DEFAULT_UNREGISTER_ROS2_CONTROL_INTROSPECTION("command_interface." + get_name());
       DEFAULT_UNREGISTER_ROS2_CONTROL_INTROSPECTION(
@@ -474,6 +1509,8 @@ public:
 
 private:
   bool is_command_limited_ = false;
+  // change count of the last transmitted command, only accessed by the hardware component
+  uint64_t clean_change_count_ = 0;
   std::function<double(double, bool &)> on_set_command_limiter_ =
     [](double value, bool & is_limited)
   {
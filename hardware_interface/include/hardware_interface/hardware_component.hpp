@@ -15,13 +15,17 @@
 #ifndef HARDWARE_INTERFACE__HARDWARE_COMPONENT_HPP_
 #define HARDWARE_INTERFACE__HARDWARE_COMPONENT_HPP_
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "hardware_interface/handle.hpp"
 #include "hardware_interface/hardware_component_interface.hpp"
 #include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/realtime_memory.hpp"
 #include "hardware_interface/types/hardware_interface_return_values.hpp"
 #include "hardware_interface/types/statistics_types.hpp"
 #include "rclcpp/duration.hpp"
@@ -92,13 +96,36 @@ public:
 
   const HardwareComponentStatisticsCollector & get_write_statistics() const;
 
+  /// Number of consecutive read cycles in which none of the state interfaces was updated.
+  /**
+   * Only counted if the stale state detection is enabled, see set_stale_state_detection().
+   */
+  size_t get_stale_read_cycles() const;
+
+  /// Enable counting the read cycles without state updates, disabled by default.
+  void set_stale_state_detection(bool enable);
+
+  /// Number of runtime overruns of the async thread scheduled with SCHED_DEADLINE.
+  uint64_t get_deadline_overruns() const;
+
+  /// Usage of the real-time memory arena of the component.
+  RealtimeMemoryArenaStatistics get_realtime_memory_arena_statistics() const;
+
+  /// Pin the async thread of the component to CPUs, applied with its next cycle.
+  void set_async_thread_cpu_affinity(const std::vector<int> & cpus);
+
   return_type read(const rclcpp::Time & time, const rclcpp::Duration & period);
 
+  /// Hand over or predict the extrapolated states of the component, called in every read cycle.
+  void extrapolate_states(const rclcpp::Time & time);
+
   return_type write(const rclcpp::Time & time, const rclcpp::Duration & period);
 
   std::recursive_mutex & get_mutex();
 
 private:
+  void update_stale_read_cycles();
+
   std::unique_ptr<HardwareComponentInterface> impl_;
   mutable std::recursive_mutex component_mutex_;
   // Last read cycle time
@@ -108,6 +135,10 @@ private:
   // Component statistics
   HardwareComponentStatisticsCollector read_statistics_;
   HardwareComponentStatisticsCollector write_statistics_;
+  // Staleness of the state interfaces
+  std::atomic<bool> stale_state_detection_ = false;
+  size_t stale_read_cycles_ = 0;
+  std::optional<uint64_t> last_state_update_sequence_;
 };
 
 }  // namespace hardware_interface
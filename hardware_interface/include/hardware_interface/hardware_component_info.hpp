@@ -19,6 +19,7 @@
 #ifndef HARDWARE_INTERFACE__HARDWARE_COMPONENT_INFO_HPP_
 #define HARDWARE_INTERFACE__HARDWARE_COMPONENT_INFO_HPP_
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -26,6 +27,7 @@
 #include "rclcpp/time.hpp"
 #include "rclcpp_lifecycle/state.hpp"
 
+#include "hardware_interface/realtime_memory.hpp"
 #include "hardware_interface/types/statistics_types.hpp"
 namespace hardware_interface
 {
@@ -55,6 +57,12 @@ struct HardwareComponentInfo
   /// Component is async
   bool is_async;
 
+  /// CPUs the async thread is pinned to by the `affinity` attribute of the async tag.
+  std::vector<int> async_cpu_affinity;
+
+  /// The async thread is scheduled with SCHED_DEADLINE by the `sched_runtime` attribute.
+  bool async_deadline_scheduling = false;
+
   //// read/write rate
   unsigned int rw_rate;
 
@@ -67,6 +75,12 @@ struct HardwareComponentInfo
   /// List of provided command interfaces by the component.
   std::vector<std::string> command_interfaces;
 
+  /// Runtime overruns of the async thread of the component scheduled with SCHED_DEADLINE.
+  uint64_t deadline_overruns = 0;
+
+  /// Usage of the real-time memory arena of the component, all zero if it has none.
+  RealtimeMemoryArenaStatistics realtime_memory_arena;
+
   /// Read cycle statistics of the component.
   std::shared_ptr<HardwareComponentStatisticsData> read_statistics = nullptr;
 
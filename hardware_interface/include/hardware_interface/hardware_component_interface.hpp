@@ -17,18 +17,31 @@
 
 #include <fmt/compile.h>
 
+#include <cmath>
+#include <cstdint>
+#include <initializer_list>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "control_msgs/msg/hardware_status.hpp"
+#include "hardware_interface/command_interpolator.hpp"
 #include "hardware_interface/component_parser.hpp"
+#include "hardware_interface/deadline_scheduling.hpp"
 #include "hardware_interface/handle.hpp"
 #include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/interface_accessor.hpp"
+#include "hardware_interface/realtime_memory.hpp"
 #include "hardware_interface/introspection.hpp"
+#include "hardware_interface/lexical_casts.hpp"
+#include "hardware_interface/state_extrapolator.hpp"
 #include "hardware_interface/types/hardware_component_interface_params.hpp"
 #include "hardware_interface/types/hardware_component_params.hpp"
 #include "hardware_interface/types/hardware_interface_return_values.hpp"
@@ -45,6 +58,7 @@
 #include "rclcpp_lifecycle/node_interfaces/lifecycle_node_interface.hpp"
 #include "rclcpp_lifecycle/state.hpp"
 #include "realtime_tools/async_function_handler.hpp"
+#include "realtime_tools/realtime_helpers.hpp"
 #include "realtime_tools/realtime_publisher.hpp"
 #include "realtime_tools/realtime_thread_safe_box.hpp"
 
@@ -112,6 +126,22 @@ public:
     logger_ = logger_copy.get_child(
       "hardware_component." + params.hardware_info.type + "." + params.hardware_info.name);
     info_ = params.hardware_info;
+    if (info_.realtime_memory_arena_size > 0)
+    {
+      try
+      {
+        realtime_memory_arena_ =
+          std::make_unique<RealtimeMemoryArena>(info_.realtime_memory_arena_size);
+      }
+      catch (const std::exception & e)
+      {
+        RCLCPP_ERROR(get_logger(), "Could not create the real-time memory arena: %s", e.what());
+        return CallbackReturn::ERROR;
+      }
+      RCLCPP_INFO(
+        get_logger(), "Created a real-time memory arena of %zu bytes",
+        info_.realtime_memory_arena_size);
+    }
     if (params.hardware_info.is_async)
     {
       realtime_tools::AsyncFunctionHandlerParams async_thread_params;
@@ -123,41 +153,57 @@ public:
       async_thread_params.logger = params.logger;
       async_thread_params.exec_rate = params.hardware_info.rw_rate;
       async_thread_params.print_warnings = info_.async_params.print_warnings;
-      RCLCPP_INFO(
-        get_logger(), "Starting async handler with scheduler priority: %d and policy : %s",
-        info_.async_params.thread_priority,
-        async_thread_params.scheduling_policy.to_string().c_str());
+      if (info_.async_params.deadline_scheduling.is_enabled())
+      {
+        try
+        {
+          deadline_scheduling_ = resolve_deadline_scheduling_params(
+            info_.async_params.deadline_scheduling,
+            std::chrono::microseconds(info_.rw_rate > 0 ? 1'000'000 / info_.rw_rate : 0));
+        }
+        catch (const std::invalid_argument & e)
+        {
+          RCLCPP_ERROR(get_logger(), "%s Set the 'sched_period' of the async tag.", e.what());
+          return CallbackReturn::ERROR;
+        }
+        RCLCPP_INFO(
+          get_logger(),
+          "Starting async handler with SCHED_DEADLINE runtime %ld us, deadline %ld us and period "
+          "%ld us and policy : %s",
+          static_cast<long>(deadline_scheduling_.runtime.count()),    // NOLINT
+          static_cast<long>(deadline_scheduling_.deadline.count()),   // NOLINT
+          static_cast<long>(deadline_scheduling_.period.count()),     // NOLINT
+          async_thread_params.scheduling_policy.to_string().c_str());
+      }
+      else
+      {
+        RCLCPP_INFO(
+          get_logger(), "Starting async handler with scheduler priority: %d and policy : %s",
+          info_.async_params.thread_priority,
+          async_thread_params.scheduling_policy.to_string().c_str());
+      }
       async_handler_ = std::make_unique<realtime_tools::AsyncFunctionHandler<return_type>>();
-      const bool is_sensor_type = (info_.type == "sensor");
+      const bool pipelined = info_.async_params.pipelined;
       async_handler_->init(
-        [this, is_sensor_type](const rclcpp::Time & time, const rclcpp::Duration & period)
+        [this, pipelined](const rclcpp::Time & time, const rclcpp::Duration & period)
         {
-          const auto read_start_time = std::chrono::steady_clock::now();
-          const auto ret_read = read(time, period);
-          const auto read_end_time = std::chrono::steady_clock::now();
-          read_return_info_.store(ret_read, std::memory_order_release);
-          read_execution_time_.store(
-            std::chrono::duration_cast<std::chrono::nanoseconds>(read_end_time - read_start_time),
-            std::memory_order_release);
-          if (ret_read != return_type::OK)
+          if (deadline_scheduling_.is_enabled() && !async_thread_scheduled_)
+          {
+            configure_async_thread_sched_deadline();
+          }
+          if (async_thread_cpu_affinity_pending_.load(std::memory_order_acquire))
           {
-            return ret_read;
+            apply_async_thread_cpu_affinity();
           }
-          if (
-            !is_sensor_type &&
-            this->get_lifecycle_state().id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+          if (pipelined)
           {
-            const auto write_start_time = std::chrono::steady_clock::now();
-            const auto ret_write = write(time, period);
-            const auto write_end_time = std::chrono::steady_clock::now();
-            write_return_info_.store(ret_write, std::memory_order_release);
-            write_execution_time_.store(
-              std::chrono::duration_cast<std::chrono::nanoseconds>(
-                write_end_time - write_start_time),
-              std::memory_order_release);
-            return ret_write;
+            // the commands of the previous cycle are written before the states for the next cycle
+            // are read
+            const auto ret_write = async_write(time, period);
+            return ret_write != return_type::OK ? ret_write : async_read(time, period);
           }
-          return return_type::OK;
+          const auto ret_read = async_read(time, period);
+          return ret_read != return_type::OK ? ret_read : async_write(time, period);
         },
         async_thread_params);
       async_handler_->start_thread();
@@ -521,6 +567,209 @@ public:
     return command_interfaces;
   }
 
+  /// Returns true if the I/O of the component is pipelined with the update of the controllers.
+  bool is_pipelined() const { return info_.is_async && info_.async_params.pipelined; }
+
+  /// Create the state interfaces handed to the resource manager by pipelined components and for
+  /// extrapolated states.
+  /**
+   * Pipelined components keep the interfaces exported by on_export_state_interfaces() for read()
+   * and hand a second set to the resource manager, whose values are updated from the first set
+   * by trigger_read(). Other components hand the exported interfaces to the resource manager.
+   *
+   * State interfaces with the `extrapolation` parameter ("hold", "linear" or "filter") are
+   * separated as well. The resource manager calls extrapolate_states() in every read cycle, which
+   * hands over the states updated by the component and predicts the others with a
+   * StateExtrapolator, so that controllers running faster than the component, or an asynchronous
+   * component whose read is still in progress, see predicted instead of repeated states.
+   *
+   * \param[in] state_interfaces the state interfaces exported by the component.
+   * \return the state interfaces handed to the resource manager.
+   * \throws std::runtime_error if an interface has no InterfaceDescription in the component or an
+   * extrapolated interface is not a scalar double interface.
+   */
+  std::vector<StateInterface::ConstSharedPtr> separate_exported_state_interfaces(
+    const std::vector<StateInterface::ConstSharedPtr> & state_interfaces)
+  {
+    const std::initializer_list<const std::unordered_map<std::string, InterfaceDescription> *>
+      descriptions = {
+        &joint_state_interfaces_, &sensor_state_interfaces_, &gpio_state_interfaces_,
+        &unlisted_state_interfaces_};
+    std::vector<StateInterface::ConstSharedPtr> exported_state_interfaces;
+    exported_state_interfaces.reserve(state_interfaces.size());
+    update_tracked_states_.clear();
+    for (const auto & state_interface : state_interfaces)
+    {
+      if (!state_interface->is_bound_to_memory())
+      {
+        update_tracked_states_.push_back(state_interface);
+      }
+      const auto & name = state_interface->get_name();
+      auto extrapolator = get_state_extrapolator(name, descriptions);
+      if (!is_pipelined() && extrapolator.get_extrapolation() == StateExtrapolation::NONE)
+      {
+        exported_state_interfaces.push_back(state_interface);
+        continue;
+      }
+      auto exported_state_interface =
+        std::make_shared<StateInterface>(get_separate_description(name, descriptions));
+      if (is_pipelined())
+      {
+        pipelined_states_.emplace_back(state_interface, exported_state_interface);
+      }
+      else
+      {
+        extrapolated_states_.push_back(
+          {state_interface, exported_state_interface,
+           find_derivative_state(*state_interface, state_interfaces), std::move(extrapolator),
+           state_interface->get_update_sequence()});
+      }
+      exported_state_interfaces.push_back(exported_state_interface);
+    }
+    return exported_state_interfaces;
+  }
+
+  /// Number of runtime overruns of the async thread scheduled with SCHED_DEADLINE.
+  /**
+   * \returns 0 if the component is not async, or if its thread isn't scheduled with SCHED_DEADLINE.
+   */
+  uint64_t get_deadline_overruns() const { return deadline_overrun_counter_.get_count(); }
+
+  /// Pin the async thread to CPUs, applied by the thread itself with its next cycle.
+  /**
+   * Used by the controller manager to place the async thread on the CPU topology. The CPUs replace
+   * the ones set by the `affinity` attribute of the async tag. Nothing is done if the
+   * component is not async.
+   *
+   * \param[in] cpus CPUs the async thread is pinned to.
+   */
+  void set_async_thread_cpu_affinity(const std::vector<int> & cpus)
+  {
+    std::lock_guard<std::mutex> lock(async_thread_cpu_affinity_mutex_);
+    async_thread_cpu_affinity_ = cpus;
+    async_thread_cpu_affinity_pending_.store(true, std::memory_order_release);
+  }
+
+  /// Get the memory resource for allocations in the real-time loop, e.g., by pmr containers.
+  /**
+   * The resource is the RealtimeMemoryArena of the component if the `realtime_memory_arena_size`
+   * attribute of its `ros2_control` tag is set, and the default memory resource otherwise. The
+   * arena is created before on_init() and lives as long as the component.
+   *
+   * \returns the memory resource, never nullptr.
+   */
+  std::pmr::memory_resource * get_realtime_memory_resource() const
+  {
+    return realtime_memory_arena_ ? realtime_memory_arena_.get() : std::pmr::get_default_resource();
+  }
+
+  /// Get the usage of the real-time memory arena, all zero if the component has no arena.
+  RealtimeMemoryArenaStatistics get_realtime_memory_arena_statistics() const
+  {
+    return realtime_memory_arena_ ? realtime_memory_arena_->get_statistics()
+                                  : RealtimeMemoryArenaStatistics{};
+  }
+
+  /// Hand over the extrapolated states updated by the component, or predict them.
+  /**
+   * Called by the resource manager in every read cycle, also if the component is not read in the
+   * cycle due to its rw_rate. States updated by read() since the previous call are handed over to
+   * the exported state interfaces and added as samples of their StateExtrapolator. The other
+   * states are predicted at the given time and flagged as predicted, see
+   * StateInterface::is_predicted(). Predictions don't advance the update sequence of the exported
+   * state interfaces.
+   *
+   * \param[in] time The time of the read cycle of the resource manager.
+   */
+  void extrapolate_states(const rclcpp::Time & time)
+  {
+    for (auto & extrapolated_state : extrapolated_states_)
+    {
+      const auto & state = *extrapolated_state.state;
+      auto & exported_state = *extrapolated_state.exported_state;
+      const uint64_t update_sequence = state.get_update_sequence();
+      if (update_sequence != extrapolated_state.update_sequence)
+      {
+        const auto value = state.get_optional();
+        const auto update_time = state.get_update_time();
+        // states locked by the component are handed over in the next cycle
+        if (
+          !value.has_value() || !update_time.has_value() ||
+          !exported_state.copy_values_from(state))
+        {
+          continue;
+        }
+        const double derivative = extrapolated_state.derivative_state
+                                    ? extrapolated_state.derivative_state->get_optional().value_or(
+                                        std::numeric_limits<double>::quiet_NaN())
+                                    : std::numeric_limits<double>::quiet_NaN();
+        extrapolated_state.extrapolator.add_sample(
+          update_time->get_clock_type() != RCL_CLOCK_UNINITIALIZED ? update_time->nanoseconds()
+                                                                   : time.nanoseconds(),
+          value.value(), derivative);
+        extrapolated_state.update_sequence = update_sequence;
+        exported_state.set_predicted(false);
+      }
+      else if (extrapolated_state.extrapolator.get_number_of_samples() > 0)
+      {
+        // predictions don't advance the update sequence, so they don't trigger the controllers
+        // updated on new state samples
+        (void)exported_state.set_predicted_value(
+          extrapolated_state.extrapolator.extrapolate(time.nanoseconds()));
+      }
+    }
+  }
+
+  /// Create the command interfaces handed to the resource manager by pipelined components and for
+  /// interpolated commands.
+  /**
+   * The counterpart of separate_exported_state_interfaces(), the values of the second set are
+   * handed over to the interfaces used by write() in trigger_read().
+   *
+   * Command interfaces of detached asynchronous components with the `interpolation` parameter
+   * ("linear" or "cubic") are separated as well. Their values are added as setpoints of a
+   * CommandInterpolator in trigger_write(), and the async thread sets the interpolated commands
+   * before each write(), so that hardware running with a higher rw_rate than the controller
+   * manager receives a smooth command stream instead of repeated setpoints.
+   *
+   * \param[in] command_interfaces the command interfaces exported by the component.
+   * \return the command interfaces handed to the resource manager.
+   * \throws std::runtime_error if an interface has no InterfaceDescription in the component or an
+   * interpolated interface is not a scalar double interface.
+   */
+  std::vector<CommandInterface::SharedPtr> separate_exported_command_interfaces(
+    const std::vector<CommandInterface::SharedPtr> & command_interfaces)
+  {
+    const std::initializer_list<const std::unordered_map<std::string, InterfaceDescription> *>
+      descriptions = {
+        &joint_command_interfaces_, &gpio_command_interfaces_, &unlisted_command_interfaces_};
+    std::vector<CommandInterface::SharedPtr> exported_command_interfaces;
+    exported_command_interfaces.reserve(command_interfaces.size());
+    for (const auto & command_interface : command_interfaces)
+    {
+      const auto & name = command_interface->get_name();
+      const auto interpolation = get_command_interpolation(name, descriptions);
+      if (!is_pipelined() && interpolation == CommandInterpolation::NONE)
+      {
+        exported_command_interfaces.push_back(command_interface);
+        continue;
+      }
+      auto exported_command_interface =
+        std::make_shared<CommandInterface>(get_separate_description(name, descriptions));
+      if (is_pipelined())
+      {
+        pipelined_commands_.emplace_back(exported_command_interface, command_interface);
+      }
+      else
+      {
+        interpolated_commands_.push_back(
+          {exported_command_interface, command_interface, CommandInterpolator(interpolation)});
+      }
+      exported_command_interfaces.push_back(exported_command_interface);
+    }
+    return exported_command_interfaces;
+  }
+
   /// Prepare for a new command interface switch.
   /**
    * Prepare for any mode-switching required by the new command interface combination.
@@ -563,6 +812,11 @@ public:
    * That is, the data pointed by the interfaces shall be updated.
    * The method is called in the resource_manager's read loop
    *
+   * Pipelined components wait for the I/O cycle triggered in the previous cycle, hand over its
+   * states to the exported state interfaces and the exported commands to the interfaces of the
+   * component, and trigger the next I/O cycle, which writes these commands and reads the states
+   * for the next cycle while the controllers are updated.
+   *
    * \param[in] time The time at the start of this control loop iteration
    * \param[in] period The measured time taken by the last control loop iteration
    * \return return_type::OK if the read was successful, return_type::ERROR otherwise.
@@ -572,7 +826,28 @@ public:
   {
     HardwareComponentCycleStatus status;
     status.result = return_type::ERROR;
-    if (info_.is_async)
+    if (is_pipelined())
+    {
+      // the values can only be handed over once the I/O cycle of the previous cycle is finished
+      async_handler_->wait_for_trigger_cycle_to_finish();
+      status.result = read_return_info_.load(std::memory_order_acquire);
+      const auto read_exec_time = read_execution_time_.load(std::memory_order_acquire);
+      if (read_exec_time.count() > 0)
+      {
+        status.execution_time = read_exec_time;
+      }
+      // interfaces locked by other threads keep their values until the next cycle
+      for (const auto & [state, exported_state] : pipelined_states_)
+      {
+        std::ignore = exported_state->copy_values_from(*state);
+      }
+      for (const auto & [exported_command, command] : pipelined_commands_)
+      {
+        std::ignore = command->copy_values_from(*exported_command);
+      }
+      status.successful = async_handler_->trigger_async_callback(time, period).first;
+    }
+    else if (info_.is_async)
     {
       status.result = read_return_info_.load(std::memory_order_acquire);
       const auto read_exec_time = read_execution_time_.load(std::memory_order_acquire);
@@ -597,6 +872,7 @@ public:
     {
       const auto start_time = std::chrono::steady_clock::now();
       status.successful = true;
+      read_cycle_time_ = time;
       status.result = read(time, period);
       status.execution_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
         std::chrono::steady_clock::now() - start_time);
@@ -633,6 +909,10 @@ public:
     status.result = return_type::ERROR;
     if (info_.is_async)
     {
+      if (!interpolated_commands_.empty())
+      {
+        add_command_setpoints(time);
+      }
       status.successful = true;
       const auto write_exec_time = write_execution_time_.load(std::memory_order_acquire);
       if (write_exec_time.count() > 0)
@@ -727,6 +1007,7 @@ public:
     auto & handle = it->second;
     std::unique_lock<std::shared_mutex> lock(handle->get_mutex());
     std::ignore = handle->set_value(lock, value);
+    handle->set_update_time(lock, read_cycle_time_);
   }
 
   /// Get the value from a state interface.
@@ -834,6 +1115,326 @@ public:
     return opt_value.value();
   }
 
+  /// Set all values of an array state interface at once.
+  /**
+   * \tparam T The type of the values, has to match the data type of the interface.
+   * \param[in] interface_name The name of the state interface to access.
+   * \param[in] values The values to store, have to have the size of the interface.
+   * \throws std::runtime_error This method throws a runtime error if it cannot
+   * access the state interface or it is not an array of T with the same size.
+   */
+  template <typename T>
+  void set_state_array(const std::string & interface_name, Span<const T> values)
+  {
+    auto it = hardware_states_.find(interface_name);
+    if (it == hardware_states_.end())
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE(
+            "State interface not found: {} in hardware component: {}. "
+            "This should not happen."),
+          interface_name, info_.name));
+    }
+    auto & handle = it->second;
+    if (handle->get_size() != values.size())
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Got {} values for state interface: {} of size {}."), values.size(),
+          interface_name, handle->get_size()));
+    }
+    std::unique_lock<std::shared_mutex> lock(handle->get_mutex());
+    std::ignore = handle->set_array_values(lock, values);
+    handle->set_update_time(lock, read_cycle_time_);
+  }
+
+  /// Get all values of an array command interface at once.
+  /**
+   * \tparam T The type of the values, has to match the data type of the interface.
+   * \param[in] interface_name The name of the command interface to access.
+   * \param[out] values The destination of the values, has to have the size of the interface.
+   * \throws std::runtime_error This method throws a runtime error if it cannot
+   * access the command interface or it is not an array of T with the same size.
+   */
+  template <typename T>
+  void get_command_array(const std::string & interface_name, Span<T> values) const
+  {
+    auto it = hardware_commands_.find(interface_name);
+    if (it == hardware_commands_.end())
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE(
+            "Command interface not found: {} in hardware component: {}. "
+            "This should not happen."),
+          interface_name, info_.name));
+    }
+    auto & handle = it->second;
+    if (handle->get_size() != values.size())
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Got {} values for command interface: {} of size {}."), values.size(),
+          interface_name, handle->get_size()));
+    }
+    std::shared_lock<std::shared_mutex> lock(handle->get_mutex());
+    std::ignore = handle->get_array_values(lock, values);
+  }
+
+  /// Resolve a state interface once for the frequent access of its value in read().
+  /**
+   * In contrast to get_state() and set_state(), the accessor doesn't look up the interface by name
+   * on each access. Has to be called after the interfaces are exported, e.g. in on_configure().
+   * Values set through the accessor are stamped with the time of the current read cycle.
+   *
+   * \tparam T The type of the value, has to match the data type of the interface.
+   * \param[in] interface_name The name of the state interface to access.
+   * \return the accessor, which must not outlive the hardware component.
+   * \throws std::runtime_error This method throws a runtime error if the state interface doesn't
+   * exist, is an array or its data type doesn't match T.
+   */
+  template <typename T = double>
+  StateInterfaceAccessor<T> get_state_accessor(const std::string & interface_name) const
+  {
+    auto it = hardware_states_.find(interface_name);
+    if (it == hardware_states_.end())
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("State interface not found: {} in hardware component: {}."), interface_name,
+          info_.name));
+    }
+    return StateInterfaceAccessor<T>(it->second, &read_cycle_time_);
+  }
+
+  /// Resolve a command interface once for the frequent access of its value in write().
+  /**
+   * In contrast to get_command() and set_command(), the accessor doesn't look up the interface by
+   * name on each access. Has to be called after the interfaces are exported, e.g. in
+   * on_configure().
+   *
+   * \tparam T The type of the value, has to match the data type of the interface.
+   * \param[in] interface_name The name of the command interface to access.
+   * \return the accessor, which must not outlive the hardware component.
+   * \throws std::runtime_error This method throws a runtime error if the command interface doesn't
+   * exist, is an array or its data type doesn't match T.
+   */
+  template <typename T = double>
+  CommandInterfaceAccessor<T> get_command_accessor(const std::string & interface_name) const
+  {
+    auto it = hardware_commands_.find(interface_name);
+    if (it == hardware_commands_.end())
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Command interface not found: {} in hardware component: {}."),
+          interface_name, info_.name));
+    }
+    return CommandInterfaceAccessor<T>(it->second);
+  }
+
+  /// Resolve an array state interface once for the frequent access of its values in read().
+  /**
+   * Values set through the accessor are stamped with the time of the current read cycle.
+   *
+   * \tparam T The type of the values, has to match the data type of the interface.
+   * \param[in] interface_name The name of the state interface to access.
+   * \return the accessor, which must not outlive the hardware component.
+   * \throws std::runtime_error This method throws a runtime error if the state interface doesn't
+   * exist, is not an array or its data type doesn't match T.
+   */
+  template <typename T = double>
+  StateInterfaceArrayAccessor<T> get_state_array_accessor(const std::string & interface_name) const
+  {
+    auto it = hardware_states_.find(interface_name);
+    if (it == hardware_states_.end())
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("State interface not found: {} in hardware component: {}."), interface_name,
+          info_.name));
+    }
+    return StateInterfaceArrayAccessor<T>(it->second, &read_cycle_time_);
+  }
+
+  /// Resolve an array command interface once for the frequent access of its values in write().
+  /**
+   * \tparam T The type of the values, has to match the data type of the interface.
+   * \param[in] interface_name The name of the command interface to access.
+   * \return the accessor, which must not outlive the hardware component.
+   * \throws std::runtime_error This method throws a runtime error if the command interface doesn't
+   * exist, is not an array or its data type doesn't match T.
+   */
+  template <typename T = double>
+  CommandInterfaceArrayAccessor<T> get_command_array_accessor(
+    const std::string & interface_name) const
+  {
+    auto it = hardware_commands_.find(interface_name);
+    if (it == hardware_commands_.end())
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE("Command interface not found: {} in hardware component: {}."),
+          interface_name, info_.name));
+    }
+    return CommandInterfaceArrayAccessor<T>(it->second);
+  }
+
+  /// Back the values of a state interface with memory owned by the hardware component.
+  /**
+   * The values written to the memory, e.g. by a fieldbus master, are read by the controllers
+   * without copying them in read(). Has to be called before the interfaces are exported, e.g. in
+   * on_init(). Interfaces not defined in the URDF can be bound with
+   * InterfaceDescription::bind_memory() in export_unlisted_state_interface_descriptions().
+   *
+   * \tparam T The type of the values, has to match the data type of the interface.
+   * \param[in] interface_name The name of the state interface, e.g. "joint1/position".
+   * \param[in] data Address of the first value, has to outlive the exported interfaces.
+   * \param[in] byte_order Byte order of the values in memory.
+   * \throws std::runtime_error if the interface is not defined or already exported.
+   * \throws std::invalid_argument if data isn't aligned for T or T doesn't match the data type
+   * of the interface.
+   */
+  template <typename T>
+  void bind_state_interface_memory(
+    const std::string & interface_name, T * data,
+    InterfaceMemory::ByteOrder byte_order = InterfaceMemory::ByteOrder::NATIVE)
+  {
+    get_state_interface_description_to_bind(interface_name).bind_memory(data, byte_order);
+  }
+
+  /// Back the values of a state interface with memory of any alignment, e.g. a process image.
+  /**
+   * \param[in] interface_name The name of the state interface, e.g. "joint1/position".
+   * \param[in] data Address of the first byte of the first value, has to outlive the exported
+   * interfaces.
+   * \param[in] data_type The type of the values, has to match the data type of the interface.
+   * \param[in] byte_order Byte order of the values in memory.
+   * \throws std::runtime_error if the interface is not defined or already exported.
+   * \throws std::invalid_argument if data_type doesn't match the data type of the interface.
+   */
+  void bind_state_interface_memory(
+    const std::string & interface_name, void * data, HandleDataType data_type,
+    InterfaceMemory::ByteOrder byte_order = InterfaceMemory::ByteOrder::NATIVE)
+  {
+    get_state_interface_description_to_bind(interface_name)
+      .bind_memory(data, data_type, byte_order);
+  }
+
+  /// Back the values of a command interface with memory owned by the hardware component.
+  /**
+   * The commands written by the controllers end up in the memory, e.g. the output process image
+   * of a fieldbus master, without copying them in write(). Has to be called before the interfaces
+   * are exported, e.g. in on_init(). Interfaces not defined in the URDF can be bound with
+   * InterfaceDescription::bind_memory() in export_unlisted_command_interface_descriptions().
+   *
+   * \tparam T The type of the values, has to match the data type of the interface.
+   * \param[in] interface_name The name of the command interface, e.g. "joint1/position".
+   * \param[in] data Address of the first value, has to outlive the exported interfaces.
+   * \param[in] byte_order Byte order of the values in memory.
+   * \throws std::runtime_error if the interface is not defined or already exported.
+   * \throws std::invalid_argument if data isn't aligned for T or T doesn't match the data type
+   * of the interface.
+   */
+  template <typename T>
+  void bind_command_interface_memory(
+    const std::string & interface_name, T * data,
+    InterfaceMemory::ByteOrder byte_order = InterfaceMemory::ByteOrder::NATIVE)
+  {
+    get_command_interface_description_to_bind(interface_name).bind_memory(data, byte_order);
+  }
+
+  /// Back the values of a command interface with memory of any alignment, e.g. a process image.
+  /**
+   * \param[in] interface_name The name of the command interface, e.g. "joint1/position".
+   * \param[in] data Address of the first byte of the first value, has to outlive the exported
+   * interfaces.
+   * \param[in] data_type The type of the values, has to match the data type of the interface.
+   * \param[in] byte_order Byte order of the values in memory.
+   * \throws std::runtime_error if the interface is not defined or already exported.
+   * \throws std::invalid_argument if data_type doesn't match the data type of the interface.
+   */
+  void bind_command_interface_memory(
+    const std::string & interface_name, void * data, HandleDataType data_type,
+    InterfaceMemory::ByteOrder byte_order = InterfaceMemory::ByteOrder::NATIVE)
+  {
+    get_command_interface_description_to_bind(interface_name)
+      .bind_memory(data, data_type, byte_order);
+  }
+
+  /// Get the sum of the update sequences of the exported state interfaces.
+  /**
+   * The sum increases whenever a state interface is updated, it is used to detect components
+   * whose states are not updated anymore. State interfaces bound to memory of the component are
+   * not included, as their values are updated without the interfaces.
+   *
+   * \return the sum, std::nullopt if no exported state interface is tracked.
+   */
+  std::optional<uint64_t> get_state_update_sequence() const
+  {
+    if (update_tracked_states_.empty())
+    {
+      return std::nullopt;
+    }
+    uint64_t sequence = 0;
+    for (const auto & state : update_tracked_states_)
+    {
+      sequence += state->get_update_sequence();
+    }
+    return sequence;
+  }
+
+  /// Call a function for each command interface changed since it was transmitted last.
+  /**
+   * Allows write() to transmit only the changed commands, e.g., on bandwidth-limited buses. A
+   * command is marked as transmitted after the function returned true for it, or returned nothing.
+   * Commands whose transmission failed stay dirty and are visited again by the next call, also if
+   * they are not changed meanwhile. A change while the function is called keeps the command dirty
+   * as well.
+   *
+   * \param[in] callback function called with the const reference to each changed CommandInterface,
+   * returning false if the command could not be transmitted.
+   * \return number of changed command interfaces.
+   */
+  template <typename Callback>
+  size_t for_each_dirty_command(Callback && callback)
+  {
+    size_t number_of_dirty_commands = 0;
+    for (auto * commands : {&joint_commands_, &gpio_commands_, &unlisted_commands_})
+    {
+      for (const auto & command : *commands)
+      {
+        if (!command->is_dirty())
+        {
+          continue;
+        }
+        ++number_of_dirty_commands;
+        const uint64_t change_count = command->get_change_count();
+        const auto & transmitted_command = static_cast<const CommandInterface &>(*command);
+        if constexpr (std::is_void_v<std::invoke_result_t<Callback &, const CommandInterface &>>)
+        {
+          callback(transmitted_command);
+        }
+        else if (!callback(transmitted_command))
+        {
+          continue;
+        }
+        command->clear_dirty(change_count);
+      }
+    }
+    return number_of_dirty_commands;
+  }
+
+  /// Mark all command interfaces as dirty, e.g., to retransmit them after reconnecting.
+  void mark_all_commands_dirty()
+  {
+    for (auto & [name, command] : hardware_commands_)
+    {
+      command->mark_dirty();
+    }
+  }
+
   /// Get the logger of the HardwareComponentInterface.
   /**
    * \return logger of the HardwareComponentInterface.
@@ -881,6 +1482,16 @@ public:
     read_execution_time_.store(std::chrono::nanoseconds::zero(), std::memory_order_release);
     write_return_info_.store(return_type::OK, std::memory_order_release);
     write_execution_time_.store(std::chrono::nanoseconds::zero(), std::memory_order_release);
+    for (auto & extrapolated_state : extrapolated_states_)
+    {
+      extrapolated_state.extrapolator.reset();
+      extrapolated_state.exported_state->set_predicted(false);
+    }
+    std::lock_guard<std::mutex> lock(interpolation_mutex_);
+    for (auto & interpolated_command : interpolated_commands_)
+    {
+      interpolated_command.interpolator.reset();
+    }
   }
 
   /// Enable or disable introspection of the hardware.
@@ -914,6 +1525,8 @@ protected:
   std::unordered_map<std::string, InterfaceDescription> unlisted_command_interfaces_;
 
   rclcpp_lifecycle::State lifecycle_state_;
+  // declared before the async handler, so that it outlives the allocations of the async thread
+  std::unique_ptr<RealtimeMemoryArena> realtime_memory_arena_;
   std::unique_ptr<realtime_tools::AsyncFunctionHandler<return_type>> async_handler_;
 
   // Exported Command- and StateInterfaces in order they are listed in the hardware description.
@@ -929,16 +1542,385 @@ protected:
   std::vector<CommandInterface::SharedPtr> unlisted_commands_;
 
 private:
+  /// Get the description of a state interface that is not exported yet, to bind it to memory.
+  InterfaceDescription & get_state_interface_description_to_bind(
+    const std::string & interface_name)
+  {
+    if (hardware_states_.find(interface_name) != hardware_states_.end())
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE(
+            "Cannot bind state interface: {} of hardware component: {} to memory, as it is "
+            "already exported."),
+          interface_name, info_.name));
+    }
+    for (auto * descriptions :
+         {&joint_state_interfaces_, &sensor_state_interfaces_, &gpio_state_interfaces_})
+    {
+      auto it = descriptions->find(interface_name);
+      if (it != descriptions->end())
+      {
+        return it->second;
+      }
+    }
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("State interface not found: {} in hardware component: {}."), interface_name,
+        info_.name));
+  }
+
+  /// Get the description of a command interface that is not exported yet, to bind it to memory.
+  InterfaceDescription & get_command_interface_description_to_bind(
+    const std::string & interface_name)
+  {
+    if (hardware_commands_.find(interface_name) != hardware_commands_.end())
+    {
+      throw std::runtime_error(
+        fmt::format(
+          FMT_COMPILE(
+            "Cannot bind command interface: {} of hardware component: {} to memory, as it is "
+            "already exported."),
+          interface_name, info_.name));
+    }
+    for (auto * descriptions : {&joint_command_interfaces_, &gpio_command_interfaces_})
+    {
+      auto it = descriptions->find(interface_name);
+      if (it != descriptions->end())
+      {
+        return it->second;
+      }
+    }
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Command interface not found: {} in hardware component: {}."), interface_name,
+        info_.name));
+  }
+
+  /// Read on the async worker thread, storing the result and the execution time.
+  return_type async_read(const rclcpp::Time & time, const rclcpp::Duration & period)
+  {
+    const auto read_start_time = std::chrono::steady_clock::now();
+    read_cycle_time_ = time;
+    const auto ret_read = read(time, period);
+    const auto read_end_time = std::chrono::steady_clock::now();
+    read_return_info_.store(ret_read, std::memory_order_release);
+    read_execution_time_.store(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(read_end_time - read_start_time),
+      std::memory_order_release);
+    return ret_read;
+  }
+
+  /// Write on the async worker thread if the component is an active actuator or system.
+  return_type async_write(const rclcpp::Time & time, const rclcpp::Duration & period)
+  {
+    if (
+      info_.type == "sensor" ||
+      this->get_lifecycle_state().id() != lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+    {
+      return return_type::OK;
+    }
+    if (!interpolated_commands_.empty())
+    {
+      set_interpolated_commands(time);
+    }
+    const auto write_start_time = std::chrono::steady_clock::now();
+    const auto ret_write = write(time, period);
+    const auto write_end_time = std::chrono::steady_clock::now();
+    write_return_info_.store(ret_write, std::memory_order_release);
+    write_execution_time_.store(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(write_end_time - write_start_time),
+      std::memory_order_release);
+    return ret_write;
+  }
+
+  /// Replace SCHED_FIFO of the async thread by SCHED_DEADLINE, called by the thread itself.
+  /**
+   * The thread keeps SCHED_FIFO if the reservation is rejected, e.g., by the admission control of
+   * the kernel.
+   */
+  void configure_async_thread_sched_deadline()
+  {
+    async_thread_scheduled_ = true;
+    const auto [success, reason] = configure_sched_deadline(deadline_scheduling_);
+    if (!success)
+    {
+      RCLCPP_WARN(
+        get_logger(),
+        "Could not set SCHED_DEADLINE of the async thread, it keeps SCHED_FIFO with priority %d: "
+        "%s",
+        info_.async_params.thread_priority, reason.c_str());
+      return;
+    }
+    if (!deadline_overrun_counter_.attach_to_current_thread())
+    {
+      RCLCPP_WARN(get_logger(), "The deadline overruns of the async thread are not counted.");
+    }
+  }
+
+  /// Pin the async thread to the CPUs of set_async_thread_cpu_affinity(), called by the thread.
+  void apply_async_thread_cpu_affinity()
+  {
+    std::unique_lock<std::mutex> lock(async_thread_cpu_affinity_mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+      // retried with the next cycle
+      return;
+    }
+    async_thread_cpu_affinity_pending_.store(false, std::memory_order_relaxed);
+    const auto [success, reason] =
+      realtime_tools::set_current_thread_affinity(async_thread_cpu_affinity_);
+    if (!success)
+    {
+      RCLCPP_WARN(
+        get_logger(), "Could not set the CPU affinity of the async thread: %s", reason.c_str());
+    }
+  }
+
+  /// Get the description of an interface for the set handed to the resource manager.
+  InterfaceDescription get_separate_description(
+    const std::string & interface_name,
+    std::initializer_list<const std::unordered_map<std::string, InterfaceDescription> *>
+      descriptions) const
+  {
+    for (const auto * description_map : descriptions)
+    {
+      const auto it = description_map->find(interface_name);
+      if (it != description_map->end())
+      {
+        auto description = it->second;
+        // the values of the second set are owned by the interfaces
+        description.memory = InterfaceMemory();
+        return description;
+      }
+    }
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("Interface: {} of the hardware component: {} has no description."),
+        interface_name, info_.name));
+  }
+
+  /// Get the interpolation of a command interface from its `interpolation` parameter.
+  CommandInterpolation get_command_interpolation(
+    const std::string & interface_name,
+    std::initializer_list<const std::unordered_map<std::string, InterfaceDescription> *>
+      descriptions) const
+  {
+    for (const auto * description_map : descriptions)
+    {
+      const auto it = description_map->find(interface_name);
+      if (it == description_map->end())
+      {
+        continue;
+      }
+      const auto & interface_info = it->second.interface_info;
+      const auto parameter = interface_info.parameters.find(kCommandInterpolationParameter);
+      if (parameter == interface_info.parameters.end())
+      {
+        return CommandInterpolation::NONE;
+      }
+      const auto interpolation = parse_command_interpolation(parameter->second);
+      if (interpolation == CommandInterpolation::NONE)
+      {
+        return interpolation;
+      }
+      if (!info_.is_async || info_.async_params.scheduling_policy != "detached")
+      {
+        RCLCPP_WARN(
+          get_logger(),
+          "The interpolation of the command interface '%s' is ignored, it is only supported by "
+          "asynchronous hardware components with the 'detached' scheduling policy.",
+          interface_name.c_str());
+        return CommandInterpolation::NONE;
+      }
+      if (interface_info.data_type != "double" || interface_info.size > 1)
+      {
+        throw std::runtime_error(
+          fmt::format(
+            FMT_COMPILE(
+              "The command interface: {} of the hardware component: {} can't be interpolated, "
+              "only scalar double interfaces are supported."),
+            interface_name, info_.name));
+      }
+      return interpolation;
+    }
+    return CommandInterpolation::NONE;
+  }
+
+  /// Get the extrapolator of a state interface from its `extrapolation` parameters.
+  StateExtrapolator get_state_extrapolator(
+    const std::string & interface_name,
+    std::initializer_list<const std::unordered_map<std::string, InterfaceDescription> *>
+      descriptions) const
+  {
+    for (const auto * description_map : descriptions)
+    {
+      const auto it = description_map->find(interface_name);
+      if (it == description_map->end())
+      {
+        continue;
+      }
+      const auto & parameters = it->second.interface_info.parameters;
+      const auto parameter = parameters.find(kStateExtrapolationParameter);
+      if (parameter == parameters.end())
+      {
+        return StateExtrapolator(StateExtrapolation::NONE);
+      }
+      StateExtrapolator extrapolator(parse_state_extrapolation(parameter->second));
+      if (extrapolator.get_extrapolation() == StateExtrapolation::NONE)
+      {
+        return extrapolator;
+      }
+      if (is_pipelined())
+      {
+        RCLCPP_WARN(
+          get_logger(),
+          "The extrapolation of the state interface '%s' is ignored, the states of pipelined "
+          "hardware components are handed over in every cycle.",
+          interface_name.c_str());
+        return StateExtrapolator(StateExtrapolation::NONE);
+      }
+      const auto & interface_info = it->second.interface_info;
+      if (interface_info.data_type != "double" || interface_info.size > 1)
+      {
+        throw std::runtime_error(
+          fmt::format(
+            FMT_COMPILE(
+              "The state interface: {} of the hardware component: {} can't be extrapolated, "
+              "only scalar double interfaces are supported."),
+            interface_name, info_.name));
+      }
+      const auto alpha = parameters.find(kStateExtrapolationAlphaParameter);
+      const auto beta = parameters.find(kStateExtrapolationBetaParameter);
+      extrapolator.set_filter_gains(
+        alpha != parameters.end() ? hardware_interface::stod(alpha->second)
+                                  : StateExtrapolator::kDefaultAlpha,
+        beta != parameters.end() ? hardware_interface::stod(beta->second)
+                                 : StateExtrapolator::kDefaultBeta);
+      const auto horizon = parameters.find(kStateExtrapolationHorizonParameter);
+      if (horizon != parameters.end())
+      {
+        extrapolator.set_horizon(
+          static_cast<int64_t>(std::llround(hardware_interface::stod(horizon->second) * 1e9)));
+      }
+      return extrapolator;
+    }
+    return StateExtrapolator(StateExtrapolation::NONE);
+  }
+
+  /// Find the state with the derivative of a position or velocity state of the same prefix.
+  static StateInterface::ConstSharedPtr find_derivative_state(
+    const StateInterface & state,
+    const std::vector<StateInterface::ConstSharedPtr> & state_interfaces)
+  {
+    const std::string & interface_name = state.get_interface_name();
+    const char * derivative_name = interface_name == HW_IF_POSITION   ? HW_IF_VELOCITY
+                                   : interface_name == HW_IF_VELOCITY ? HW_IF_ACCELERATION
+                                                                      : nullptr;
+    if (derivative_name == nullptr)
+    {
+      return nullptr;
+    }
+    for (const auto & state_interface : state_interfaces)
+    {
+      if (
+        state_interface->get_prefix_name() == state.get_prefix_name() &&
+        state_interface->get_interface_name() == derivative_name &&
+        state_interface->get_data_type() == HandleDataType::DOUBLE && !state_interface->is_array())
+      {
+        return state_interface;
+      }
+    }
+    return nullptr;
+  }
+
+  /// Add the commands of the controller manager as setpoints of the interpolated commands.
+  void add_command_setpoints(const rclcpp::Time & time)
+  {
+    std::unique_lock<std::mutex> lock(interpolation_mutex_, std::try_to_lock);
+    // a missing setpoint stretches the interpolation over two cycles
+    if (!lock.owns_lock())
+    {
+      return;
+    }
+    for (auto & interpolated_command : interpolated_commands_)
+    {
+      const auto setpoint = interpolated_command.exported_command->get_optional();
+      if (setpoint.has_value())
+      {
+        interpolated_command.interpolator.add_setpoint(time.nanoseconds(), setpoint.value());
+      }
+    }
+  }
+
+  /// Set the commands interpolated at the given time before write() of the async thread.
+  void set_interpolated_commands(const rclcpp::Time & time)
+  {
+    std::unique_lock<std::mutex> lock(interpolation_mutex_, std::try_to_lock);
+    // the commands of the last write are kept if the setpoints are being added
+    if (!lock.owns_lock())
+    {
+      return;
+    }
+    for (auto & interpolated_command : interpolated_commands_)
+    {
+      if (interpolated_command.interpolator.get_number_of_setpoints() > 0)
+      {
+        std::ignore = interpolated_command.command->set_value(
+          interpolated_command.interpolator.interpolate(time.nanoseconds()));
+      }
+    }
+  }
+
   rclcpp::Clock::SharedPtr clock_;
   rclcpp::Logger logger_;
   rclcpp::Node::SharedPtr hardware_component_node_ = nullptr;
   // interface names to Handle accessed through getters/setters
   std::unordered_map<std::string, StateInterface::SharedPtr> hardware_states_;
   std::unordered_map<std::string, CommandInterface::SharedPtr> hardware_commands_;
+  // exported state interfaces not bound to memory of the component, summed up by
+  // get_state_update_sequence()
+  std::vector<StateInterface::ConstSharedPtr> update_tracked_states_;
+  // time of the current or last read cycle, used to stamp the updated state interfaces
+  rclcpp::Time read_cycle_time_ = rclcpp::Time(0, 0, RCL_CLOCK_UNINITIALIZED);
+  // SCHED_DEADLINE reservation of the async thread, set by the thread with its first cycle
+  DeadlineSchedulingParams deadline_scheduling_;
+  bool async_thread_scheduled_ = false;
+  DeadlineOverrunCounter deadline_overrun_counter_;
+  // CPUs the async thread is pinned to by the thread itself, guarded by the mutex
+  std::mutex async_thread_cpu_affinity_mutex_;
+  std::vector<int> async_thread_cpu_affinity_;
+  std::atomic<bool> async_thread_cpu_affinity_pending_ = false;
   std::atomic<return_type> read_return_info_ = return_type::OK;
   std::atomic<std::chrono::nanoseconds> read_execution_time_ = std::chrono::nanoseconds::zero();
   std::atomic<return_type> write_return_info_ = return_type::OK;
   std::atomic<std::chrono::nanoseconds> write_execution_time_ = std::chrono::nanoseconds::zero();
+  // pipelined components: the interfaces of the component paired with the exported ones
+  std::vector<std::pair<StateInterface::ConstSharedPtr, StateInterface::SharedPtr>>
+    pipelined_states_;
+  std::vector<std::pair<CommandInterface::SharedPtr, CommandInterface::SharedPtr>>
+    pipelined_commands_;
+  // interpolated commands: the exported interface, the interface of the component and the
+  // setpoints of the controller manager
+  struct InterpolatedCommand
+  {
+    CommandInterface::SharedPtr exported_command;
+    CommandInterface::SharedPtr command;
+    CommandInterpolator interpolator;
+  };
+  std::vector<InterpolatedCommand> interpolated_commands_;
+  std::mutex interpolation_mutex_;
+  // extrapolated states: the interface of the component, the exported interface, the state with
+  // the derivative used by the linear extrapolation and the update sequence of the latest sample
+  struct ExtrapolatedState
+  {
+    StateInterface::ConstSharedPtr state;
+    StateInterface::SharedPtr exported_state;
+    StateInterface::ConstSharedPtr derivative_state;
+    StateExtrapolator extrapolator;
+    uint64_t update_sequence = 0;
+  };
+  std::vector<ExtrapolatedState> extrapolated_states_;
 
 protected:
   pal_statistics::RegistrationsRAII stats_registrations_;
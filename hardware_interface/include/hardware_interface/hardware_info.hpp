@@ -15,10 +15,15 @@
 #ifndef HARDWARE_INTERFACE__HARDWARE_INFO_HPP_
 #define HARDWARE_INTERFACE__HARDWARE_INFO_HPP_
 
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
+#include "hardware_interface/deadline_scheduling.hpp"
 #include "joint_limits/joint_limits.hpp"
 
 namespace hardware_interface
@@ -43,7 +48,7 @@ struct InterfaceInfo
   /// (Optional) The datatype of the interface, e.g. "bool", "int".
   std::string data_type = "double";
   /// (Optional) If the handle is an array, the size of the array.
-  int size;
+  int size = 1;
   /// (Optional) enable or disable the limits for the command interfaces
   bool enable_limits;
   /// (Optional) Key-value pairs of command/stateInterface parameters. This is
@@ -140,7 +145,12 @@ public:
   {
     UNKNOWN = -1,
     DOUBLE,
-    BOOL
+    BOOL,
+    FLOAT,
+    INT32,
+    INT64,
+    UINT8,
+    UINT16
   };
 
   HandleDataType() = default;
@@ -155,6 +165,26 @@ public:
     {
       value_ = BOOL;
     }
+    else if (data_type == "float")
+    {
+      value_ = FLOAT;
+    }
+    else if (data_type == "int32")
+    {
+      value_ = INT32;
+    }
+    else if (data_type == "int64")
+    {
+      value_ = INT64;
+    }
+    else if (data_type == "uint8")
+    {
+      value_ = UINT8;
+    }
+    else if (data_type == "uint16")
+    {
+      value_ = UINT16;
+    }
     else
     {
       value_ = UNKNOWN;
@@ -179,6 +209,16 @@ public:
         return "double";
       case BOOL:
         return "bool";
+      case FLOAT:
+        return "float";
+      case INT32:
+        return "int32";
+      case INT64:
+        return "int64";
+      case UINT8:
+        return "uint8";
+      case UINT16:
+        return "uint16";
       default:
         return "unknown";
     }
@@ -197,17 +237,118 @@ public:
         return true;
       case BOOL:
         return true;  // bool can be converted to double
+      case FLOAT:
+      case INT32:
+      case INT64:
+      case UINT8:
+      case UINT16:
+        return true;  // numeric types can be converted to double, int64 might lose precision
       default:
         return false;  // unknown type cannot be converted
     }
   }
 
+  /// Size of a single value of the type in bytes, 0 for unknown types.
+  size_t get_type_size() const
+  {
+    switch (value_)
+    {
+      case DOUBLE:
+        return sizeof(double);
+      case BOOL:
+        return sizeof(bool);
+      case FLOAT:
+        return sizeof(float);
+      case INT32:
+        return sizeof(int32_t);
+      case INT64:
+        return sizeof(int64_t);
+      case UINT8:
+        return sizeof(uint8_t);
+      case UINT16:
+        return sizeof(uint16_t);
+      default:
+        return 0u;
+    }
+  }
+
   HandleDataType from_string(const std::string & data_type) { return HandleDataType(data_type); }
 
+  /// Data type of the C++ type T, UNKNOWN if T is not supported.
+  template <typename T>
+  static constexpr Value of()
+  {
+    using U = std::remove_cv_t<T>;
+    if constexpr (std::is_same_v<U, double>)
+    {
+      return DOUBLE;
+    }
+    else if constexpr (std::is_same_v<U, bool>)
+    {
+      return BOOL;
+    }
+    else if constexpr (std::is_same_v<U, float>)
+    {
+      return FLOAT;
+    }
+    else if constexpr (std::is_same_v<U, int32_t>)
+    {
+      return INT32;
+    }
+    else if constexpr (std::is_same_v<U, int64_t>)
+    {
+      return INT64;
+    }
+    else if constexpr (std::is_same_v<U, uint8_t>)
+    {
+      return UINT8;
+    }
+    else if constexpr (std::is_same_v<U, uint16_t>)
+    {
+      return UINT16;
+    }
+    return UNKNOWN;
+  }
+
 private:
   Value value_ = UNKNOWN;
 };
 
+/// Memory owned by a hardware component that backs the values of an interface.
+/**
+ * Used to share e.g. the process image of a fieldbus master or a DMA buffer with the interface, so
+ * that the values are neither copied in read() nor in write(). The memory has to hold
+ * InterfaceInfo::size values of the data type of the interface and has to outlive the exported
+ * interfaces. The values are accessed in place if they are aligned for their type and stored in
+ * the native byte order, otherwise they are converted on each access.
+ */
+struct InterfaceMemory
+{
+  enum class ByteOrder : uint8_t
+  {
+    NATIVE,
+    LITTLE,
+    BIG
+  };
+
+  /// Address of the first value, nullptr if the values are owned by the interface.
+  void * data = nullptr;
+  /// Alignment of data in bytes.
+  size_t alignment = 1;
+  /// Byte order of the values in memory.
+  ByteOrder byte_order = ByteOrder::NATIVE;
+
+  /// Returns true if the values in memory have the byte order of the host.
+  bool is_native_byte_order() const
+  {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return byte_order != ByteOrder::LITTLE;
+#else
+    return byte_order != ByteOrder::BIG;
+#endif
+  }
+};
+
 /**
  * This structure stores information about an interface for a specific hardware which should be
  * instantiated internally.
@@ -245,6 +386,66 @@ struct InterfaceDescription
   const std::string & get_data_type_string() const { return interface_info.data_type; }
 
   HandleDataType get_data_type() const { return HandleDataType(interface_info.data_type); }
+
+  /**
+   * (Optional) Memory of the hardware component backing the values, see bind_memory().
+   */
+  InterfaceMemory memory;
+
+  /// Back the values of the interface with memory owned by the hardware component.
+  /**
+   * The initial value of the interface is not written to the memory. Use the overload taking the
+   * data type for memory that isn't aligned for T, e.g. an offset into a process image.
+   *
+   * \param[in] data address of the first value, has to hold interface_info.size values.
+   * \param[in] byte_order byte order of the values in memory.
+   * \throws std::invalid_argument if data is nullptr, not aligned for T or T doesn't match the
+   * data type.
+   */
+  template <
+    typename T, typename = std::enable_if_t<!std::is_const_v<T> && !std::is_void_v<T>>>
+  void bind_memory(
+    T * data, InterfaceMemory::ByteOrder byte_order = InterfaceMemory::ByteOrder::NATIVE)
+  {
+    if (reinterpret_cast<uintptr_t>(data) % alignof(T) != 0)
+    {
+      throw std::invalid_argument(
+        "Cannot bind interface '" + interface_name +
+        "' to a misaligned typed pointer, pass the address and the data type instead.");
+    }
+    bind_memory(static_cast<void *>(data), HandleDataType::of<T>(), byte_order);
+  }
+
+  /// Back the values of the interface with memory of any alignment owned by the hardware component.
+  /**
+   * The initial value of the interface is not written to the memory.
+   *
+   * \param[in] data address of the first byte of the first value, has to hold
+   * interface_info.size values.
+   * \param[in] data_type type of the values in memory.
+   * \param[in] byte_order byte order of the values in memory.
+   * \throws std::invalid_argument if data is nullptr or data_type doesn't match the data type.
+   */
+  void bind_memory(
+    void * data, HandleDataType data_type,
+    InterfaceMemory::ByteOrder byte_order = InterfaceMemory::ByteOrder::NATIVE)
+  {
+    if (data == nullptr)
+    {
+      throw std::invalid_argument("Cannot bind interface '" + interface_name + "' to nullptr.");
+    }
+    if (data_type == HandleDataType::UNKNOWN || data_type != get_data_type())
+    {
+      throw std::invalid_argument(
+        "Cannot bind interface '" + interface_name + "' of type '" + interface_info.data_type +
+        "' to memory of type '" + data_type.to_string() + "'.");
+    }
+    const auto address = reinterpret_cast<uintptr_t>(data);
+    memory.data = data;
+    // largest power of two dividing the address
+    memory.alignment = static_cast<size_t>(address & (~address + 1));
+    memory.byte_order = byte_order;
+  }
 };
 
 struct HardwareAsyncParams
@@ -257,6 +458,11 @@ struct HardwareAsyncParams
   std::vector<int> cpu_affinity_cores = {};
   /// Whether to print warnings when the async thread doesn't meet its deadline
   bool print_warnings = true;
+  /// Whether the write of the commands of the previous cycle and the read of the states for the
+  /// next cycle are executed by the async worker thread while the controllers are updated
+  bool pipelined = false;
+  /// SCHED_DEADLINE reservation of the async worker thread, replacing SCHED_FIFO if enabled
+  DeadlineSchedulingParams deadline_scheduling;
 };
 
 /// This structure stores information about hardware defined in a robot's URDF.
@@ -279,6 +485,8 @@ struct HardwareInfo
   unsigned int rw_rate;
   /// Component is async
   bool is_async;
+  /// Size of the real-time memory arena of the component in bytes, 0 if it has none.
+  size_t realtime_memory_arena_size = 0;
   /// Async thread priority
   [[deprecated("Use async_params instead.")]] int thread_priority;
   /// Async Parameters
@@ -0,0 +1,251 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__INTERFACE_ACCESSOR_HPP_
+#define HARDWARE_INTERFACE__INTERFACE_ACCESSOR_HPP_
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "hardware_interface/handle.hpp"
+#include "hardware_interface/macros.hpp"
+#include "hardware_interface/types/span.hpp"
+#include "rclcpp/time.hpp"
+
+namespace hardware_interface
+{
+/// Typed accessor of the value of a scalar interface, resolved once.
+/**
+ * The data type of the interface is checked and the storage of its value is resolved when the
+ * accessor is created, e.g., in on_configure() of a hardware component. Afterwards, the value is
+ * accessed in constant time without looking up the interface by name, allocating memory or
+ * checking the data type again, which makes it suitable for read() and write() of components with
+ * many interfaces.
+ *
+ * get() and set() lock the interface like get_state() and set_state() of the hardware component.
+ * get_unsynchronized() and set_unsynchronized() don't lock the interface. They can only be used if
+ * no other thread accesses the interface at the same time, e.g., by a synchronous hardware
+ * component whose interfaces are only used by controllers updated in the same thread. Changes and
+ * updates of the value are tracked in both cases.
+ *
+ * The accessor keeps the interface alive, but must not outlive the source of the update time.
+ *
+ * \tparam HandleType StateInterface or CommandInterface.
+ * \tparam T The type of the value, has to match the data type of the interface.
+ */
+template <typename HandleType, typename T>
+class InterfaceAccessor
+{
+public:
+  static_assert(std::is_base_of_v<Handle, HandleType>, "HandleType has to be an interface");
+
+  /// Creates an invalid accessor, which has to be assigned before it is used.
+  InterfaceAccessor() = default;
+
+  /**
+   * \param[in] handle The interface to access.
+   * \param[in] update_time Time the interface is stamped with when its value is set, e.g., the time
+   * of the read cycle of the hardware component. The time isn't changed if nullptr.
+   * \throws std::runtime_error if the interface is null, an array, or T doesn't match its data
+   * type.
+   */
+  explicit InterfaceAccessor(
+    std::shared_ptr<HandleType> handle, const rclcpp::Time * update_time = nullptr)
+  : handle_(std::move(handle)), update_time_(update_time)
+  {
+    THROW_ON_NULLPTR(handle_);
+    const Handle & base = *handle_;
+    if (base.is_array())
+    {
+      base.throw_scalar_access_on_array();
+    }
+    base.template check_data_type<T>();
+    value_ = resolve_value();
+  }
+
+  /// Returns true if the accessor was created for an interface.
+  bool is_valid() const { return handle_ != nullptr; }
+
+  const std::string & get_name() const { return handle_->get_name(); }
+
+  /// Get the value, waits for the lock of the interface.
+  T get() const
+  {
+    std::shared_lock<std::shared_mutex> lock(handle_->get_mutex());
+    return load();
+  }
+
+  /// Set the value, waits for the lock of the interface.
+  void set(const T & value)
+  {
+    std::unique_lock<std::shared_mutex> lock(handle_->get_mutex());
+    store(value);
+  }
+
+  /// Get the value without locking the interface.
+  T get_unsynchronized() const { return load(); }
+
+  /// Set the value without locking the interface.
+  void set_unsynchronized(const T & value) { store(value); }
+
+private:
+  T * resolve_value() const
+  {
+    Handle & base = *handle_;
+    if constexpr (std::is_same_v<T, double>)
+    {
+      // internal and deprecated values, or aligned external values in the native byte order
+      if (base.value_ptr_)
+      {
+        return base.value_ptr_;
+      }
+    }
+    if (base.external_data_)
+    {
+      // other values bound to memory are converted on each access
+      return base.external_in_place_ ? reinterpret_cast<T *>(base.external_data_) : nullptr;
+    }
+    // the alternative of the variant doesn't change, as set_value() checks the data type
+    return std::get_if<T>(&base.value_);
+  }
+
+  T load() const
+  {
+    if (value_)
+    {
+      return *value_;
+    }
+    return static_cast<const Handle &>(*handle_).template load_external<T>();
+  }
+
+  void store(const T & value)
+  {
+    Handle & base = *handle_;
+    if (value_)
+    {
+      if (!Handle::is_same_value(*value_, value))
+      {
+        *value_ = value;
+        base.mark_changed();
+      }
+    }
+    else if (!Handle::is_same_value(base.template load_external<T>(), value))
+    {
+      base.store_external(value);
+      base.mark_changed();
+    }
+    base.mark_updated();
+    if (update_time_)
+    {
+      base.update_time_ = *update_time_;
+    }
+    base.update_published_copy();
+  }
+
+  std::shared_ptr<HandleType> handle_;
+  T * value_ = nullptr;
+  const rclcpp::Time * update_time_ = nullptr;
+};
+
+template <typename T = double>
+using StateInterfaceAccessor = InterfaceAccessor<StateInterface, T>;
+
+template <typename T = double>
+using CommandInterfaceAccessor = InterfaceAccessor<CommandInterface, T>;
+
+/// Typed accessor of the values of an array interface, resolved once.
+/**
+ * Like InterfaceAccessor, the data type of the interface is checked when the accessor is created,
+ * so that the values are accessed without looking up the interface by name or checking the data
+ * type again. get() and set() lock the interface like get_command_array() and set_state_array()
+ * of the hardware component.
+ *
+ * \tparam HandleType StateInterface or CommandInterface.
+ * \tparam T The type of the values, has to match the data type of the interface.
+ */
+template <typename HandleType, typename T>
+class ArrayInterfaceAccessor
+{
+public:
+  static_assert(std::is_base_of_v<Handle, HandleType>, "HandleType has to be an interface");
+
+  /// Creates an invalid accessor, which has to be assigned before it is used.
+  ArrayInterfaceAccessor() = default;
+
+  /**
+   * \param[in] handle The interface to access.
+   * \param[in] update_time Time the interface is stamped with when its values are set. The time
+   * isn't changed if nullptr.
+   * \throws std::runtime_error if the interface is null, not an array, or T doesn't match its data
+   * type.
+   */
+  explicit ArrayInterfaceAccessor(
+    std::shared_ptr<HandleType> handle, const rclcpp::Time * update_time = nullptr)
+  : handle_(std::move(handle)), update_time_(update_time)
+  {
+    THROW_ON_NULLPTR(handle_);
+    static_cast<const Handle &>(*handle_).template check_array_access<T>();
+  }
+
+  /// Returns true if the accessor was created for an interface.
+  bool is_valid() const { return handle_ != nullptr; }
+
+  const std::string & get_name() const { return handle_->get_name(); }
+
+  size_t size() const { return handle_->get_size(); }
+
+  /// Copy the values, waits for the lock of the interface.
+  /**
+   * \param[out] values The destination, has to have the size of the interface.
+   */
+  void get(Span<T> values) const
+  {
+    std::shared_lock<std::shared_mutex> lock(handle_->get_mutex());
+    std::ignore = handle_->get_array_values(lock, values);
+  }
+
+  /// Set the values, waits for the lock of the interface.
+  /**
+   * \param[in] values The new values, have to have the size of the interface.
+   */
+  void set(Span<const T> values)
+  {
+    std::unique_lock<std::shared_mutex> lock(handle_->get_mutex());
+    std::ignore = handle_->set_array_values(lock, values);
+    if (update_time_)
+    {
+      handle_->set_update_time(lock, *update_time_);
+    }
+  }
+
+private:
+  std::shared_ptr<HandleType> handle_;
+  const rclcpp::Time * update_time_ = nullptr;
+};
+
+template <typename T = double>
+using StateInterfaceArrayAccessor = ArrayInterfaceAccessor<StateInterface, T>;
+
+template <typename T = double>
+using CommandInterfaceArrayAccessor = ArrayInterfaceAccessor<CommandInterface, T>;
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__INTERFACE_ACCESSOR_HPP_
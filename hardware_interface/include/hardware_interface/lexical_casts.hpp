@@ -15,6 +15,7 @@
 #ifndef HARDWARE_INTERFACE__LEXICAL_CASTS_HPP_
 #define HARDWARE_INTERFACE__LEXICAL_CASTS_HPP_
 
+#include <limits>
 #include <regex>
 #include <sstream>
 #include <stdexcept>
@@ -47,6 +48,58 @@ std::string to_lower_case(const std::string & string);
  */
 bool parse_bool(const std::string & bool_string);
 
+/**
+ * \brief Parse an integer value from a string.
+ * \param integer_string The input string, has to contain only the decimal number.
+ * \return The parsed value.
+ * \throws std::invalid_argument if the string is not a valid integer or not in the range of T.
+ */
+template <typename T>
+T parse_integer(const std::string & integer_string)
+{
+  static_assert(std::is_integral_v<T>, "parse_integer can only parse integral types");
+  size_t processed_characters = 0;
+  T value = 0;
+  try
+  {
+    if constexpr (std::is_signed_v<T>)
+    {
+      const long long parsed = std::stoll(integer_string, &processed_characters);  // NOLINT
+      if (
+        parsed < static_cast<long long>(std::numeric_limits<T>::min()) ||  // NOLINT
+        parsed > static_cast<long long>(std::numeric_limits<T>::max()))    // NOLINT
+      {
+        throw std::out_of_range(integer_string);
+      }
+      value = static_cast<T>(parsed);
+    }
+    else
+    {
+      // std::stoull accepts negative numbers and wraps them around
+      if (integer_string.find('-') != std::string::npos)
+      {
+        throw std::out_of_range(integer_string);
+      }
+      const unsigned long long parsed =  // NOLINT
+        std::stoull(integer_string, &processed_characters);
+      if (parsed > static_cast<unsigned long long>(std::numeric_limits<T>::max()))  // NOLINT
+      {
+        throw std::out_of_range(integer_string);
+      }
+      value = static_cast<T>(parsed);
+    }
+  }
+  catch (const std::logic_error &)
+  {
+    throw std::invalid_argument("Failed converting string to integer: " + integer_string);
+  }
+  if (processed_characters != integer_string.size())
+  {
+    throw std::invalid_argument("Failed converting string to integer: " + integer_string);
+  }
+  return value;
+}
+
 template <typename T>
 std::vector<T> parse_array(const std::string & array_string)
 {
@@ -149,6 +149,68 @@ public:
     return std::nullopt;
   }
 
+  /**
+   * @brief Set all values of an array command interface at once.
+   * @tparam T The type of the values, has to match the data type of the interface.
+   * @param values The new values, have to have the size of the interface.
+   * @param max_tries The maximum number of tries to set the values.
+   * @return true if the values are set, false otherwise.
+   *
+   * @note The method is thread-safe and non-blocking, see set_value. The command limiter is not
+   * applied to array interfaces.
+   */
+  template <typename T>
+  [[nodiscard]] bool set_array_values(Span<const T> values, unsigned int max_tries = 10)
+  {
+    unsigned int nr_tries = 0;
+    ++set_value_statistics_.total_counter;
+    while (!command_interface_.set_array_values<T>(values))
+    {
+      ++set_value_statistics_.failed_counter;
+      ++nr_tries;
+      if (nr_tries == max_tries)
+      {
+        ++set_value_statistics_.timeout_counter;
+        return false;
+      }
+      std::this_thread::yield();
+    }
+    return true;
+  }
+
+  /**
+   * @brief Copy all values of an array command interface at once.
+   * @tparam T The type of the values, has to match the data type of the interface.
+   * @param values The destination, has to have the size of the interface.
+   * @param max_tries The maximum number of tries to get the values.
+   * @return true if the values are copied, false otherwise.
+   */
+  template <typename T>
+  [[nodiscard]] bool get_array_values(Span<T> values, unsigned int max_tries = 10) const
+  {
+    unsigned int nr_tries = 0;
+    do
+    {
+      ++get_value_statistics_.total_counter;
+      if (command_interface_.get_array_values<T>(values))
+      {
+        return true;
+      }
+      ++get_value_statistics_.failed_counter;
+      ++nr_tries;
+      std::this_thread::yield();
+    } while (nr_tries < max_tries);
+
+    ++get_value_statistics_.timeout_counter;
+    return false;
+  }
+
+  /// Returns the number of values of the command interface, 1 for scalar interfaces.
+  size_t get_size() const { return command_interface_.get_size(); }
+
+  /// Returns true if the command interface holds a contiguous array of values.
+  bool is_array() const { return command_interface_.is_array(); }
+
   /**
    * @brief Get the data type of the command interface.
    * @return The data type of the command interface.
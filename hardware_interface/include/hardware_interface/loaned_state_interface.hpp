@@ -15,14 +15,17 @@
 #ifndef HARDWARE_INTERFACE__LOANED_STATE_INTERFACE_HPP_
 #define HARDWARE_INTERFACE__LOANED_STATE_INTERFACE_HPP_
 
+#include <cstdint>
 #include <functional>
 #include <limits>
+#include <optional>
 #include <string>
 #include <thread>
 #include <utility>
 
 #include "hardware_interface/handle.hpp"
 #include "rclcpp/logging.hpp"
+#include "rclcpp/time.hpp"
 namespace hardware_interface
 {
 class LoanedStateInterface
@@ -104,6 +107,69 @@ public:
     return std::nullopt;
   }
 
+  /**
+   * @brief Copy all values of an array state interface at once.
+   * @tparam T The type of the values, has to match the data type of the interface.
+   * @param values The destination, has to have the size of the interface.
+   * @param max_tries The maximum number of tries to get the values.
+   * @return true if the values are copied, false otherwise.
+   *
+   * @note The method is thread-safe and non-blocking, see get_optional.
+   */
+  template <typename T>
+  [[nodiscard]] bool get_array_values(Span<T> values, unsigned int max_tries = 10) const
+  {
+    unsigned int nr_tries = 0;
+    do
+    {
+      ++get_value_statistics_.total_counter;
+      if (state_interface_.get_array_values<T>(values))
+      {
+        return true;
+      }
+      ++get_value_statistics_.failed_counter;
+      ++nr_tries;
+      std::this_thread::yield();
+    } while (nr_tries < max_tries);
+
+    ++get_value_statistics_.timeout_counter;
+    return false;
+  }
+
+  /// Returns the number of values of the state interface, 1 for scalar interfaces.
+  size_t get_size() const { return state_interface_.get_size(); }
+
+  /// Returns true if the state interface holds a contiguous array of values.
+  bool is_array() const { return state_interface_.is_array(); }
+
+  /// Returns the number of updates of the state by the hardware, increases monotonically.
+  /**
+   * Allows to skip computations if the state was not updated since the previous cycle, e.g. by an
+   * asynchronous or decimated hardware component. Updates with the current value are counted.
+   */
+  uint64_t get_update_sequence() const { return state_interface_.get_update_sequence(); }
+
+  /// Returns the number of changes of the state, updates with the current value are not counted.
+  uint64_t get_change_count() const { return state_interface_.get_change_count(); }
+
+  /// Returns true if the state is stored in memory owned by the hardware component, whose updates
+  /// are not counted by get_update_sequence().
+  bool is_bound_to_memory() const { return state_interface_.is_bound_to_memory(); }
+
+  /// Returns true if the state was predicted by the resource manager in a cycle without a new
+  /// sample of the hardware, see the `extrapolation` parameter of the state interfaces.
+  bool is_predicted() const { return state_interface_.is_predicted(); }
+
+  /**
+   * @brief Get the time of the read cycle in which the hardware updated the state last.
+   * @return The time, with the clock type RCL_CLOCK_UNINITIALIZED if the state was not updated
+   * through the hardware component, std::nullopt if the state interface couldn't be locked.
+   */
+  [[nodiscard]] std::optional<rclcpp::Time> get_update_time() const
+  {
+    return state_interface_.get_update_time();
+  }
+
   /**
    * @brief Get the data type of the state interface.
    * @return The data type of the state interface.
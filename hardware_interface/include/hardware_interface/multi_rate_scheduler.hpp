@@ -0,0 +1,89 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__MULTI_RATE_SCHEDULER_HPP_
+#define HARDWARE_INTERFACE__MULTI_RATE_SCHEDULER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hardware_interface
+{
+/// Decimation of a task, e.g., a controller or a hardware component, in ticks of the control loop
+struct TickSchedule
+{
+  /// The task is executed every `divisor` ticks, 0 if the task is not scheduled yet
+  unsigned int divisor = 0;
+  /// The task is executed in the ticks with `tick % divisor == phase`
+  unsigned int phase = 0;
+
+  bool is_scheduled() const { return divisor > 0; }
+
+  bool is_due(uint64_t tick) const { return tick % divisor == phase; }
+};
+
+/// Schedule of tasks running at fractions of the update rate of the control loop
+struct MultiRateSchedule
+{
+  /// Schedules of the tasks, in the order of the requested rates
+  std::vector<TickSchedule> tasks;
+  /// Sum of the weights of the tasks due in each tick of the hyperperiod
+  std::vector<double> load_profile;
+
+  /// Highest load of a tick of the hyperperiod, 0 if there are no tasks
+  double get_peak_load() const;
+
+  /// Average load of the ticks of the hyperperiod, 0 if there are no tasks
+  double get_average_load() const;
+};
+
+/// Hyperperiods longer than this number of ticks are truncated by \ref compute_multi_rate_schedule
+constexpr size_t kMaxHyperperiod = 1u << 16;
+
+/// Converts a rate to the closest integer divisor of the update rate.
+/**
+ * Ties are rounded to the higher rate, e.g., 40 Hz at 100 Hz is executed every 2 ticks.
+ *
+ * \param[in] update_rate update rate of the control loop in Hz.
+ * \param[in] rate rate of the task in Hz, 0 or rates above the update rate run in every tick.
+ * \returns the number of ticks between two executions of the task, at least 1.
+ */
+unsigned int to_tick_divisor(unsigned int update_rate, unsigned int rate);
+
+/// Computes integer tick schedules of tasks with phase offsets that flatten the load per tick.
+/**
+ * The rates are converted into tick divisors with \ref to_tick_divisor, so that whether a task is
+ * due doesn't depend on the measured time. Instead of executing all decimated tasks in the same
+ * tick, their phases are chosen greedily over the hyperperiod (the least common multiple of the
+ * divisors): the tasks are placed from the most to the least frequent one, each in the phase
+ * whose highest load is the lowest. Hyperperiods longer than \ref kMaxHyperperiod are truncated,
+ * the phases are then balanced over the truncated profile only.
+ *
+ * Not real-time safe, the schedule is meant to be computed when the set of tasks changes.
+ *
+ * \param[in] update_rate update rate of the control loop in Hz.
+ * \param[in] rates rates of the tasks in Hz.
+ * \param[in] weights cost of the tasks per execution, e.g., their execution time. 1 per task if
+ * empty.
+ * \returns the schedules of the tasks and the resulting load profile.
+ * \throws std::invalid_argument if the update rate is 0 or the number of weights doesn't match.
+ */
+MultiRateSchedule compute_multi_rate_schedule(
+  unsigned int update_rate, const std::vector<unsigned int> & rates,
+  const std::vector<double> & weights = {});
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__MULTI_RATE_SCHEDULER_HPP_
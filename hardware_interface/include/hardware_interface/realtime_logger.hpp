@@ -0,0 +1,255 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__REALTIME_LOGGER_HPP_
+#define HARDWARE_INTERFACE__REALTIME_LOGGER_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+#include "rclcpp/logger.hpp"
+#include "rcutils/logging.h"
+
+namespace hardware_interface
+{
+/// Logger for the real-time loop
+/**
+ * The messages are not formatted in the calling thread. Instead, the format string and the
+ * arguments are copied into a record of a preallocated lock-free ring buffer. A background thread
+ * drains the buffer, formats the messages and passes them to the rclcpp logger. Therefore, logging
+ * never allocates memory, formats strings or waits for the output in the real-time loop.
+ *
+ * The format strings use the fmt syntax ("{}", "{:.3f}") and have to outlive the logger (string
+ * literals), as only their address is stored. Numeric and string arguments are supported, strings
+ * are copied into the record and truncated if they don't fit. If the buffer is full, the message is
+ * dropped and counted, the number of dropped messages is reported by the background thread.
+ */
+class RealtimeLogger
+{
+public:
+  static constexpr size_t kMaxArguments = 12;
+  static constexpr size_t kStringArgumentsCapacity = 512;
+
+  /**
+   * \param[in] logger logger the drained messages are written to.
+   * \param[in] capacity number of records of the ring buffer, rounded up to a power of two.
+   * \param[in] drain_period period of the background thread draining the buffer.
+   */
+  explicit RealtimeLogger(
+    const rclcpp::Logger & logger, size_t capacity = 256,
+    std::chrono::milliseconds drain_period = std::chrono::milliseconds(10));
+
+  RealtimeLogger(const RealtimeLogger &) = delete;
+  RealtimeLogger & operator=(const RealtimeLogger &) = delete;
+
+  /// Stops the background thread after writing all pending messages.
+  ~RealtimeLogger();
+
+  /// Queues a message to be logged with the given severity.
+  /**
+   * The method is real-time safe and can be called from multiple threads concurrently.
+   *
+   * \param[in] severity rcutils severity of the message, e.g. RCUTILS_LOG_SEVERITY_ERROR.
+   * \param[in] format fmt format string, has to outlive the logger.
+   * \param[in] args numeric or string arguments of the message.
+   * \return true if the message is queued or filtered out by the logger level, false if it is
+   * dropped because the buffer is full.
+   */
+  template <typename... Args>
+  bool log(int severity, const char * format, const Args &... args)
+  {
+    static_assert(sizeof...(Args) <= kMaxArguments, "Too many arguments for a real-time message");
+    if (!rcutils_logging_logger_is_enabled_for(logger_.get_name(), severity))
+    {
+      return true;
+    }
+    Record * record = acquire_record();
+    if (!record)
+    {
+      dropped_messages_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    record->severity = severity;
+    record->format = format;
+    record->number_of_arguments = 0;
+    record->strings_size = 0;
+    (add_argument(*record, args), ...);
+    commit_record(*record);
+    return true;
+  }
+
+  template <typename... Args>
+  bool debug(const char * format, const Args &... args)
+  {
+    return log(RCUTILS_LOG_SEVERITY_DEBUG, format, args...);
+  }
+
+  template <typename... Args>
+  bool info(const char * format, const Args &... args)
+  {
+    return log(RCUTILS_LOG_SEVERITY_INFO, format, args...);
+  }
+
+  template <typename... Args>
+  bool warn(const char * format, const Args &... args)
+  {
+    return log(RCUTILS_LOG_SEVERITY_WARN, format, args...);
+  }
+
+  template <typename... Args>
+  bool error(const char * format, const Args &... args)
+  {
+    return log(RCUTILS_LOG_SEVERITY_ERROR, format, args...);
+  }
+
+  template <typename... Args>
+  bool fatal(const char * format, const Args &... args)
+  {
+    return log(RCUTILS_LOG_SEVERITY_FATAL, format, args...);
+  }
+
+  /// Checks if a throttled message is due and updates the time of the last message if so.
+  /**
+   * \param[in,out] last_time time of the last throttled message, owned by the caller.
+   * \param[in] period minimal period between two messages.
+   * \return true if the message should be logged.
+   */
+  static bool throttle(
+    std::chrono::steady_clock::time_point & last_time, std::chrono::milliseconds period);
+
+  /// Formats and writes all queued messages in the calling thread.
+  /**
+   * Called periodically by the background thread. Not real-time safe.
+   * \return number of written messages.
+   */
+  size_t drain();
+
+  /// Number of messages dropped since the construction because the buffer was full.
+  size_t get_dropped_messages() const { return dropped_messages_.load(); }
+
+private:
+  struct Argument
+  {
+    enum class Type : uint8_t
+    {
+      INTEGER,
+      UNSIGNED_INTEGER,
+      FLOATING_POINT,
+      STRING
+    };
+
+    Type type = Type::INTEGER;
+    union
+    {
+      int64_t integer;
+      uint64_t unsigned_integer;
+      double floating_point;
+      struct
+      {
+        uint16_t offset;
+        uint16_t length;
+      } string;
+    };
+  };
+
+  struct Record
+  {
+    std::atomic<size_t> sequence{0};
+    int severity = RCUTILS_LOG_SEVERITY_INFO;
+    const char * format = nullptr;
+    size_t number_of_arguments = 0;
+    std::array<Argument, kMaxArguments> arguments;
+    size_t strings_size = 0;
+    std::array<char, kStringArgumentsCapacity> strings;
+  };
+
+  Record * acquire_record();
+  void commit_record(Record & record);
+
+  static void add_string_argument(Record & record, const char * str, size_t length);
+
+  template <typename T>
+  static void add_argument(Record & record, const T & value)
+  {
+    if constexpr (std::is_same_v<T, std::string>)
+    {
+      add_string_argument(record, value.c_str(), value.size());
+    }
+    else if constexpr (std::is_convertible_v<T, const char *>)
+    {
+      const char * str = value;
+      add_string_argument(record, str, str ? std::strlen(str) : 0u);
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+    {
+      add_string_argument(record, value ? "true" : "false", value ? 4u : 5u);
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+      auto & argument = record.arguments[record.number_of_arguments++];
+      argument.type = Argument::Type::FLOATING_POINT;
+      argument.floating_point = static_cast<double>(value);
+    }
+    else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+    {
+      auto & argument = record.arguments[record.number_of_arguments++];
+      argument.type = Argument::Type::INTEGER;
+      argument.integer = static_cast<int64_t>(value);
+    }
+    else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+    {
+      auto & argument = record.arguments[record.number_of_arguments++];
+      argument.type = Argument::Type::UNSIGNED_INTEGER;
+      argument.unsigned_integer = static_cast<uint64_t>(value);
+    }
+    else
+    {
+      static_assert(
+        std::is_arithmetic_v<T>, "Only numeric and string arguments are supported by the logger");
+    }
+  }
+
+  void format_and_write(const Record & record) const;
+  void drain_loop();
+
+  rclcpp::Logger logger_;
+  std::unique_ptr<Record[]> records_;
+  size_t mask_;
+  std::atomic<size_t> write_position_{0};
+  // only used by the thread draining the buffer
+  std::mutex drain_mutex_;
+  size_t read_position_ = 0;
+  std::atomic<size_t> dropped_messages_{0};
+  size_t reported_dropped_messages_ = 0;
+
+  std::chrono::milliseconds drain_period_;
+  std::mutex drain_thread_mutex_;
+  std::condition_variable drain_thread_cv_;
+  bool stop_drain_thread_ = false;
+  std::thread drain_thread_;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__REALTIME_LOGGER_HPP_
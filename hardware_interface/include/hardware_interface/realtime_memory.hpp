@@ -0,0 +1,113 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__REALTIME_MEMORY_HPP_
+#define HARDWARE_INTERFACE__REALTIME_MEMORY_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace hardware_interface
+{
+/// Usage of a RealtimeMemoryArena.
+struct RealtimeMemoryArenaStatistics
+{
+  /// Size of the arena in bytes
+  size_t capacity = 0;
+  /// Bytes of the blocks currently allocated, rounded up to their size class
+  size_t used_bytes = 0;
+  /// Maximum of the used bytes since the creation of the arena
+  size_t high_water_mark = 0;
+  /// Allocations rejected as the arena was exhausted or the alignment not supported
+  uint64_t failed_allocations = 0;
+};
+
+/// Bounded memory resource for allocations in the real-time loop.
+/**
+ * The memory of the arena is allocated and written once by the constructor, so that its pages are
+ * resident before the real-time loop starts, and it is never returned to the system. Allocations
+ * are rounded up to power-of-two size classes. Freed blocks are kept in a lock-free list per size
+ * class and reused by the next allocation of the class, the other allocations are carved from the
+ * unused part of the arena. Thus, allocating and freeing never locks, and is safe from any number
+ * of threads.
+ *
+ * When the arena is exhausted, the allocation fails with std::bad_alloc instead of falling back to
+ * the heap. Memory carved for a size class is only reused by the same class, so an arena should be
+ * sized for the high-water mark of its workload plus the fragmentation of growing containers.
+ */
+class RealtimeMemoryArena : public std::pmr::memory_resource
+{
+public:
+  /// Size of the smallest size class in bytes
+  static constexpr size_t kMinBlockSize = 16;
+  /// Maximum alignment of the allocations
+  static constexpr size_t kMaxAlignment = 64;
+
+  /**
+   * \param[in] capacity size of the arena in bytes.
+   * \throws std::invalid_argument if the capacity is 0 or not below 4 GiB.
+   */
+  explicit RealtimeMemoryArena(size_t capacity);
+
+  ~RealtimeMemoryArena() override;
+
+  RealtimeMemoryArena(const RealtimeMemoryArena &) = delete;
+  RealtimeMemoryArena & operator=(const RealtimeMemoryArena &) = delete;
+
+  size_t get_capacity() const { return capacity_; }
+
+  /// Current usage of the arena, can be called from any thread.
+  RealtimeMemoryArenaStatistics get_statistics() const;
+
+protected:
+  void * do_allocate(size_t bytes, size_t alignment) override;
+
+  void do_deallocate(void * p, size_t bytes, size_t alignment) override;
+
+  bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override;
+
+private:
+  static constexpr size_t kNumSizeClasses = 28;
+
+  /// Carve a block of the size class from the unused part of the arena.
+  void * carve_block(size_t size_class);
+
+  std::byte * buffer_;
+  const size_t capacity_;
+  std::atomic<size_t> next_offset_{0};
+  /// Head of the free list of each size class: ABA tag in the upper and offset + 1 in the lower
+  /// 32 bits, 0 if the list is empty
+  std::array<std::atomic<uint64_t>, kNumSizeClasses> free_lists_{};
+  std::atomic<size_t> used_bytes_{0};
+  std::atomic<size_t> high_water_mark_{0};
+  std::atomic<uint64_t> failed_allocations_{0};
+};
+
+/// Touch the pages of the stack of the calling thread below the current stack frame.
+/**
+ * Page faults of the stack in the real-time loop are avoided by calling it at the start of the
+ * thread, with the memory locked by mlockall(MCL_CURRENT | MCL_FUTURE). The size is limited to the
+ * part of the stack still available to the thread, minus a safety margin.
+ *
+ * \param[in] size bytes of the stack to touch.
+ * \returns the number of bytes touched.
+ */
+size_t prefault_current_thread_stack(size_t size);
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__REALTIME_MEMORY_HPP_
@@ -15,8 +15,13 @@
 #ifndef HARDWARE_INTERFACE__RESOURCE_MANAGER_HPP_
 #define HARDWARE_INTERFACE__RESOURCE_MANAGER_HPP_
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -27,6 +32,7 @@
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #include "hardware_interface/loaned_command_interface.hpp"
 #include "hardware_interface/loaned_state_interface.hpp"
+#include "hardware_interface/realtime_logger.hpp"
 #pragma GCC diagnostic pop
 #include "hardware_interface/sensor.hpp"
 #include "hardware_interface/system.hpp"
@@ -184,6 +190,17 @@ public:
    */
   bool state_interface_is_available(const std::string & name) const;
 
+  /// Publishes a copy of the values of a state interface that is read without locking it.
+  /**
+   * Used for the state interfaces claimed by controllers of another rate domain than the one
+   * writing them, see Handle::enable_published_copy().
+   * \param[in] name string identifying the interface.
+   * \return true if the copy is published, false if the values of the interface can be written
+   * without it, e.g., if they are bound to memory of the hardware component.
+   * \throws std::runtime_error if the state interface does not exist.
+   */
+  bool enable_state_interface_published_copy(const std::string & name);
+
   /// Gets the data type of the state interface.
   /**
    * \param[in] name string identifying the interface to check.
@@ -444,6 +461,17 @@ public:
    */
   const std::unordered_map<std::string, HardwareComponentInfo> & get_components_status();
 
+  /// Pin the async thread of a hardware component to CPUs.
+  /**
+   * The CPUs are applied by the async thread with its next cycle.
+   *
+   * \param[in] component_name name of the hardware component.
+   * \param[in] cpus CPUs the async thread is pinned to.
+   * \return false if the component doesn't exist or is not async.
+   */
+  bool set_async_component_cpu_affinity(
+    const std::string & component_name, const std::vector<int> & cpus);
+
   /// Return the unordered map of hard joint limits.
   /**
    * \return unordered map of hard joint limits.
@@ -478,6 +506,19 @@ public:
     const std::vector<std::string> & start_interfaces,
     const std::vector<std::string> & stop_interfaces);
 
+  /// Prepare the hardware components for a new command interface mode and identify the switch.
+  /**
+   * Same as the overload above, but additionally returns the id of the prepared switch.
+   * \param[in] start_interfaces vector of string identifiers for the command interfaces starting.
+   * \param[in] stop_interfaces vector of string identifiers for the command interfaces stopping.
+   * \param[out] switch_id id of the prepared switch to pass to perform_command_mode_switch, 0 if
+   * nothing was prepared.
+   * \return true if switch can be prepared, see the overload above.
+   */
+  bool prepare_command_mode_switch(
+    const std::vector<std::string> & start_interfaces,
+    const std::vector<std::string> & stop_interfaces, uint64_t & switch_id);
+
   /// Notify the hardware components that realtime hardware mode switching should occur.
   /**
    * Hardware components are asked to perform the command interface mode switching.
@@ -495,6 +536,20 @@ public:
     const std::vector<std::string> & start_interfaces,
     const std::vector<std::string> & stop_interfaces);
 
+  /// Notify the hardware components that the prepared mode switch should occur.
+  /**
+   * Same as the overload above, but if \p switch_id identifies the last successful
+   * `prepare_command_mode_switch` call, only the components resolved there are notified and the
+   * interfaces of the remaining components are not filtered again.
+   * \param[in] start_interfaces vector of string identifiers for the command interfaces starting.
+   * \param[in] stop_interfaces vector of string identifiers for the command interfaces stopping.
+   * \param[in] switch_id id returned by `prepare_command_mode_switch` for the same interfaces.
+   * \return true if switch is performed, false if a component rejects switching.
+   */
+  bool perform_command_mode_switch(
+    const std::vector<std::string> & start_interfaces,
+    const std::vector<std::string> & stop_interfaces, uint64_t switch_id);
+
   /// Sets state of hardware component.
   /**
    * Set set of hardware component if possible.
@@ -519,24 +574,85 @@ public:
    */
   bool enforce_command_limits(const rclcpp::Duration & period);
 
+  /// Enforce the command limits of the joints of the hardware components of a rate domain.
+  /**
+   * \note This method is RT-safe. Rate domains can enforce their limits concurrently.
+   * \param[in] period period of the cycles of the rate domain.
+   * \param[in] rate_domain index of the rate domain, 0 for the main loop.
+   * \return true if the command interfaces are out of limits and the limits are enforced.
+   */
+  bool enforce_command_limits(const rclcpp::Duration & period, unsigned int rate_domain);
+
   /// Reads all loaded hardware components.
   /**
    * Reads from all active hardware components.
    *
    * Part of the real-time critical update loop.
    * It is realtime-safe if used hardware interfaces are implemented adequately.
+   *
+   * \note The components are taken from a snapshot that is replaced only once newly loaded
+   * components are fully initialized, so loading components doesn't skip any cycle.
    */
   HardwareReadWriteStatus read(const rclcpp::Time & time, const rclcpp::Duration & period);
 
+  /// Reads the hardware components of a rate domain.
+  /**
+   * Same as read(), limited to the components assigned to the rate domain by
+   * ResourceManagerParams::hardware_components_rate_domains. The rate domain 0 is the main loop.
+   * The rate domains can be read and written concurrently, each from its own thread.
+   *
+   * \param[in] rate_domain index of the rate domain.
+   */
+  HardwareReadWriteStatus read(
+    const rclcpp::Time & time, const rclcpp::Duration & period, unsigned int rate_domain);
+
+  /// Names of the hardware components with stale state interfaces in the last read cycle.
+  /**
+   * A component is stale if none of its state interfaces was updated for at least
+   * ResourceManagerParams::stale_state_read_cycles consecutive read cycles. Always empty if the
+   * parameter is zero.
+   *
+   * Part of the real-time critical update loop, only to be called from the thread calling read.
+   *
+   * \param[in] rate_domain index of the rate domain of the read cycle.
+   */
+  const std::vector<std::string> & get_stale_hardware_names(unsigned int rate_domain = 0) const;
+
+  /// Number of hardware components due in each cycle of the hyperperiod of their `rw_rate`.
+  /**
+   * Only computed if ResourceManagerParams::tick_scheduling is set, empty otherwise. The profile
+   * covers all loaded components and is updated whenever components are loaded or removed.
+   */
+  std::vector<double> get_hardware_load_profile() const;
+
   /// Write all loaded hardware components.
   /**
    * Writes to all active hardware components.
    *
    * Part of the real-time critical update loop.
    * It is realtime-safe if used hardware interfaces are implemented adequately.
+   *
+   * \note When a component returns DEACTIVATE, its deactivation is not executed in the calling
+   * thread. The transition is handed to the lifecycle worker of the resource manager and the
+   * component is skipped by read and write until the transition is completed.
    */
   HardwareReadWriteStatus write(const rclcpp::Time & time, const rclcpp::Duration & period);
 
+  /// Writes the hardware components of a rate domain.
+  /**
+   * Same as write(), limited to the components of the rate domain, see read().
+   *
+   * \param[in] rate_domain index of the rate domain.
+   */
+  HardwareReadWriteStatus write(
+    const rclcpp::Time & time, const rclcpp::Duration & period, unsigned int rate_domain);
+
+  /// Checks whether a lifecycle transition requested from the real-time loop is still pending.
+  /**
+   * \return true if at least one component waits for the lifecycle worker, false otherwise.
+   */
+  bool has_pending_component_transitions() const;
+
   /// Checks whether a command interface is registered under the given key.
   /**
    * \param[in] key string identifying the interface to check.
@@ -583,8 +699,54 @@ protected:
 private:
   bool validate_storage(const std::vector<hardware_interface::HardwareInfo> & hardware_info) const;
 
+  /// Executes the lifecycle transitions requested from the real-time loop.
+  /**
+   * Called from the lifecycle worker and before any non real-time access to the components state,
+   * so that the deferred transitions are always executed before the ones requested afterwards.
+   */
+  void process_deferred_component_transitions();
+
+  void lifecycle_worker_loop();
+
+  /// Removes the interfaces of a failed component from the available lists.
+  /**
+   * Called from the real-time loop. If the lists are currently used by the non real-time code, the
+   * removal is handed to the lifecycle worker by setting \p removal_request.
+   */
+  void remove_failed_component_interfaces(
+    const std::string & component_name, std::atomic_bool & removal_request);
+
+  /// Whether the interface belongs to a component waiting for its deferred deactivation.
+  /**
+   * The interfaces of a component that returned DEACTIVATE from write are reported as unavailable
+   * until the lifecycle worker has deactivated it, as the component is neither read nor written.
+   */
+  bool awaits_deactivation(const std::string & interface_name, bool is_command_interface) const;
+
+  /// Sets \p request and wakes up the lifecycle worker to execute it.
+  /**
+   * Called from the real-time loop for the transitions it must not execute itself.
+   */
+  void request_deferred_component_transition(std::atomic_bool & request);
+
   void release_command_interface(const std::string & key);
 
+  /// Locks the joint limiters of the rate domains, to be held with joint_limiters_lock_.
+  std::vector<std::unique_lock<std::recursive_mutex>> lock_rate_domain_joint_limiters();
+
+  struct RateDomainCycles
+  {
+    // Structure to store read and write status so it is not initialized in the real-time loop
+    HardwareReadWriteStatus read_write_status;
+    std::vector<std::string> stale_hardware_names;
+    // Cycles counted by read and write for the tick scheduling of the components
+    uint64_t read_tick = 0;
+    uint64_t write_tick = 0;
+  };
+
+  /// State of the read and write cycles of the rate domain, nullptr if it doesn't exist
+  RateDomainCycles * get_rate_domain_cycles(unsigned int rate_domain);
+
   // Note this was added in #2323 and is a temporary addition to be backwards compatible with the
   // original constructors. This is planned to be removed in a future PR along with the
   // aforementioned constructors.
@@ -596,8 +758,26 @@ private:
 
   std::unique_ptr<ResourceStorage> resource_storage_;
 
-  // Structure to store read and write status so it is not initialized in the real-time loop
-  HardwareReadWriteStatus read_write_status;
+  RateDomainCycles main_loop_cycles_;
+  // The rate domains with a dedicated thread, only accessed by their threads once started
+  std::vector<RateDomainCycles> rate_domain_cycles_;
+  // Protect the joint limiters of the rate domains besides joint_limiters_lock_, so that the
+  // rate domains don't skip the enforcement of their limits because of each other
+  std::vector<std::unique_ptr<std::recursive_mutex>> rate_domain_joint_limiters_locks_;
+
+  // Logger for the messages of the read and write cycles
+  std::unique_ptr<RealtimeLogger> rt_logger_;
+
+  // Lifecycle worker executing the transitions requested from the real-time loop
+  std::thread lifecycle_worker_thread_;
+  std::mutex lifecycle_worker_mutex_;
+  std::condition_variable lifecycle_worker_cv_;
+  std::atomic_bool lifecycle_worker_stop_ = false;
+  // Incremented under lifecycle_worker_mutex_ by every request of the real-time loop
+  uint64_t lifecycle_worker_generation_ = 0;
+  std::atomic_bool deferred_transitions_requested_ = false;
+  std::recursive_mutex deferred_transitions_lock_;
+  bool processing_deferred_transitions_ = false;
 };
 
 }  // namespace hardware_interface
@@ -0,0 +1,142 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__STATE_EXTRAPOLATOR_HPP_
+#define HARDWARE_INTERFACE__STATE_EXTRAPOLATOR_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace hardware_interface
+{
+/// Extrapolation of a state in the cycles without a new sample of the hardware component
+enum class StateExtrapolation : uint8_t
+{
+  NONE,
+  HOLD,
+  LINEAR,
+  FILTER
+};
+
+/// Name of the parameter of a state interface selecting its extrapolation
+constexpr auto kStateExtrapolationParameter = "extrapolation";
+/// Name of the parameter of a state interface with the position gain of the `filter` extrapolation
+constexpr auto kStateExtrapolationAlphaParameter = "extrapolation_alpha";
+/// Name of the parameter of a state interface with the velocity gain of the `filter` extrapolation
+constexpr auto kStateExtrapolationBetaParameter = "extrapolation_beta";
+/// Name of the parameter of a state interface limiting the extrapolation in seconds
+constexpr auto kStateExtrapolationHorizonParameter = "extrapolation_horizon";
+
+/// Converts the value of the `extrapolation` parameter of a state interface.
+/**
+ * \param[in] extrapolation "none", "hold", "linear" or "filter", case insensitive.
+ * \returns the extrapolation.
+ * \throws std::invalid_argument if the value is unknown.
+ */
+StateExtrapolation parse_state_extrapolation(const std::string & extrapolation);
+
+/// Predicts the value of a state interface between the samples read from the hardware.
+/**
+ * The samples are added with the time of the read cycle they were read in. In the cycles without a
+ * new sample, e.g., of decimated hardware components or asynchronous components whose read is
+ * still in progress, the state is predicted from the samples:
+ *
+ * - HOLD: the latest sample.
+ * - LINEAR: the latest sample extrapolated with its derivative, e.g., the velocity of a position,
+ *   or with the slope between the last two samples if the derivative is unknown.
+ * - FILTER: the latest sample extrapolated with the rate of change estimated by an alpha-beta
+ *   filter over the samples, which is less sensitive to noise than the slope between two samples.
+ *
+ * Real-time safe, only the latest samples are kept.
+ */
+class StateExtrapolator
+{
+public:
+  static constexpr double kDefaultAlpha = 0.5;
+  static constexpr double kDefaultBeta = 0.1;
+
+  explicit StateExtrapolator(StateExtrapolation extrapolation = StateExtrapolation::HOLD)
+  : extrapolation_(extrapolation)
+  {
+  }
+
+  /// Set the gains of the `filter` extrapolation.
+  /**
+   * \param[in] alpha gain of the correction of the value, in (0, 1].
+   * \param[in] beta gain of the correction of the rate of change, in [0, 2].
+   * \throws std::invalid_argument if a gain is out of its range.
+   */
+  void set_filter_gains(double alpha, double beta);
+
+  /// Limit the time the latest sample is extrapolated, the prediction is held afterwards.
+  /**
+   * \param[in] horizon the limit in nanoseconds, 0 to extrapolate without limit.
+   * \throws std::invalid_argument if the horizon is negative.
+   */
+  void set_horizon(int64_t horizon);
+
+  /// Adds a sample read from the hardware.
+  /**
+   * A sample with the time of the latest one replaces it. A non-finite sample is held until the
+   * next finite one, with which the extrapolation restarts.
+   *
+   * \param[in] time time of the read cycle in nanoseconds.
+   * \param[in] value the sample.
+   * \param[in] derivative the derivative of the value at the time of the sample per second, NaN if
+   * unknown. Only used by the LINEAR extrapolation.
+   */
+  void add_sample(
+    int64_t time, double value, double derivative = std::numeric_limits<double>::quiet_NaN());
+
+  /// Get the predicted state at the given time.
+  /**
+   * \param[in] time time in nanoseconds, e.g., of the read cycle of the resource manager.
+   * \returns the predicted state, the latest sample if the prediction needs more samples, NaN
+   * without samples.
+   */
+  double extrapolate(int64_t time) const;
+
+  /// Removes all samples, e.g., when the hardware component is activated.
+  void reset() { number_of_samples_ = 0; }
+
+  size_t get_number_of_samples() const { return number_of_samples_; }
+
+  StateExtrapolation get_extrapolation() const { return extrapolation_; }
+
+private:
+  struct Sample
+  {
+    int64_t time = 0;
+    double value = 0.0;
+    double derivative = 0.0;
+  };
+
+  StateExtrapolation extrapolation_;
+  double alpha_ = kDefaultAlpha;
+  double beta_ = kDefaultBeta;
+  int64_t horizon_ = 0;
+  /// The latest samples, the oldest first
+  std::array<Sample, 2> samples_{};
+  size_t number_of_samples_ = 0;
+  /// Filtered value and rate of change per second at the time of the latest sample
+  double filtered_value_ = 0.0;
+  double filtered_rate_ = 0.0;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__STATE_EXTRAPOLATOR_HPP_
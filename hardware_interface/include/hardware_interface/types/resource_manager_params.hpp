@@ -17,6 +17,8 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include "rclcpp/rclcpp.hpp"
 
 namespace hardware_interface
@@ -96,6 +98,34 @@ struct ResourceManagerParams
    * or for other timing considerations.
    */
   unsigned int update_rate = 100;
+
+  /**
+   * @brief Number of consecutive read cycles without any update of the state interfaces of a
+   * hardware component, after which it is reported as stale by
+   * ResourceManager::get_stale_hardware_names(). Zero disables the detection.
+   */
+  unsigned int stale_state_read_cycles = 0;
+
+  /**
+   * @brief If true, hardware components with a lower `rw_rate` are read and written every
+   * `update_rate / rw_rate` cycles (rounded to an integer), with phase offsets spreading them over
+   * the cycles, see hardware_interface::compute_multi_rate_schedule. If false, they are read and
+   * written based on the time elapsed since their last read and write.
+   */
+  bool tick_scheduling = false;
+
+  /**
+   * @brief The update rates (in Hz) of the rate domains of the ControllerManager, each executed by
+   * a dedicated real-time thread. The first entry is the rate domain 1, the rate domain 0 is the
+   * main loop with `update_rate`.
+   */
+  std::vector<unsigned int> rate_domain_update_rates = {};
+
+  /**
+   * @brief The rate domain of the hardware components read and written by a dedicated thread, see
+   * ResourceManager::read. The hardware components not listed are part of the rate domain 0.
+   */
+  std::unordered_map<std::string, unsigned int> hardware_components_rate_domains = {};
 };
 
 }  // namespace hardware_interface
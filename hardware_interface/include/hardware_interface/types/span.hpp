@@ -0,0 +1,92 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef HARDWARE_INTERFACE__TYPES__SPAN_HPP_
+#define HARDWARE_INTERFACE__TYPES__SPAN_HPP_
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace hardware_interface
+{
+/// Non-owning view of a contiguous sequence of values, a minimal replacement of C++20 std::span.
+template <typename T>
+class Span
+{
+public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using iterator = T *;
+
+  constexpr Span() noexcept = default;
+
+  constexpr Span(T * data, size_t size) noexcept : data_(data), size_(size) {}
+
+  template <
+    typename U, typename Allocator,
+    typename = std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>>
+  Span(std::vector<U, Allocator> & values) noexcept  // NOLINT(runtime/explicit)
+  : data_(values.data()), size_(values.size())
+  {
+  }
+
+  template <
+    typename U, typename Allocator,
+    typename = std::enable_if_t<std::is_const_v<T> && std::is_convertible_v<U (*)[], T (*)[]>>>
+  Span(const std::vector<U, Allocator> & values) noexcept  // NOLINT(runtime/explicit)
+  : data_(values.data()), size_(values.size())
+  {
+  }
+
+  template <
+    typename U, size_t N, typename = std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>>
+  constexpr Span(std::array<U, N> & values) noexcept  // NOLINT(runtime/explicit)
+  : data_(values.data()), size_(N)
+  {
+  }
+
+  template <
+    typename U, size_t N,
+    typename = std::enable_if_t<std::is_const_v<T> && std::is_convertible_v<U (*)[], T (*)[]>>>
+  constexpr Span(const std::array<U, N> & values) noexcept  // NOLINT(runtime/explicit)
+  : data_(values.data()), size_(N)
+  {
+  }
+
+  /// Allows to pass a mutable span where a span of const values is expected.
+  template <typename U, typename = std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>>
+  constexpr Span(const Span<U> & other) noexcept  // NOLINT(runtime/explicit)
+  : data_(other.data()), size_(other.size())
+  {
+  }
+
+  constexpr T * data() const noexcept { return data_; }
+  constexpr size_t size() const noexcept { return size_; }
+  constexpr bool empty() const noexcept { return size_ == 0; }
+
+  constexpr T & operator[](size_t index) const { return data_[index]; }
+
+  constexpr iterator begin() const noexcept { return data_; }
+  constexpr iterator end() const noexcept { return data_ + size_; }
+
+private:
+  T * data_ = nullptr;
+  size_t size_ = 0;
+};
+
+}  // namespace hardware_interface
+
+#endif  // HARDWARE_INTERFACE__TYPES__SPAN_HPP_
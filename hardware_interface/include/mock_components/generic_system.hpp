@@ -17,7 +17,11 @@
 #ifndef MOCK_COMPONENTS__GENERIC_SYSTEM_HPP_
 #define MOCK_COMPONENTS__GENERIC_SYSTEM_HPP_
 
+#include <array>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <variant>
 #include <vector>
 
 #pragma GCC diagnostic push
@@ -25,6 +29,7 @@
 #include "hardware_interface/handle.hpp"
 #pragma GCC diagnostic pop
 #include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/interface_accessor.hpp"
 #include "hardware_interface/system_interface.hpp"
 #include "hardware_interface/types/hardware_interface_return_values.hpp"
 #include "hardware_interface/types/hardware_interface_type_values.hpp"
@@ -83,10 +88,68 @@ protected:
   std::vector<std::string> skip_interfaces_;
 
 private:
+  /// Command interface whose value is mirrored to the state interface with the same name
+  template <typename T>
+  struct ScalarLoopback
+  {
+    hardware_interface::CommandInterfaceAccessor<T> command;
+    hardware_interface::StateInterfaceAccessor<T> state;
+  };
+
+  using Loopback = std::variant<
+    ScalarLoopback<double>, ScalarLoopback<bool>, ScalarLoopback<float>, ScalarLoopback<int32_t>,
+    ScalarLoopback<int64_t>, ScalarLoopback<uint8_t>, ScalarLoopback<uint16_t>>;
+
+  /// Array command interface mirrored to its state through a buffer allocated once
+  template <typename T>
+  struct ArrayLoopback
+  {
+    using value_type = T;
+    hardware_interface::CommandInterfaceArrayAccessor<T> command;
+    hardware_interface::StateInterfaceArrayAccessor<T> state;
+    // not using std::vector as std::vector<bool> doesn't store the values contiguously
+    std::unique_ptr<T[]> values;
+  };
+
+  using ArrayLoopbackVariant = std::variant<
+    ArrayLoopback<double>, ArrayLoopback<bool>, ArrayLoopback<float>, ArrayLoopback<int32_t>,
+    ArrayLoopback<int64_t>, ArrayLoopback<uint8_t>, ArrayLoopback<uint16_t>>;
+
+  struct InterfaceLoopbacks
+  {
+    std::vector<Loopback> scalars;
+    std::vector<ArrayLoopbackVariant> arrays;
+  };
+
+  struct MimicInterface
+  {
+    hardware_interface::StateInterfaceAccessor<double> mimic;
+    hardware_interface::StateInterfaceAccessor<double> mimicked;
+    /// The offset is only applied to the position
+    bool is_position;
+    double offset;
+    double multiplier;
+  };
+
   bool populate_interfaces(
     const std::vector<hardware_interface::ComponentInfo> & components,
     std::vector<hardware_interface::InterfaceDescription> & command_interface_descriptions) const;
 
+  /// Resolve the interfaces used in read() once, so that they are not looked up by name.
+  void resolve_interfaces();
+
+  void add_loopback(
+    const hardware_interface::StateInterface::SharedPtr & state,
+    InterfaceLoopbacks & loopbacks) const;
+
+  template <typename T>
+  Loopback make_loopback(const std::string & name) const;
+
+  template <typename T>
+  ArrayLoopbackVariant make_array_loopback(const std::string & name, size_t size) const;
+
+  return_type mirror_loopbacks(InterfaceLoopbacks & loopbacks);
+
   bool use_mock_gpio_command_interfaces_;
   bool use_mock_sensor_command_interfaces_;
 
@@ -97,6 +160,25 @@ private:
   std::vector<size_t> joint_control_mode_;
 
   bool command_propagation_disabled_;
+
+  bool interfaces_resolved_ = false;
+  /// Position, velocity and acceleration interfaces of the joints, indexed by the joint index.
+  /// The accessors of missing interfaces are invalid.
+  std::array<std::vector<hardware_interface::StateInterfaceAccessor<double>>, 3>
+    joint_state_accessors_;
+  std::array<std::vector<hardware_interface::CommandInterfaceAccessor<double>>, 3>
+    joint_command_accessors_;
+  /// Contiguous values of the joints the dynamics are calculated on, indexed like the accessors
+  std::array<std::vector<double>, 3> joint_state_values_;
+  std::array<std::vector<double>, 3> joint_command_values_;
+  /// Position commands mirrored to the states if the dynamics are not calculated
+  std::vector<ScalarLoopback<double>> position_loopbacks_;
+  /// Position commands of the joints mirrored to their custom interface with following offset
+  std::vector<ScalarLoopback<double>> custom_interface_loopbacks_;
+  InterfaceLoopbacks joint_loopbacks_;
+  std::vector<MimicInterface> mimic_interfaces_;
+  /// Sensor and GPIO interfaces, mirrored after the mimic joints
+  InterfaceLoopbacks component_loopbacks_;
 };
 
 typedef GenericSystem GenericRobot;
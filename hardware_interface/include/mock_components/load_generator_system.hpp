@@ -0,0 +1,46 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MOCK_COMPONENTS__LOAD_GENERATOR_SYSTEM_HPP_
+#define MOCK_COMPONENTS__LOAD_GENERATOR_SYSTEM_HPP_
+
+#include "mock_components/generic_system.hpp"
+#include "mock_components/synthetic_load.hpp"
+
+namespace mock_components
+{
+/// GenericSystem generating a synthetic load in each read() for capacity planning.
+/**
+ * The interfaces behave like the ones of GenericSystem. Additionally, each read() spends the cpu
+ * time, touches the cache footprint and fails with the failure rate set by the parameters of the
+ * synthetic load, see parse_synthetic_load_parameters(). A failed read() returns ERROR, which is
+ * handled by the resource manager like an error of real hardware.
+ */
+class LoadGeneratorSystem : public GenericSystem
+{
+public:
+  CallbackReturn on_init(
+    const hardware_interface::HardwareComponentInterfaceParams & params) override;
+
+  return_type read(const rclcpp::Time & time, const rclcpp::Duration & period) override;
+
+  const SyntheticLoad & get_synthetic_load() const { return load_; }
+
+private:
+  SyntheticLoad load_;
+};
+
+}  // namespace mock_components
+
+#endif  // MOCK_COMPONENTS__LOAD_GENERATOR_SYSTEM_HPP_
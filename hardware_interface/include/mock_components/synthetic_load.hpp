@@ -0,0 +1,118 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MOCK_COMPONENTS__SYNTHETIC_LOAD_HPP_
+#define MOCK_COMPONENTS__SYNTHETIC_LOAD_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mock_components
+{
+enum class JitterDistribution
+{
+  NONE,
+  UNIFORM,
+  NORMAL,
+  EXPONENTIAL
+};
+
+/// Parameters of the synthetic load generated in each cycle.
+struct SyntheticLoadParameters
+{
+  /// Time the cycle is busy, without jitter.
+  std::chrono::nanoseconds cpu_time{0};
+  /// Memory allocated and pre-faulted when the load is created.
+  size_t memory_footprint = 0;
+  /// Part of the memory read and written in each cycle, grows the memory if it is larger.
+  size_t cache_footprint = 0;
+  JitterDistribution jitter_distribution = JitterDistribution::NONE;
+  /**
+   * Scale of the jitter added to the cpu time: the maximum of the uniform, the standard deviation
+   * of the normal, and the mean of the exponential distribution.
+   */
+  std::chrono::nanoseconds jitter{0};
+  /// Probability that a cycle fails, between 0 and 1.
+  double failure_rate = 0.0;
+  /// Seed of the jitter and failures, so that runs can be repeated.
+  uint32_t seed = 0;
+};
+
+/// Parses the parameters of the synthetic load from the parameters of a hardware component.
+/**
+ * The parameters are `cpu_time_us`, `memory_footprint_bytes`, `cache_footprint_bytes`,
+ * `jitter_distribution` (`none`, `uniform`, `normal` or `exponential`), `jitter_us`,
+ * `failure_rate` and `seed`. Missing parameters keep their default value.
+ *
+ * \param[in] parameters The parameters to parse.
+ * \throws std::invalid_argument if a value is invalid or out of range.
+ */
+SyntheticLoadParameters parse_synthetic_load_parameters(
+  const std::unordered_map<std::string, std::string> & parameters);
+
+/// Parses the name of a jitter distribution, case-insensitive.
+/**
+ * \throws std::invalid_argument if the distribution is unknown.
+ */
+JitterDistribution parse_jitter_distribution(const std::string & distribution);
+
+/// Synthetic per-cycle load with configurable CPU time, memory and cache footprint, jitter and
+/// failure rate, e.g., to measure the scheduling headroom of the controller manager.
+/**
+ * All memory is allocated when the load is created, run_cycle() doesn't allocate and can be called
+ * from the realtime loop. The cpu time is spent busy-waiting on the steady clock, thus time the
+ * thread is preempted counts towards it like for a real component.
+ */
+class SyntheticLoad
+{
+public:
+  SyntheticLoad() = default;
+
+  /**
+   * \throws std::invalid_argument if a parameter is out of range.
+   */
+  explicit SyntheticLoad(const SyntheticLoadParameters & parameters);
+
+  /// Generates the load of one cycle.
+  /**
+   * \returns false if the cycle fails according to the failure rate.
+   */
+  bool run_cycle();
+
+  const SyntheticLoadParameters & get_parameters() const { return parameters_; }
+
+  /// Duration of the last cycle, including the cache accesses and jitter.
+  std::chrono::nanoseconds get_last_cycle_time() const { return last_cycle_time_; }
+
+private:
+  std::chrono::nanoseconds sample_jitter();
+
+  SyntheticLoadParameters parameters_;
+  std::vector<uint8_t> memory_;
+  std::mt19937 random_engine_;
+  std::uniform_real_distribution<double> uniform_distribution_{0.0, 1.0};
+  std::normal_distribution<double> normal_distribution_{0.0, 1.0};
+  std::exponential_distribution<double> exponential_distribution_{1.0};
+  std::bernoulli_distribution failure_distribution_{0.0};
+  std::chrono::nanoseconds last_cycle_time_{0};
+};
+
+}  // namespace mock_components
+
+#endif  // MOCK_COMPONENTS__SYNTHETIC_LOAD_HPP_
@@ -0,0 +1,110 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/command_interpolator.hpp"
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "hardware_interface/lexical_casts.hpp"
+
+namespace hardware_interface
+{
+CommandInterpolation parse_command_interpolation(const std::string & interpolation)
+{
+  const std::string lower_case_interpolation = to_lower_case(interpolation);
+  if (lower_case_interpolation == "none")
+  {
+    return CommandInterpolation::NONE;
+  }
+  if (lower_case_interpolation == "linear")
+  {
+    return CommandInterpolation::LINEAR;
+  }
+  if (lower_case_interpolation == "cubic")
+  {
+    return CommandInterpolation::CUBIC;
+  }
+  throw std::invalid_argument(
+    fmt::format(
+      FMT_COMPILE("Unknown command interpolation: '{}', expected 'none', 'linear' or 'cubic'."),
+      interpolation));
+}
+
+void CommandInterpolator::add_setpoint(int64_t time, double value)
+{
+  if (number_of_setpoints_ > 0)
+  {
+    const auto & latest = setpoints_[number_of_setpoints_ - 1];
+    if (time <= latest.time)
+    {
+      setpoints_[number_of_setpoints_ - 1].value = value;
+      return;
+    }
+    // the interpolation restarts after non-finite setpoints
+    if (!std::isfinite(latest.value) || !std::isfinite(value))
+    {
+      number_of_setpoints_ = 0;
+    }
+  }
+  if (number_of_setpoints_ == setpoints_.size())
+  {
+    std::rotate(setpoints_.begin(), setpoints_.begin() + 1, setpoints_.end());
+    --number_of_setpoints_;
+  }
+  setpoints_[number_of_setpoints_++] = {time, value};
+}
+
+double CommandInterpolator::interpolate(int64_t time) const
+{
+  if (number_of_setpoints_ == 0)
+  {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  const auto & latest = setpoints_[number_of_setpoints_ - 1];
+  if (interpolation_ == CommandInterpolation::NONE || number_of_setpoints_ < 2)
+  {
+    return latest.value;
+  }
+  const auto & previous = setpoints_[number_of_setpoints_ - 2];
+  const double duration = static_cast<double>(latest.time - previous.time);
+  const double s = std::clamp(static_cast<double>(time - latest.time) / duration, 0.0, 1.0);
+  const double delta = latest.value - previous.value;
+  if (interpolation_ == CommandInterpolation::LINEAR)
+  {
+    return previous.value + s * delta;
+  }
+
+  // Hermite spline with the tangents scaled to the duration of the segment
+  double start_tangent = delta;
+  if (number_of_setpoints_ == 3)
+  {
+    const auto & oldest = setpoints_[0];
+    start_tangent = (previous.value - oldest.value) * duration /
+                    static_cast<double>(previous.time - oldest.time);
+  }
+  const double end_tangent = delta;
+  const double s2 = s * s;
+  const double s3 = s2 * s;
+  return (2.0 * s3 - 3.0 * s2 + 1.0) * previous.value + (s3 - 2.0 * s2 + s) * start_tangent +
+         (-2.0 * s3 + 3.0 * s2) * latest.value + (s3 - s2) * end_tangent;
+}
+
+}  // namespace hardware_interface
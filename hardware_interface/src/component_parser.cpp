@@ -15,11 +15,13 @@
 #include <fmt/compile.h>
 #include <tinyxml2.h>
 
+#include <chrono>
 #include <iostream>
 #include <regex>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "rclcpp/version.h"
@@ -69,10 +71,15 @@ constexpr const auto kReductionAttribute = "mechanical_reduction";
 constexpr const auto kOffsetAttribute = "offset";
 constexpr const auto kReadWriteRateAttribute = "rw_rate";
 constexpr const auto kIsAsyncAttribute = "is_async";
+constexpr const auto kRealtimeMemoryArenaSizeAttribute = "realtime_memory_arena_size";
 constexpr const auto kThreadPriorityAttribute = "thread_priority";
 constexpr const auto kAffinityCoresAttribute = "affinity";
 constexpr const auto kSchedulingPolicyAttribute = "scheduling_policy";
 constexpr const auto kPrintWarningsAttribute = "print_warnings";
+constexpr const auto kPipelinedAttribute = "pipelined";
+constexpr const auto kSchedRuntimeAttribute = "sched_runtime";
+constexpr const auto kSchedDeadlineAttribute = "sched_deadline";
+constexpr const auto kSchedPeriodAttribute = "sched_period";
 
 }  // namespace
 
@@ -675,6 +682,11 @@ HardwareInfo parse_resource_from_xml(
   hardware.type = get_attribute_value(ros2_control_it, kTypeAttribute, kROS2ControlTag);
   hardware.rw_rate = parse_rw_rate_attribute(ros2_control_it);
   hardware.is_async = parse_is_async_attribute(ros2_control_it);
+  if (ros2_control_it->FindAttribute(kRealtimeMemoryArenaSizeAttribute))
+  {
+    hardware.realtime_memory_arena_size = parse_integer<uint32_t>(get_attribute_value(
+      ros2_control_it, kRealtimeMemoryArenaSizeAttribute, kROS2ControlTag));
+  }
   hardware.async_params.thread_priority = hardware.is_async
                                             ? parse_thread_priority_attribute(ros2_control_it)
                                             : std::numeric_limits<int>::max();
@@ -759,6 +771,51 @@ HardwareInfo parse_resource_from_xml(
             hardware.async_params.print_warnings =
               parse_bool(get_attribute_value(async_it, kPrintWarningsAttribute, kAsyncTag));
           }
+          if (async_it->FindAttribute(kPipelinedAttribute))
+          {
+            hardware.async_params.pipelined =
+              parse_bool(get_attribute_value(async_it, kPipelinedAttribute, kAsyncTag));
+            if (
+              hardware.async_params.pipelined &&
+              (!hardware.is_async || hardware.async_params.scheduling_policy != "synchronized"))
+            {
+              throw std::runtime_error(
+                fmt::format(
+                  FMT_COMPILE(
+                    "The {} attribute requires the {} attribute of the {} tag and the "
+                    "'synchronized' {}."),
+                  kPipelinedAttribute, kIsAsyncAttribute, kROS2ControlTag,
+                  kSchedulingPolicyAttribute));
+            }
+          }
+          auto & deadline_scheduling = hardware.async_params.deadline_scheduling;
+          for (const auto & [attribute, duration] :
+               {std::make_pair(kSchedRuntimeAttribute, &deadline_scheduling.runtime),
+                std::make_pair(kSchedDeadlineAttribute, &deadline_scheduling.deadline),
+                std::make_pair(kSchedPeriodAttribute, &deadline_scheduling.period)})
+          {
+            if (async_it->FindAttribute(attribute))
+            {
+              *duration = std::chrono::microseconds(
+                parse_integer<uint32_t>(get_attribute_value(async_it, attribute, kAsyncTag)));
+            }
+          }
+          if (
+            (deadline_scheduling.deadline.count() > 0 || deadline_scheduling.period.count() > 0) &&
+            !deadline_scheduling.is_enabled())
+          {
+            throw std::runtime_error(
+              fmt::format(
+                FMT_COMPILE("The {} and {} attributes require the {} attribute."),
+                kSchedDeadlineAttribute, kSchedPeriodAttribute, kSchedRuntimeAttribute));
+          }
+          if (deadline_scheduling.is_enabled() && !hardware.is_async)
+          {
+            throw std::runtime_error(
+              fmt::format(
+                FMT_COMPILE("The {} attribute requires the {} attribute of the {} tag."),
+                kSchedRuntimeAttribute, kIsAsyncAttribute, kROS2ControlTag));
+          }
         }
         catch (const std::exception & e)
         {
@@ -0,0 +1,220 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/deadline_scheduling.hpp"
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#ifdef __linux__
+#include <signal.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace hardware_interface
+{
+namespace
+{
+#ifdef __linux__
+// Reference: https://man7.org/linux/man-pages/man2/sched_setattr.2.html
+// The structure is declared here, as older C libraries don't provide sched_setattr()
+struct SchedAttr
+{
+  uint32_t size;
+  uint32_t sched_policy;
+  uint64_t sched_flags;
+  int32_t sched_nice;
+  uint32_t sched_priority;
+  uint64_t sched_runtime;
+  uint64_t sched_deadline;
+  uint64_t sched_period;
+};
+
+constexpr uint32_t kSchedDeadline = 6;
+// the kernel signals runtime overruns with SIGXCPU
+constexpr uint64_t kSchedFlagDlOverrun = 0x04;
+
+pid_t get_thread_id() { return static_cast<pid_t>(syscall(SYS_gettid)); }
+#else
+int get_thread_id() { return 0; }
+#endif
+
+/// Thread whose overruns are counted, a zero thread id marks a free slot
+struct OverrunSlot
+{
+  std::atomic<int> thread_id{0};
+  std::atomic<uint64_t> overruns{0};
+};
+
+std::array<OverrunSlot, DeadlineOverrunCounter::kMaxThreads> overrun_slots;
+
+// a claimed slot whose thread id isn't set yet
+constexpr int kClaimedSlot = -1;
+
+#ifdef __linux__
+void count_overrun(int /*signal*/)
+{
+  const int saved_errno = errno;
+  const int thread_id = static_cast<int>(get_thread_id());
+  for (auto & slot : overrun_slots)
+  {
+    if (slot.thread_id.load(std::memory_order_acquire) == thread_id)
+    {
+      slot.overruns.fetch_add(1, std::memory_order_relaxed);
+      break;
+    }
+  }
+  errno = saved_errno;
+}
+
+void install_overrun_handler()
+{
+  static std::once_flag installed;
+  std::call_once(
+    installed,
+    []()
+    {
+      struct sigaction current_action;
+      if (sigaction(SIGXCPU, nullptr, &current_action) != 0 || current_action.sa_handler != SIG_DFL)
+      {
+        // the application handles SIGXCPU itself
+        return;
+      }
+      struct sigaction action;
+      std::memset(&action, 0, sizeof(action));
+      action.sa_handler = count_overrun;
+      sigemptyset(&action.sa_mask);
+      action.sa_flags = SA_RESTART;
+      sigaction(SIGXCPU, &action, nullptr);
+    });
+}
+#endif
+}  // namespace
+
+DeadlineSchedulingParams resolve_deadline_scheduling_params(
+  const DeadlineSchedulingParams & params, std::chrono::microseconds default_period)
+{
+  DeadlineSchedulingParams resolved = params;
+  if (resolved.period.count() == 0)
+  {
+    resolved.period = default_period;
+  }
+  if (resolved.deadline.count() == 0)
+  {
+    resolved.deadline = resolved.period;
+  }
+  if (
+    resolved.runtime.count() <= 0 || resolved.runtime > resolved.deadline ||
+    resolved.deadline > resolved.period)
+  {
+    throw std::invalid_argument(
+      fmt::format(
+        FMT_COMPILE(
+          "Invalid SCHED_DEADLINE reservation: runtime {} us, deadline {} us and period {} us have "
+          "to satisfy 0 < runtime <= deadline <= period."),
+        resolved.runtime.count(), resolved.deadline.count(), resolved.period.count()));
+  }
+  return resolved;
+}
+
+std::pair<bool, std::string> configure_sched_deadline(const DeadlineSchedulingParams & params)
+{
+#ifdef __linux__
+  install_overrun_handler();
+  SchedAttr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.sched_policy = kSchedDeadline;
+  attr.sched_flags = kSchedFlagDlOverrun;
+  attr.sched_runtime = static_cast<uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(params.runtime).count());
+  attr.sched_deadline = static_cast<uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(params.deadline).count());
+  attr.sched_period = static_cast<uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(params.period).count());
+  if (syscall(SYS_sched_setattr, 0, &attr, 0) != 0)
+  {
+    const int error = errno;
+    std::string reason = strerror(error);
+    if (error == EBUSY)
+    {
+      reason += " (the admission control rejected the reservation, the CPUs are overcommitted)";
+    }
+    else if (error == EPERM)
+    {
+      reason +=
+        " (missing CAP_SYS_NICE, or the CPU affinity doesn't span the scheduling domain of the "
+        "thread)";
+    }
+    return {false, reason};
+  }
+  return {true, ""};
+#else
+  (void)params;
+  return {false, "SCHED_DEADLINE is only supported on Linux"};
+#endif
+}
+
+bool DeadlineOverrunCounter::attach_to_current_thread()
+{
+  detach();
+  for (size_t i = 0; i < overrun_slots.size(); ++i)
+  {
+    auto & slot = overrun_slots[i];
+    int free_slot = 0;
+    if (slot.thread_id.compare_exchange_strong(free_slot, kClaimedSlot))
+    {
+      slot.overruns.store(0, std::memory_order_relaxed);
+      slot.thread_id.store(static_cast<int>(get_thread_id()), std::memory_order_release);
+      slot_.store(static_cast<int>(i), std::memory_order_release);
+      return true;
+    }
+  }
+  return false;
+}
+
+void DeadlineOverrunCounter::detach()
+{
+  const int slot_index = slot_.exchange(-1);
+  if (slot_index < 0)
+  {
+    return;
+  }
+  auto & slot = overrun_slots[static_cast<size_t>(slot_index)];
+  detached_count_.fetch_add(slot.overruns.load(std::memory_order_relaxed));
+  slot.thread_id.store(0, std::memory_order_release);
+}
+
+uint64_t DeadlineOverrunCounter::get_count() const
+{
+  uint64_t count = detached_count_.load(std::memory_order_relaxed);
+  const int slot_index = slot_.load(std::memory_order_acquire);
+  if (slot_index >= 0)
+  {
+    const auto & slot = overrun_slots[static_cast<size_t>(slot_index)];
+    count += slot.overruns.load(std::memory_order_relaxed);
+  }
+  return count;
+}
+
+}  // namespace hardware_interface
@@ -14,7 +14,10 @@
 
 #include "hardware_interface/hardware_component.hpp"
 
+#include <fmt/compile.h>
+
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -42,6 +45,7 @@ HardwareComponent::HardwareComponent(HardwareComponent && other) noexcept
 {
   std::lock_guard<std::recursive_mutex> lock(other.component_mutex_);
   impl_ = std::move(other.impl_);
+  stale_state_detection_.store(other.stale_state_detection_.load());
   last_read_cycle_time_ = rclcpp::Time(0, 0, RCL_CLOCK_UNINITIALIZED);
   last_write_cycle_time_ = rclcpp::Time(0, 0, RCL_CLOCK_UNINITIALIZED);
 }
@@ -253,7 +257,16 @@ std::vector<StateInterface::ConstSharedPtr> HardwareComponent::export_state_inte
   // Framework exports and creates everything
   if (interfaces.empty())
   {
-    return impl_->on_export_state_interfaces();
+    return impl_->separate_exported_state_interfaces(impl_->on_export_state_interfaces());
+  }
+  if (impl_->is_pipelined())
+  {
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE(
+          "Pipelined hardware component: {} has to export its state interfaces with "
+          "on_export_state_interfaces()."),
+        impl_->get_name()));
   }
 
   // BEGIN (Handle export change): for backward compatibility, can be removed if
@@ -284,7 +297,16 @@ std::vector<CommandInterface::SharedPtr> HardwareComponent::export_command_inter
   // Framework exports and creates everything
   if (interfaces.empty())
   {
-    return impl_->on_export_command_interfaces();
+    return impl_->separate_exported_command_interfaces(impl_->on_export_command_interfaces());
+  }
+  if (impl_->is_pipelined())
+  {
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE(
+          "Pipelined hardware component: {} has to export its command interfaces with "
+          "on_export_command_interfaces()."),
+        impl_->get_name()));
   }
   // BEGIN (Handle export change): for backward compatibility, can be removed if
   // export_command_interfaces() method is removed
@@ -338,6 +360,42 @@ const HardwareComponentStatisticsCollector & HardwareComponent::get_write_statis
   return write_statistics_;
 }
 
+size_t HardwareComponent::get_stale_read_cycles() const { return stale_read_cycles_; }
+
+void HardwareComponent::set_stale_state_detection(bool enable)
+{
+  stale_state_detection_.store(enable, std::memory_order_relaxed);
+}
+
+uint64_t HardwareComponent::get_deadline_overruns() const
+{
+  return impl_->get_deadline_overruns();
+}
+
+RealtimeMemoryArenaStatistics HardwareComponent::get_realtime_memory_arena_statistics() const
+{
+  return impl_->get_realtime_memory_arena_statistics();
+}
+
+void HardwareComponent::set_async_thread_cpu_affinity(const std::vector<int> & cpus)
+{
+  impl_->set_async_thread_cpu_affinity(cpus);
+}
+
+void HardwareComponent::update_stale_read_cycles()
+{
+  const auto state_update_sequence = impl_->get_state_update_sequence();
+  if (state_update_sequence.has_value() && state_update_sequence == last_state_update_sequence_)
+  {
+    ++stale_read_cycles_;
+  }
+  else
+  {
+    stale_read_cycles_ = 0;
+    last_state_update_sequence_ = state_update_sequence;
+  }
+}
+
 return_type HardwareComponent::read(const rclcpp::Time & time, const rclcpp::Duration & period)
 {
   if (lifecycleStateThatRequiresNoAction(impl_->get_lifecycle_state().id()))
@@ -367,12 +425,26 @@ return_type HardwareComponent::read(const rclcpp::Time & time, const rclcpp::Dur
           1.0 / (time - last_read_cycle_time_).seconds());
       }
       last_read_cycle_time_ = time;
+      if (stale_state_detection_.load(std::memory_order_relaxed))
+      {
+        update_stale_read_cycles();
+      }
     }
     return trigger_result.result;
   }
   return return_type::OK;
 }
 
+void HardwareComponent::extrapolate_states(const rclcpp::Time & time)
+{
+  if (
+    impl_->get_lifecycle_state().id() == lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE ||
+    impl_->get_lifecycle_state().id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+  {
+    impl_->extrapolate_states(time);
+  }
+}
+
 return_type HardwareComponent::write(const rclcpp::Time & time, const rclcpp::Duration & period)
 {
   if (impl_->get_hardware_info().type == "sensor")
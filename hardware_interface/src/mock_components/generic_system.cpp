@@ -16,12 +16,21 @@
 
 #include "mock_components/generic_system.hpp"
 
+#include <fmt/compile.h>
+
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <stdexcept>
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <variant>
 #include <vector>
 
 #include "hardware_interface/lexical_casts.hpp"
@@ -306,6 +315,7 @@ hardware_interface::CallbackReturn GenericSystem::on_configure(
   // Set position control mode per default
   // This will be populated by perform_command_mode_switch
   joint_control_mode_.resize(get_hardware_info().joints.size(), POSITION_INTERFACE_INDEX);
+  resolve_interfaces();
   return hardware_interface::CallbackReturn::SUCCESS;
 }
 
@@ -336,224 +346,254 @@ return_type GenericSystem::read(const rclcpp::Time & /*time*/, const rclcpp::Dur
     RCLCPP_WARN(get_logger(), "Command propagation is disabled - no values will be returned!");
     return return_type::OK;
   }
+  if (!interfaces_resolved_)
+  {
+    // e.g., derived classes not calling on_configure of the GenericSystem
+    resolve_interfaces();
+  }
 
-  auto mirror_command_to_state = [this](const auto & name, const auto & data_type) -> return_type
+  const double position_offset =
+    custom_interface_with_following_offset_.empty() ? position_state_following_offset_ : 0.0;
+  if (calculate_dynamics_)
   {
-    switch (data_type)
+    const size_t number_of_joints = get_hardware_info().joints.size();
+    for (size_t i = 0; i < 3; ++i)
     {
-      case hardware_interface::HandleDataType::DOUBLE:
+      for (size_t j = 0; j < number_of_joints; ++j)
       {
-        auto cmd = get_command(name);
-        if (std::isinf(cmd))
-        {
-          return return_type::ERROR;
-        }
-        else if (std::isfinite(cmd))
-        {
-          set_state(name, cmd);
-        }
-        else
-        {
-          // NaN - do nothing. Command might not be set yet
-        }
-        break;
-      }
-      case hardware_interface::HandleDataType::BOOL:
-      {
-        set_state(name, get_command<bool>(name));
-        break;
+        const auto & command = joint_command_accessors_[i][j];
+        const auto & state = joint_state_accessors_[i][j];
+        joint_command_values_[i][j] =
+          command.is_valid() ? command.get() : std::numeric_limits<double>::quiet_NaN();
+        // the states are only written by this component, thus read without locking them
+        joint_state_values_[i][j] =
+          state.is_valid() ? state.get_unsynchronized() : std::numeric_limits<double>::quiet_NaN();
       }
-      default:
-      {
-      }
-        // not handling other types
     }
-    return return_type::OK;
-  };
 
-  for (size_t j = 0; j < get_hardware_info().joints.size(); ++j)
-  {
-    if (calculate_dynamics_)
+    const double dt = period.seconds();
+    auto & positions = joint_state_values_[POSITION_INTERFACE_INDEX];
+    auto & velocities = joint_state_values_[VELOCITY_INTERFACE_INDEX];
+    auto & accelerations = joint_state_values_[ACCELERATION_INTERFACE_INDEX];
+    const auto & position_commands = joint_command_values_[POSITION_INTERFACE_INDEX];
+    const auto & velocity_commands = joint_command_values_[VELOCITY_INTERFACE_INDEX];
+    const auto & acceleration_commands = joint_command_values_[ACCELERATION_INTERFACE_INDEX];
+    for (size_t j = 0; j < number_of_joints; ++j)
     {
-      std::array<double, 3> joint_state_values_ = {
-        {std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(),
-         std::numeric_limits<double>::quiet_NaN()}};
-      std::array<double, 3> joint_command_values_ = {
-        {std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN(),
-         std::numeric_limits<double>::quiet_NaN()}};
-      const auto & joint_name = get_hardware_info().joints[j].name;
-      for (size_t i = 0; i < 3; ++i)
-      {
-        const auto full_name = joint_name + "/" + standard_interfaces_[i];
-        if (has_command(full_name))
-        {
-          joint_command_values_[i] = get_command(full_name);
-        }
-        if (has_state(full_name))
-        {
-          joint_state_values_[i] = get_state(full_name);
-        }
-      }
-
       switch (joint_control_mode_[j])
       {
         case ACCELERATION_INTERFACE_INDEX:
         {
-          if (std::isnan(joint_state_values_[VELOCITY_INTERFACE_INDEX]))
+          if (std::isnan(velocities[j]))
           {
-            joint_state_values_[VELOCITY_INTERFACE_INDEX] = 0.0;
+            velocities[j] = 0.0;
           }
 
-          if (std::isfinite(joint_command_values_[ACCELERATION_INTERFACE_INDEX]))
+          if (std::isfinite(acceleration_commands[j]))
           {
-            joint_state_values_[ACCELERATION_INTERFACE_INDEX] =
-              joint_command_values_[ACCELERATION_INTERFACE_INDEX];
+            accelerations[j] = acceleration_commands[j];
           }
           // currently we do backward Euler integration
-          joint_state_values_[VELOCITY_INTERFACE_INDEX] +=
-            std::isnan(joint_state_values_[ACCELERATION_INTERFACE_INDEX])
-              ? 0.0
-              : joint_state_values_[ACCELERATION_INTERFACE_INDEX] * period.seconds();
-          joint_state_values_[POSITION_INTERFACE_INDEX] +=  // apply offset to positions only
-            std::isfinite(joint_state_values_[VELOCITY_INTERFACE_INDEX])
-              ? joint_state_values_[VELOCITY_INTERFACE_INDEX] * period.seconds()
-              : 0.0 + (custom_interface_with_following_offset_.empty()
-                         ? position_state_following_offset_
-                         : 0.0);
+          velocities[j] += std::isnan(accelerations[j]) ? 0.0 : accelerations[j] * dt;
+          // apply offset to positions only
+          positions[j] += std::isfinite(velocities[j]) ? velocities[j] * dt : position_offset;
           break;
         }
         case VELOCITY_INTERFACE_INDEX:
         {
-          if (std::isfinite(joint_command_values_[VELOCITY_INTERFACE_INDEX]))
+          if (std::isfinite(velocity_commands[j]))
           {
-            const double old_velocity = std::isfinite(joint_state_values_[VELOCITY_INTERFACE_INDEX])
-                                          ? joint_state_values_[VELOCITY_INTERFACE_INDEX]
-                                          : 0.0;
-            joint_state_values_[VELOCITY_INTERFACE_INDEX] =
-              joint_command_values_[VELOCITY_INTERFACE_INDEX];
-
-            joint_state_values_[ACCELERATION_INTERFACE_INDEX] =
-              (joint_state_values_[VELOCITY_INTERFACE_INDEX] - old_velocity) / period.seconds();
+            const double old_velocity = std::isfinite(velocities[j]) ? velocities[j] : 0.0;
+            velocities[j] = velocity_commands[j];
+            accelerations[j] = (velocities[j] - old_velocity) / dt;
           }
           // currently we do backward Euler integration
-          joint_state_values_[POSITION_INTERFACE_INDEX] +=  // apply offset to positions only
-            std::isfinite(joint_state_values_[VELOCITY_INTERFACE_INDEX])
-              ? joint_state_values_[VELOCITY_INTERFACE_INDEX] * period.seconds()
-              : 0.0 + (custom_interface_with_following_offset_.empty()
-                         ? position_state_following_offset_
-                         : 0.0);
+          // apply offset to positions only
+          positions[j] += std::isfinite(velocities[j]) ? velocities[j] * dt : position_offset;
           break;
         }
         case POSITION_INTERFACE_INDEX:
         {
-          if (std::isfinite(joint_command_values_[POSITION_INTERFACE_INDEX]))
+          if (std::isfinite(position_commands[j]))
           {
-            const double old_position = joint_state_values_[POSITION_INTERFACE_INDEX];
-            const double old_velocity = std::isfinite(joint_state_values_[VELOCITY_INTERFACE_INDEX])
-                                          ? joint_state_values_[VELOCITY_INTERFACE_INDEX]
-                                          : 0.0;
-
-            joint_state_values_[POSITION_INTERFACE_INDEX] =  // apply offset to positions only
-              joint_command_values_[POSITION_INTERFACE_INDEX] +
-              (custom_interface_with_following_offset_.empty() ? position_state_following_offset_
-                                                               : 0.0);
-
-            joint_state_values_[VELOCITY_INTERFACE_INDEX] =
-              (joint_state_values_[POSITION_INTERFACE_INDEX] - old_position) / period.seconds();
-
-            joint_state_values_[ACCELERATION_INTERFACE_INDEX] =
-              (joint_state_values_[VELOCITY_INTERFACE_INDEX] - old_velocity) / period.seconds();
+            const double old_position = positions[j];
+            const double old_velocity = std::isfinite(velocities[j]) ? velocities[j] : 0.0;
+            // apply offset to positions only
+            positions[j] = position_commands[j] + position_offset;
+            velocities[j] = (positions[j] - old_position) / dt;
+            accelerations[j] = (velocities[j] - old_velocity) / dt;
           }
           break;
         }
       }
-      // mirror them back
-      for (size_t i = 0; i < standard_interfaces_.size(); ++i)
-      {
-        if (
-          std::isfinite(joint_state_values_[i]) &&
-          has_state(joint_name + "/" + standard_interfaces_[i]))
-        {
-          set_state(joint_name + "/" + standard_interfaces_[i], joint_state_values_[i]);
-        }
-      }
     }
-    else
+
+    // mirror them back
+    for (size_t i = 0; i < 3; ++i)
     {
-      for (const auto & joint_command : joint_commands_)
+      for (size_t j = 0; j < number_of_joints; ++j)
       {
-        if (joint_command.get()->get_interface_name() == hardware_interface::HW_IF_POSITION)
+        auto & state = joint_state_accessors_[i][j];
+        if (std::isfinite(joint_state_values_[i][j]) && state.is_valid())
         {
-          const std::string & name = joint_command.get()->get_name();
-          if (has_state(name))
-          {
-            set_state(
-              name, get_command(name) + (custom_interface_with_following_offset_.empty()
-                                           ? position_state_following_offset_
-                                           : 0.0));
-          }
+          state.set(joint_state_values_[i][j]);
         }
       }
     }
   }
+  else
+  {
+    for (auto & loopback : position_loopbacks_)
+    {
+      loopback.state.set(loopback.command.get() + position_offset);
+    }
+  }
 
   // do loopback on all other interfaces
-  for (const auto & joint_state : joint_states_)
+  if (mirror_loopbacks(joint_loopbacks_) != return_type::OK)
   {
-    if (
-      std::find(
-        skip_interfaces_.begin(), skip_interfaces_.end(),
-        joint_state.get()->get_interface_name()) != skip_interfaces_.end())
+    return return_type::ERROR;
+  }
+  for (auto & loopback : custom_interface_loopbacks_)
+  {
+    loopback.state.set(loopback.command.get() + position_state_following_offset_);
+  }
+
+  // Update mimic joints
+  for (auto & mimic_interface : mimic_interfaces_)
+  {
+    const double value = mimic_interface.multiplier * mimic_interface.mimicked.get();
+    mimic_interface.mimic.set(
+      mimic_interface.is_position ? mimic_interface.offset + value : value);
+  }
+
+  // do loopback on the sensor and gpio interfaces
+  return mirror_loopbacks(component_loopbacks_);
+}
+
+// Private methods
+void GenericSystem::resolve_interfaces()
+{
+  const auto & info = get_hardware_info();
+  const size_t number_of_joints = info.joints.size();
+  for (size_t i = 0; i < 3; ++i)
+  {
+    joint_state_accessors_[i].assign(number_of_joints, {});
+    joint_command_accessors_[i].assign(number_of_joints, {});
+    joint_state_values_[i].assign(number_of_joints, std::numeric_limits<double>::quiet_NaN());
+    joint_command_values_[i].assign(number_of_joints, std::numeric_limits<double>::quiet_NaN());
+  }
+  position_loopbacks_.clear();
+  custom_interface_loopbacks_.clear();
+  joint_loopbacks_ = InterfaceLoopbacks();
+  mimic_interfaces_.clear();
+  component_loopbacks_ = InterfaceLoopbacks();
+
+  std::unordered_map<std::string, size_t> joint_indices;
+  for (size_t j = 0; j < number_of_joints; ++j)
+  {
+    joint_indices[info.joints[j].name] = j;
+  }
+  // returns the joint index and the index of the position, velocity or acceleration interface
+  auto find_standard_interface = [this, &joint_indices](const hardware_interface::Handle & handle)
+  {
+    const auto joint_it = joint_indices.find(handle.get_prefix_name());
+    const auto interface_it = std::find(
+      standard_interfaces_.begin(), standard_interfaces_.begin() + 3, handle.get_interface_name());
+    const bool is_standard_interface = joint_it != joint_indices.end() &&
+                                       interface_it != standard_interfaces_.begin() + 3 &&
+                                       !handle.is_array() &&
+                                       handle.get_data_type() ==
+                                         hardware_interface::HandleDataType::DOUBLE;
+    return std::make_tuple(
+      is_standard_interface, is_standard_interface ? joint_it->second : 0u,
+      static_cast<size_t>(std::distance(standard_interfaces_.begin(), interface_it)));
+  };
+  for (const auto & state : joint_states_)
+  {
+    const auto [is_standard_interface, j, i] = find_standard_interface(*state);
+    if (is_standard_interface)
     {
-      continue;
+      joint_state_accessors_[i][j] = get_state_accessor(state->get_name());
     }
-    const std::string & full_interface_name = joint_state.get()->get_name();
-    if (has_command(full_interface_name))
+  }
+  for (const auto & command : joint_commands_)
+  {
+    const auto [is_standard_interface, j, i] = find_standard_interface(*command);
+    if (is_standard_interface)
     {
-      if (
-        mirror_command_to_state(full_interface_name, joint_state.get()->get_data_type()) !=
-        return_type::OK)
-      {
-        return return_type::ERROR;
-      }
+      joint_command_accessors_[i][j] = get_command_accessor(command->get_name());
     }
-    if (custom_interface_with_following_offset_ == joint_state.get()->get_interface_name())
+  }
+
+  if (!calculate_dynamics_)
+  {
+    for (size_t j = 0; j < number_of_joints; ++j)
     {
-      const auto cmd =
-        get_command(
-          joint_state.get()->get_prefix_name() + "/" + hardware_interface::HW_IF_POSITION) +
-        position_state_following_offset_;
-      set_state(full_interface_name, cmd);
+      const auto & command = joint_command_accessors_[POSITION_INTERFACE_INDEX][j];
+      const auto & state = joint_state_accessors_[POSITION_INTERFACE_INDEX][j];
+      if (command.is_valid() && state.is_valid())
+      {
+        position_loopbacks_.push_back({command, state});
+      }
     }
   }
 
-  // Update mimic joints
-  const auto & joints = get_hardware_info().joints;
-  for (const auto & mimic_joint : get_hardware_info().mimic_joints)
+  for (const auto & state : joint_states_)
   {
-    const auto & mimic_joint_name = joints.at(mimic_joint.joint_index).name;
-    const auto & mimicked_joint_name = joints.at(mimic_joint.mimicked_joint_index).name;
-    if (has_state(mimic_joint_name + "/" + hardware_interface::HW_IF_POSITION))
+    if (
+      std::find(skip_interfaces_.begin(), skip_interfaces_.end(), state->get_interface_name()) !=
+      skip_interfaces_.end())
     {
-      set_state(
-        mimic_joint_name + "/" + hardware_interface::HW_IF_POSITION,
-        mimic_joint.offset +
-          mimic_joint.multiplier *
-            get_state(mimicked_joint_name + "/" + hardware_interface::HW_IF_POSITION));
+      continue;
     }
-    if (has_state(mimic_joint_name + "/" + hardware_interface::HW_IF_VELOCITY))
+    if (has_command(state->get_name()))
     {
-      set_state(
-        mimic_joint_name + "/" + hardware_interface::HW_IF_VELOCITY,
-        mimic_joint.multiplier *
-          get_state(mimicked_joint_name + "/" + hardware_interface::HW_IF_VELOCITY));
+      add_loopback(state, joint_loopbacks_);
     }
-    if (has_state(mimic_joint_name + "/" + hardware_interface::HW_IF_ACCELERATION))
+    if (custom_interface_with_following_offset_ == state->get_interface_name())
     {
-      set_state(
-        mimic_joint_name + "/" + hardware_interface::HW_IF_ACCELERATION,
-        mimic_joint.multiplier *
-          get_state(mimicked_joint_name + "/" + hardware_interface::HW_IF_ACCELERATION));
+      const auto joint_it = joint_indices.find(state->get_prefix_name());
+      if (
+        joint_it == joint_indices.end() || state->is_array() ||
+        state->get_data_type() != hardware_interface::HandleDataType::DOUBLE ||
+        !joint_command_accessors_[POSITION_INTERFACE_INDEX][joint_it->second].is_valid())
+      {
+        RCLCPP_WARN(
+          get_logger(),
+          "Custom interface with following offset '%s' needs a position command interface and "
+          "the data type double. Offset will not be applied",
+          state->get_name().c_str());
+        continue;
+      }
+      custom_interface_loopbacks_.push_back(
+        {joint_command_accessors_[POSITION_INTERFACE_INDEX][joint_it->second],
+         get_state_accessor(state->get_name())});
+    }
+  }
+
+  for (const auto & mimic_joint : info.mimic_joints)
+  {
+    for (size_t i = 0; i < 3; ++i)
+    {
+      const auto & mimic = joint_state_accessors_[i].at(mimic_joint.joint_index);
+      const auto & mimicked = joint_state_accessors_[i].at(mimic_joint.mimicked_joint_index);
+      if (!mimic.is_valid())
+      {
+        continue;
+      }
+      if (!mimicked.is_valid())
+      {
+        RCLCPP_WARN(
+          get_logger(), "Mimic joint '%s' has no mimicked state interface '%s/%s'",
+          info.joints[mimic_joint.joint_index].name.c_str(),
+          info.joints[mimic_joint.mimicked_joint_index].name.c_str(),
+          standard_interfaces_[i].c_str());
+        continue;
+      }
+      mimic_interfaces_.push_back(
+        {mimic, mimicked, i == POSITION_INTERFACE_INDEX, mimic_joint.offset,
+         mimic_joint.multiplier});
     }
   }
 
@@ -562,47 +602,165 @@ return_type GenericSystem::read(const rclcpp::Time & /*time*/, const rclcpp::Dur
     // do loopback on all sensor interfaces as we have exported them all
     for (const auto & sensor_state : sensor_states_)
     {
-      const std::string & name = sensor_state.get()->get_name();
-      if (mirror_command_to_state(name, sensor_state.get()->get_data_type()) != return_type::OK)
-      {
-        return return_type::ERROR;
-      }
+      add_loopback(sensor_state, component_loopbacks_);
+    }
+  }
+  // do loopback on all gpio interfaces, where they exist. With mock gpio commands, the commands
+  // are created for all state interfaces, but in unlisted_commands_
+  for (const auto & gpio_state : gpio_states_)
+  {
+    if (has_command(gpio_state->get_name()))
+    {
+      add_loopback(gpio_state, component_loopbacks_);
     }
   }
+  interfaces_resolved_ = true;
+}
 
-  if (use_mock_gpio_command_interfaces_)
+template <typename T>
+GenericSystem::Loopback GenericSystem::make_loopback(const std::string & name) const
+{
+  return ScalarLoopback<T>{get_command_accessor<T>(name), get_state_accessor<T>(name)};
+}
+
+template <typename T>
+GenericSystem::ArrayLoopbackVariant GenericSystem::make_array_loopback(
+  const std::string & name, size_t size) const
+{
+  ArrayLoopback<T> loopback{
+    get_command_array_accessor<T>(name), get_state_array_accessor<T>(name),
+    std::make_unique<T[]>(size)};
+  if (loopback.command.size() != size)
   {
-    // do loopback on all gpio interfaces as we have exported them all
-    // commands are created for all state interfaces, but in unlisted_commands_
-    for (const auto & gpio_state : gpio_states_)
+    throw std::runtime_error(
+      fmt::format(
+        FMT_COMPILE("The command interface has the size {} instead of {}"),
+        loopback.command.size(), size));
+  }
+  return loopback;
+}
+
+void GenericSystem::add_loopback(
+  const hardware_interface::StateInterface::SharedPtr & state,
+  InterfaceLoopbacks & loopbacks) const
+{
+  const std::string & name = state->get_name();
+  try
+  {
+    if (state->is_array())
     {
-      const std::string & name = gpio_state.get()->get_name();
-      if (mirror_command_to_state(name, gpio_state.get()->get_data_type()) != return_type::OK)
+      const size_t size = state->get_size();
+      switch (state->get_data_type())
       {
-        return return_type::ERROR;
+        case hardware_interface::HandleDataType::DOUBLE:
+          loopbacks.arrays.push_back(make_array_loopback<double>(name, size));
+          break;
+        case hardware_interface::HandleDataType::BOOL:
+          loopbacks.arrays.push_back(make_array_loopback<bool>(name, size));
+          break;
+        case hardware_interface::HandleDataType::FLOAT:
+          loopbacks.arrays.push_back(make_array_loopback<float>(name, size));
+          break;
+        case hardware_interface::HandleDataType::INT32:
+          loopbacks.arrays.push_back(make_array_loopback<int32_t>(name, size));
+          break;
+        case hardware_interface::HandleDataType::INT64:
+          loopbacks.arrays.push_back(make_array_loopback<int64_t>(name, size));
+          break;
+        case hardware_interface::HandleDataType::UINT8:
+          loopbacks.arrays.push_back(make_array_loopback<uint8_t>(name, size));
+          break;
+        case hardware_interface::HandleDataType::UINT16:
+          loopbacks.arrays.push_back(make_array_loopback<uint16_t>(name, size));
+          break;
+        default:
+          // not handling other types
+          break;
       }
+      return;
+    }
+    switch (state->get_data_type())
+    {
+      case hardware_interface::HandleDataType::DOUBLE:
+        loopbacks.scalars.push_back(make_loopback<double>(name));
+        break;
+      case hardware_interface::HandleDataType::BOOL:
+        loopbacks.scalars.push_back(make_loopback<bool>(name));
+        break;
+      case hardware_interface::HandleDataType::FLOAT:
+        loopbacks.scalars.push_back(make_loopback<float>(name));
+        break;
+      case hardware_interface::HandleDataType::INT32:
+        loopbacks.scalars.push_back(make_loopback<int32_t>(name));
+        break;
+      case hardware_interface::HandleDataType::INT64:
+        loopbacks.scalars.push_back(make_loopback<int64_t>(name));
+        break;
+      case hardware_interface::HandleDataType::UINT8:
+        loopbacks.scalars.push_back(make_loopback<uint8_t>(name));
+        break;
+      case hardware_interface::HandleDataType::UINT16:
+        loopbacks.scalars.push_back(make_loopback<uint16_t>(name));
+        break;
+      default:
+        // not handling other types
+        break;
     }
   }
-  else
+  catch (const std::runtime_error & e)
   {
-    // do loopback on all gpio interfaces, where they exist
-    for (const auto & gpio_command : gpio_commands_)
-    {
-      const std::string & name = gpio_command.get()->get_name();
-      if (has_state(name))
+    RCLCPP_WARN(
+      get_logger(), "Command of interface '%s' is not mirrored to its state: %s", name.c_str(),
+      e.what());
+  }
+}
+
+return_type GenericSystem::mirror_loopbacks(InterfaceLoopbacks & loopbacks)
+{
+  for (auto & loopback : loopbacks.scalars)
+  {
+    const bool mirrored = std::visit(
+      [](auto & scalar_loopback)
       {
-        if (mirror_command_to_state(name, gpio_command.get()->get_data_type()) != return_type::OK)
+        const auto cmd = scalar_loopback.command.get();
+        if constexpr (std::is_floating_point_v<std::decay_t<decltype(cmd)>>)
         {
-          return return_type::ERROR;
+          if (std::isinf(cmd))
+          {
+            return false;
+          }
+          if (std::isnan(cmd))
+          {
+            // NaN - do nothing. Command might not be set yet
+            return true;
+          }
         }
-      }
+        scalar_loopback.state.set(cmd);
+        return true;
+      },
+      loopback);
+    if (!mirrored)
+    {
+      return return_type::ERROR;
     }
   }
 
+  for (auto & loopback : loopbacks.arrays)
+  {
+    std::visit(
+      [](auto & array_loopback)
+      {
+        using T = typename std::decay_t<decltype(array_loopback)>::value_type;
+        const hardware_interface::Span<T> values(
+          array_loopback.values.get(), array_loopback.state.size());
+        array_loopback.command.get(values);
+        array_loopback.state.set(values);
+      },
+      loopback);
+  }
   return return_type::OK;
 }
 
-// Private methods
 bool GenericSystem::populate_interfaces(
   const std::vector<hardware_interface::ComponentInfo> & components,
   std::vector<hardware_interface::InterfaceDescription> & command_interface_descriptions) const
@@ -0,0 +1,55 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "mock_components/load_generator_system.hpp"
+
+#include <stdexcept>
+
+namespace mock_components
+{
+CallbackReturn LoadGeneratorSystem::on_init(
+  const hardware_interface::HardwareComponentInterfaceParams & params)
+{
+  if (GenericSystem::on_init(params) != CallbackReturn::SUCCESS)
+  {
+    return CallbackReturn::ERROR;
+  }
+
+  try
+  {
+    load_ = SyntheticLoad(parse_synthetic_load_parameters(get_hardware_info().hardware_parameters));
+  }
+  catch (const std::invalid_argument & e)
+  {
+    RCLCPP_ERROR(get_logger(), "Invalid synthetic load: %s", e.what());
+    return CallbackReturn::ERROR;
+  }
+  return CallbackReturn::SUCCESS;
+}
+
+return_type LoadGeneratorSystem::read(const rclcpp::Time & time, const rclcpp::Duration & period)
+{
+  if (GenericSystem::read(time, period) != return_type::OK)
+  {
+    return return_type::ERROR;
+  }
+  // the resource manager reports the failure like an error of real hardware
+  return load_.run_cycle() ? return_type::OK : return_type::ERROR;
+}
+
+}  // namespace mock_components
+
+#include "pluginlib/class_list_macros.hpp"
+
+PLUGINLIB_EXPORT_CLASS(mock_components::LoadGeneratorSystem, hardware_interface::SystemInterface)
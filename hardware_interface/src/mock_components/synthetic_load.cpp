@@ -0,0 +1,184 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "mock_components/synthetic_load.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include "fmt/compile.h"
+#include "fmt/format.h"
+#include "hardware_interface/lexical_casts.hpp"
+
+namespace mock_components
+{
+namespace
+{
+// size of a cache line on all platforms we run on, the memory is touched once per line
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+std::chrono::nanoseconds to_nanoseconds(double microseconds)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::duration<double, std::micro>(microseconds));
+}
+
+double parse_non_negative(const std::string & name, const std::string & value)
+{
+  const double parsed = hardware_interface::stod(value);
+  if (!std::isfinite(parsed) || parsed < 0.0)
+  {
+    throw std::invalid_argument(
+      fmt::format(FMT_COMPILE("Parameter '{}' has to be non-negative, got '{}'."), name, value));
+  }
+  return parsed;
+}
+}  // namespace
+
+JitterDistribution parse_jitter_distribution(const std::string & distribution)
+{
+  const std::string lower_case = hardware_interface::to_lower_case(distribution);
+  if (lower_case == "none" || lower_case.empty())
+  {
+    return JitterDistribution::NONE;
+  }
+  if (lower_case == "uniform")
+  {
+    return JitterDistribution::UNIFORM;
+  }
+  if (lower_case == "normal")
+  {
+    return JitterDistribution::NORMAL;
+  }
+  if (lower_case == "exponential")
+  {
+    return JitterDistribution::EXPONENTIAL;
+  }
+  throw std::invalid_argument(
+    fmt::format(
+      FMT_COMPILE(
+        "Unknown jitter distribution '{}', expected 'none', 'uniform', 'normal' or 'exponential'."),
+      distribution));
+}
+
+SyntheticLoadParameters parse_synthetic_load_parameters(
+  const std::unordered_map<std::string, std::string> & parameters)
+{
+  SyntheticLoadParameters load;
+  auto it = parameters.find("cpu_time_us");
+  if (it != parameters.end())
+  {
+    load.cpu_time = to_nanoseconds(parse_non_negative(it->first, it->second));
+  }
+  it = parameters.find("memory_footprint_bytes");
+  if (it != parameters.end())
+  {
+    load.memory_footprint = hardware_interface::parse_integer<size_t>(it->second);
+  }
+  it = parameters.find("cache_footprint_bytes");
+  if (it != parameters.end())
+  {
+    load.cache_footprint = hardware_interface::parse_integer<size_t>(it->second);
+  }
+  it = parameters.find("jitter_distribution");
+  if (it != parameters.end())
+  {
+    load.jitter_distribution = parse_jitter_distribution(it->second);
+  }
+  it = parameters.find("jitter_us");
+  if (it != parameters.end())
+  {
+    load.jitter = to_nanoseconds(parse_non_negative(it->first, it->second));
+  }
+  it = parameters.find("failure_rate");
+  if (it != parameters.end())
+  {
+    load.failure_rate = parse_non_negative(it->first, it->second);
+  }
+  it = parameters.find("seed");
+  if (it != parameters.end())
+  {
+    load.seed = hardware_interface::parse_integer<uint32_t>(it->second);
+  }
+  return load;
+}
+
+SyntheticLoad::SyntheticLoad(const SyntheticLoadParameters & parameters)
+: parameters_(parameters), random_engine_(parameters.seed)
+{
+  if (parameters_.cpu_time.count() < 0 || parameters_.jitter.count() < 0)
+  {
+    throw std::invalid_argument("The cpu time and jitter of a synthetic load can't be negative.");
+  }
+  if (!(parameters_.failure_rate >= 0.0 && parameters_.failure_rate <= 1.0))
+  {
+    throw std::invalid_argument(
+      fmt::format(
+        FMT_COMPILE("The failure rate of a synthetic load has to be between 0 and 1, got {}."),
+        parameters_.failure_rate));
+  }
+  failure_distribution_ = std::bernoulli_distribution(parameters_.failure_rate);
+  // writing the memory once makes the pages resident before the realtime loop starts
+  memory_.assign(std::max(parameters_.memory_footprint, parameters_.cache_footprint), 0);
+}
+
+std::chrono::nanoseconds SyntheticLoad::sample_jitter()
+{
+  const double scale = static_cast<double>(parameters_.jitter.count());
+  double jitter = 0.0;
+  switch (parameters_.jitter_distribution)
+  {
+    case JitterDistribution::UNIFORM:
+      jitter = scale * uniform_distribution_(random_engine_);
+      break;
+    case JitterDistribution::NORMAL:
+      jitter = scale * normal_distribution_(random_engine_);
+      break;
+    case JitterDistribution::EXPONENTIAL:
+      jitter = scale * exponential_distribution_(random_engine_);
+      break;
+    case JitterDistribution::NONE:
+      break;
+  }
+  return std::chrono::nanoseconds(static_cast<int64_t>(jitter));
+}
+
+bool SyntheticLoad::run_cycle()
+{
+  const auto start_time = std::chrono::steady_clock::now();
+  // a negative jitter of the normal distribution makes the cycle shorter, but never negative
+  const auto busy_time =
+    std::max(parameters_.cpu_time + sample_jitter(), std::chrono::nanoseconds(0));
+
+  // read and write each cache line of the working set, as a controller iterating over its data
+  for (size_t i = 0; i < parameters_.cache_footprint; i += CACHE_LINE_SIZE)
+  {
+    memory_[i] = static_cast<uint8_t>(memory_[i] + 1);
+  }
+
+  const auto end_time = start_time + busy_time;
+  while (std::chrono::steady_clock::now() < end_time)
+  {
+  }
+
+  last_cycle_time_ = std::chrono::steady_clock::now() - start_time;
+  return !failure_distribution_(random_engine_);
+}
+
+}  // namespace mock_components
@@ -0,0 +1,130 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/multi_rate_scheduler.hpp"
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace hardware_interface
+{
+double MultiRateSchedule::get_peak_load() const
+{
+  return load_profile.empty() ? 0.0 : *std::max_element(load_profile.begin(), load_profile.end());
+}
+
+double MultiRateSchedule::get_average_load() const
+{
+  return load_profile.empty()
+           ? 0.0
+           : std::accumulate(load_profile.begin(), load_profile.end(), 0.0) /
+               static_cast<double>(load_profile.size());
+}
+
+unsigned int to_tick_divisor(unsigned int update_rate, unsigned int rate)
+{
+  if (rate == 0 || rate >= update_rate)
+  {
+    return 1u;
+  }
+  // round(update_rate / rate) with ties to the smaller divisor
+  const uint64_t divisor = (2u * static_cast<uint64_t>(update_rate) + rate - 1u) / (2u * rate);
+  return std::max(1u, static_cast<unsigned int>(divisor));
+}
+
+MultiRateSchedule compute_multi_rate_schedule(
+  unsigned int update_rate, const std::vector<unsigned int> & rates,
+  const std::vector<double> & weights)
+{
+  if (update_rate == 0)
+  {
+    throw std::invalid_argument("The update rate of a multi-rate schedule has to be positive.");
+  }
+  if (!weights.empty() && weights.size() != rates.size())
+  {
+    throw std::invalid_argument(fmt::format(
+      FMT_COMPILE("Got {} weights for the multi-rate schedule of {} tasks."), weights.size(),
+      rates.size()));
+  }
+
+  MultiRateSchedule schedule;
+  schedule.tasks.resize(rates.size());
+  size_t hyperperiod = 1u;
+  for (size_t i = 0; i < rates.size(); ++i)
+  {
+    schedule.tasks[i].divisor = to_tick_divisor(update_rate, rates[i]);
+    hyperperiod =
+      std::min(kMaxHyperperiod, std::lcm(hyperperiod, size_t{schedule.tasks[i].divisor}));
+  }
+  if (rates.empty())
+  {
+    return schedule;
+  }
+  for (const auto & task : schedule.tasks)
+  {
+    hyperperiod = std::max(hyperperiod, size_t{task.divisor});
+  }
+  schedule.load_profile.assign(hyperperiod, 0.0);
+  const auto weight = [&weights](size_t task) { return weights.empty() ? 1.0 : weights[task]; };
+
+  // the most frequent tasks have the fewest phases to choose from, so they are placed first
+  std::vector<size_t> order(rates.size());
+  std::iota(order.begin(), order.end(), 0u);
+  std::stable_sort(
+    order.begin(), order.end(),
+    [&schedule, &weight](size_t lhs, size_t rhs)
+    {
+      if (schedule.tasks[lhs].divisor != schedule.tasks[rhs].divisor)
+      {
+        return schedule.tasks[lhs].divisor < schedule.tasks[rhs].divisor;
+      }
+      return weight(lhs) > weight(rhs);
+    });
+
+  for (const auto task_index : order)
+  {
+    auto & task = schedule.tasks[task_index];
+    double best_peak = std::numeric_limits<double>::infinity();
+    double best_sum = std::numeric_limits<double>::infinity();
+    for (unsigned int phase = 0; phase < task.divisor; ++phase)
+    {
+      double peak = 0.0;
+      double sum = 0.0;
+      for (size_t tick = phase; tick < hyperperiod; tick += task.divisor)
+      {
+        peak = std::max(peak, schedule.load_profile[tick]);
+        sum += schedule.load_profile[tick];
+      }
+      if (peak < best_peak || (peak == best_peak && sum < best_sum))
+      {
+        best_peak = peak;
+        best_sum = sum;
+        task.phase = phase;
+      }
+    }
+    for (size_t tick = task.phase; tick < hyperperiod; tick += task.divisor)
+    {
+      schedule.load_profile[tick] += weight(task_index);
+    }
+  }
+  return schedule;
+}
+
+}  // namespace hardware_interface
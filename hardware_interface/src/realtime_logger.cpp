@@ -0,0 +1,227 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/realtime_logger.hpp"
+
+#include <fmt/args.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <string>
+
+#include "rclcpp/logging.hpp"
+
+namespace hardware_interface
+{
+namespace
+{
+size_t next_power_of_two(size_t value)
+{
+  size_t result = 1u;
+  while (result < value)
+  {
+    result <<= 1u;
+  }
+  return result;
+}
+}  // namespace
+
+RealtimeLogger::RealtimeLogger(
+  const rclcpp::Logger & logger, size_t capacity, std::chrono::milliseconds drain_period)
+: logger_(logger),
+  records_(std::make_unique<Record[]>(next_power_of_two(std::max<size_t>(capacity, 2u)))),
+  mask_(next_power_of_two(std::max<size_t>(capacity, 2u)) - 1u),
+  drain_period_(drain_period)
+{
+  for (size_t i = 0; i <= mask_; ++i)
+  {
+    records_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  drain_thread_ = std::thread(&RealtimeLogger::drain_loop, this);
+}
+
+RealtimeLogger::~RealtimeLogger()
+{
+  {
+    std::lock_guard<std::mutex> guard(drain_thread_mutex_);
+    stop_drain_thread_ = true;
+  }
+  drain_thread_cv_.notify_one();
+  if (drain_thread_.joinable())
+  {
+    drain_thread_.join();
+  }
+  drain();
+}
+
+bool RealtimeLogger::throttle(
+  std::chrono::steady_clock::time_point & last_time, std::chrono::milliseconds period)
+{
+  const auto now = std::chrono::steady_clock::now();
+  if (now - last_time < period)
+  {
+    return false;
+  }
+  last_time = now;
+  return true;
+}
+
+RealtimeLogger::Record * RealtimeLogger::acquire_record()
+{
+  size_t position = write_position_.load(std::memory_order_relaxed);
+  while (true)
+  {
+    Record & record = records_[position & mask_];
+    const size_t sequence = record.sequence.load(std::memory_order_acquire);
+    const auto difference =
+      static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+    if (difference == 0)
+    {
+      if (write_position_.compare_exchange_weak(
+            position, position + 1, std::memory_order_relaxed))
+      {
+        return &record;
+      }
+    }
+    else if (difference < 0)
+    {
+      // the record still holds a message that was not drained, the buffer is full
+      return nullptr;
+    }
+    else
+    {
+      position = write_position_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+void RealtimeLogger::commit_record(Record & record)
+{
+  // the sequence of an acquired record equals its position, mark it as readable
+  record.sequence.store(
+    record.sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void RealtimeLogger::add_string_argument(Record & record, const char * str, size_t length)
+{
+  auto & argument = record.arguments[record.number_of_arguments++];
+  argument.type = Argument::Type::STRING;
+  // truncate the string if it doesn't fit anymore
+  length = std::min(length, kStringArgumentsCapacity - record.strings_size);
+  if (length > 0u)
+  {
+    std::memcpy(record.strings.data() + record.strings_size, str, length);
+  }
+  argument.string.offset = static_cast<uint16_t>(record.strings_size);
+  argument.string.length = static_cast<uint16_t>(length);
+  record.strings_size += length;
+}
+
+size_t RealtimeLogger::drain()
+{
+  std::lock_guard<std::mutex> guard(drain_mutex_);
+  size_t written_messages = 0;
+  while (true)
+  {
+    Record & record = records_[read_position_ & mask_];
+    if (record.sequence.load(std::memory_order_acquire) != read_position_ + 1)
+    {
+      // empty, or the next message is still being written
+      break;
+    }
+    format_and_write(record);
+    // release the record for the position one lap ahead
+    record.sequence.store(read_position_ + mask_ + 1, std::memory_order_release);
+    ++read_position_;
+    ++written_messages;
+  }
+
+  const size_t dropped_messages = dropped_messages_.load();
+  if (dropped_messages != reported_dropped_messages_)
+  {
+    RCLCPP_WARN(
+      logger_, "%zu real-time log messages were dropped as the buffer was full (%zu in total)",
+      dropped_messages - reported_dropped_messages_, dropped_messages);
+    reported_dropped_messages_ = dropped_messages;
+  }
+  return written_messages;
+}
+
+void RealtimeLogger::format_and_write(const Record & record) const
+{
+  std::string message;
+  try
+  {
+    fmt::dynamic_format_arg_store<fmt::format_context> store;
+    for (size_t i = 0; i < record.number_of_arguments; ++i)
+    {
+      const auto & argument = record.arguments[i];
+      switch (argument.type)
+      {
+        case Argument::Type::INTEGER:
+          store.push_back(argument.integer);
+          break;
+        case Argument::Type::UNSIGNED_INTEGER:
+          store.push_back(argument.unsigned_integer);
+          break;
+        case Argument::Type::FLOATING_POINT:
+          store.push_back(argument.floating_point);
+          break;
+        case Argument::Type::STRING:
+          store.push_back(fmt::string_view(
+            record.strings.data() + argument.string.offset, argument.string.length));
+          break;
+      }
+    }
+    message = fmt::vformat(record.format, store);
+  }
+  catch (const std::exception & e)
+  {
+    message =
+      fmt::format("Failed to format real-time log message '{}': {}", record.format, e.what());
+  }
+
+  switch (record.severity)
+  {
+    case RCUTILS_LOG_SEVERITY_DEBUG:
+      RCLCPP_DEBUG(logger_, "%s", message.c_str());
+      break;
+    case RCUTILS_LOG_SEVERITY_WARN:
+      RCLCPP_WARN(logger_, "%s", message.c_str());
+      break;
+    case RCUTILS_LOG_SEVERITY_ERROR:
+      RCLCPP_ERROR(logger_, "%s", message.c_str());
+      break;
+    case RCUTILS_LOG_SEVERITY_FATAL:
+      RCLCPP_FATAL(logger_, "%s", message.c_str());
+      break;
+    default:
+      RCLCPP_INFO(logger_, "%s", message.c_str());
+      break;
+  }
+}
+
+void RealtimeLogger::drain_loop()
+{
+  std::unique_lock<std::mutex> lock(drain_thread_mutex_);
+  while (!stop_drain_thread_)
+  {
+    lock.unlock();
+    drain();
+    lock.lock();
+    drain_thread_cv_.wait_for(lock, drain_period_, [this] { return stop_drain_thread_; });
+  }
+}
+
+}  // namespace hardware_interface
@@ -0,0 +1,228 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/realtime_memory.hpp"
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <alloca.h>
+#endif
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+namespace hardware_interface
+{
+namespace
+{
+constexpr size_t kPageSize = 4096;
+// kept free below the touched part of the stack for signal handlers and called functions
+constexpr size_t kStackSafetyMargin = 64 * 1024;
+constexpr uint64_t kOffsetMask = 0xFFFFFFFFu;
+constexpr uint64_t kTagIncrement = uint64_t{1} << 32;
+
+/// Link of a freed block to the next free block of its size class, stored in the block itself.
+struct FreeBlock
+{
+  /// Offset + 1 of the next free block, 0 for the end of the list
+  std::atomic<uint32_t> next;
+};
+
+/// Index of the size class of an allocation, or kNumSizeClasses if it is too large.
+size_t get_size_class(size_t bytes, size_t alignment, size_t num_size_classes)
+{
+  const size_t size = std::max({bytes, alignment, RealtimeMemoryArena::kMinBlockSize});
+  size_t size_class = 0;
+  for (size_t block_size = RealtimeMemoryArena::kMinBlockSize; block_size < size; block_size <<= 1u)
+  {
+    if (++size_class == num_size_classes)
+    {
+      break;
+    }
+  }
+  return size_class;
+}
+
+size_t get_block_size(size_t size_class)
+{
+  return RealtimeMemoryArena::kMinBlockSize << size_class;
+}
+}  // namespace
+
+RealtimeMemoryArena::RealtimeMemoryArena(size_t capacity) : buffer_(nullptr), capacity_(capacity)
+{
+  if (capacity == 0 || capacity >= std::numeric_limits<uint32_t>::max())
+  {
+    throw std::invalid_argument(
+      fmt::format(
+        FMT_COMPILE("The capacity of the real-time memory arena has to be between 1 and {} bytes, "
+                    "got {} bytes."),
+        std::numeric_limits<uint32_t>::max() - 1, capacity));
+  }
+  buffer_ = static_cast<std::byte *>(::operator new(capacity_, std::align_val_t(kPageSize)));
+  // write every byte, so that all pages are mapped before the real-time loop uses them
+  std::memset(buffer_, 0, capacity_);
+}
+
+RealtimeMemoryArena::~RealtimeMemoryArena()
+{
+  ::operator delete(buffer_, std::align_val_t(kPageSize));
+}
+
+RealtimeMemoryArenaStatistics RealtimeMemoryArena::get_statistics() const
+{
+  RealtimeMemoryArenaStatistics statistics;
+  statistics.capacity = capacity_;
+  statistics.used_bytes = used_bytes_.load(std::memory_order_relaxed);
+  statistics.high_water_mark = high_water_mark_.load(std::memory_order_relaxed);
+  statistics.failed_allocations = failed_allocations_.load(std::memory_order_relaxed);
+  return statistics;
+}
+
+void * RealtimeMemoryArena::do_allocate(size_t bytes, size_t alignment)
+{
+  const size_t size_class = get_size_class(bytes, alignment, kNumSizeClasses);
+  if (alignment > kMaxAlignment || size_class >= kNumSizeClasses)
+  {
+    failed_allocations_.fetch_add(1, std::memory_order_relaxed);
+    throw std::bad_alloc();
+  }
+
+  void * block = nullptr;
+  auto & free_list = free_lists_[size_class];
+  uint64_t head = free_list.load(std::memory_order_acquire);
+  while ((head & kOffsetMask) != 0u)
+  {
+    const size_t offset = static_cast<size_t>(head & kOffsetMask) - 1u;
+    const uint32_t next =
+      reinterpret_cast<FreeBlock *>(buffer_ + offset)->next.load(std::memory_order_relaxed);
+    // the tag changes with every push and pop, so that a concurrent pop and push of the same block
+    // fails the exchange
+    const uint64_t new_head = ((head & ~kOffsetMask) + kTagIncrement) | next;
+    if (free_list.compare_exchange_weak(
+          head, new_head, std::memory_order_acq_rel, std::memory_order_acquire))
+    {
+      block = buffer_ + offset;
+      break;
+    }
+  }
+  if (!block)
+  {
+    block = carve_block(size_class);
+  }
+  if (!block)
+  {
+    failed_allocations_.fetch_add(1, std::memory_order_relaxed);
+    throw std::bad_alloc();
+  }
+
+  const size_t used_bytes =
+    used_bytes_.fetch_add(get_block_size(size_class), std::memory_order_relaxed) +
+    get_block_size(size_class);
+  size_t high_water_mark = high_water_mark_.load(std::memory_order_relaxed);
+  while (used_bytes > high_water_mark &&
+         !high_water_mark_.compare_exchange_weak(
+           high_water_mark, used_bytes, std::memory_order_relaxed))
+  {
+  }
+  return block;
+}
+
+void RealtimeMemoryArena::do_deallocate(void * p, size_t bytes, size_t alignment)
+{
+  const size_t size_class = get_size_class(bytes, alignment, kNumSizeClasses);
+  const auto offset = static_cast<uint64_t>(static_cast<std::byte *>(p) - buffer_);
+  auto * free_block = new (p) FreeBlock{};
+  auto & free_list = free_lists_[size_class];
+  uint64_t head = free_list.load(std::memory_order_relaxed);
+  uint64_t new_head = 0u;
+  do
+  {
+    free_block->next.store(static_cast<uint32_t>(head & kOffsetMask), std::memory_order_relaxed);
+    new_head = ((head & ~kOffsetMask) + kTagIncrement) | (offset + 1u);
+  } while (!free_list.compare_exchange_weak(
+    head, new_head, std::memory_order_release, std::memory_order_relaxed));
+  used_bytes_.fetch_sub(get_block_size(size_class), std::memory_order_relaxed);
+}
+
+bool RealtimeMemoryArena::do_is_equal(const std::pmr::memory_resource & other) const noexcept
+{
+  return this == &other;
+}
+
+void * RealtimeMemoryArena::carve_block(size_t size_class)
+{
+  const size_t block_size = get_block_size(size_class);
+  const size_t alignment = std::min(block_size, kMaxAlignment);
+  size_t offset = next_offset_.load(std::memory_order_relaxed);
+  size_t block_offset = 0u;
+  do
+  {
+    block_offset = (offset + alignment - 1u) & ~(alignment - 1u);
+    if (block_offset + block_size > capacity_)
+    {
+      return nullptr;
+    }
+  } while (!next_offset_.compare_exchange_weak(
+    offset, block_offset + block_size, std::memory_order_relaxed));
+  return buffer_ + block_offset;
+}
+
+size_t prefault_current_thread_stack(size_t size)
+{
+#ifdef __linux__
+  pthread_attr_t attributes;
+  if (pthread_getattr_np(pthread_self(), &attributes) == 0)
+  {
+    void * stack_address = nullptr;
+    size_t stack_size = 0u;
+    pthread_attr_getstack(&attributes, &stack_address, &stack_size);
+    pthread_attr_destroy(&attributes);
+    // the stack grows downwards from the current frame to the lowest address of the stack
+    const auto current_frame = reinterpret_cast<uintptr_t>(&attributes);
+    const auto stack_end = reinterpret_cast<uintptr_t>(stack_address);
+    const size_t available = current_frame > stack_end + kStackSafetyMargin
+                               ? current_frame - stack_end - kStackSafetyMargin
+                               : 0u;
+    size = std::min(size, available);
+  }
+#endif
+  if (size == 0u)
+  {
+    return 0u;
+  }
+#ifdef _WIN32
+  auto * stack = static_cast<volatile unsigned char *>(_alloca(size));
+#else
+  auto * stack = static_cast<volatile unsigned char *>(alloca(size));
+#endif
+  for (size_t i = 0; i < size; i += kPageSize)
+  {
+    stack[i] = 0;
+  }
+  stack[size - 1u] = 0;
+  return size;
+}
+
+}  // namespace hardware_interface
@@ -16,20 +16,28 @@
 
 #include <fmt/compile.h>
 
+#include <atomic>
+#include <chrono>
+#include <deque>
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "hardware_interface/actuator.hpp"
 #include "hardware_interface/actuator_interface.hpp"
+#include "hardware_interface/command_interpolator.hpp"
 #include "hardware_interface/component_parser.hpp"
 #include "hardware_interface/hardware_component_info.hpp"
+#include "hardware_interface/multi_rate_scheduler.hpp"
 #include "hardware_interface/sensor.hpp"
 #include "hardware_interface/sensor_interface.hpp"
 #include "hardware_interface/system.hpp"
@@ -121,6 +129,38 @@ void find_common_hardware_interfaces(
   }
 }
 
+/// Returns true if a command interface of the component sets the `interpolation` parameter.
+bool has_interpolated_command_interface(const HardwareInfo & hardware_info)
+{
+  for (const auto * components :
+       {&hardware_info.joints, &hardware_info.sensors, &hardware_info.gpios})
+  {
+    for (const auto & component : *components)
+    {
+      for (const auto & command_interface : component.command_interfaces)
+      {
+        const auto parameter = command_interface.parameters.find(kCommandInterpolationParameter);
+        if (parameter == command_interface.parameters.end())
+        {
+          continue;
+        }
+        try
+        {
+          if (parse_command_interpolation(parameter->second) != CommandInterpolation::NONE)
+          {
+            return true;
+          }
+        }
+        catch (const std::invalid_argument &)
+        {
+          // reported by the component when its interfaces are exported
+        }
+      }
+    }
+  }
+  return false;
+}
+
 class ResourceStorage
 {
   static constexpr const char * pkg_name = "hardware_interface";
@@ -130,6 +170,8 @@ class ResourceStorage
   static constexpr const char * system_interface_name = "hardware_interface::SystemInterface";
 
 public:
+  struct ComponentSnapshot;
+
   // TODO(VX792): Change this when HW ifs get their own update rate,
   // because the ResourceStorage really shouldn't know about the cm's parameters
   explicit ResourceStorage(
@@ -168,7 +210,7 @@ public:
   template <class HardwareT, class HardwareInterfaceT>
   [[nodiscard]] bool load_hardware(
     const HardwareInfo & hardware_info, pluginlib::ClassLoader<HardwareInterfaceT> & loader,
-    std::vector<HardwareT> & container)
+    std::deque<HardwareT> & container)
   {
     bool is_loaded = false;
     try
@@ -192,6 +234,9 @@ public:
         component_info.rw_rate = hardware_info.rw_rate;
         component_info.plugin_name = hardware_info.hardware_plugin_name;
         component_info.is_async = hardware_info.is_async;
+        component_info.async_cpu_affinity = hardware_info.async_params.cpu_affinity_cores;
+        component_info.async_deadline_scheduling =
+          hardware_info.async_params.deadline_scheduling.is_enabled();
         component_info.read_statistics = std::make_shared<HardwareComponentStatisticsData>();
 
         // if the type of the hardware is sensor then don't initialize the write statistics
@@ -204,6 +249,7 @@ public:
         hw_group_state_.insert(std::make_pair(component_info.group, return_type::OK));
         hardware_used_by_controllers_.insert(
           std::make_pair(component_info.name, std::vector<std::string>()));
+        deferred_component_requests_.try_emplace(component_info.name);
         is_loaded = true;
       }
       else
@@ -1010,7 +1056,7 @@ public:
         {
           const std::string & joint_name = interface->get_prefix_name();
           const rclcpp::Duration desired_period =
-            rclcpp::Duration::from_seconds(1.0 / cm_update_rate_);
+            rclcpp::Duration::from_seconds(1.0 / get_update_rate(get_rate_domain(hw_name)));
           const std::string & interface_name = interface->get_interface_name();
           const std::vector<std::string> supported_interfaces = {
             hardware_interface::HW_IF_POSITION, hardware_interface::HW_IF_VELOCITY,
@@ -1257,6 +1303,10 @@ public:
 
   void clear()
   {
+    // the real-time loop must not use the components anymore before they are destroyed, read and
+    // write skip their cycles until a new snapshot is published
+    replace_component_snapshot(nullptr);
+
     actuators_.clear();
     sensors_.clear();
     systems_.clear();
@@ -1269,17 +1319,151 @@ public:
     available_command_interfaces_.clear();
 
     claimed_command_interface_map_.clear();
+
+    prepared_command_mode_switch_.clear();
+    deferred_component_requests_.clear();
+  }
+
+  /// Builds the snapshot of the currently loaded components and publishes it to the real-time loop
+  /**
+   * Has to be called after components are added, see ComponentSnapshot for their removal.
+   */
+  void publish_component_snapshot()
+  {
+    auto snapshot = std::make_unique<ComponentSnapshot>();
+    snapshot->update_rates.push_back(cm_update_rate_);
+    snapshot->update_rates.insert(
+      snapshot->update_rates.end(), rate_domain_update_rates_.begin(),
+      rate_domain_update_rates_.end());
+    snapshot->stale_state_read_cycles = stale_state_read_cycles_;
+    auto add_entries = [this](auto & components, std::vector<ComponentSnapshot::Entry> & entries)
+    {
+      for (auto & component : components)
+      {
+        // the state update sequences are only summed up in each read if they are checked
+        component.set_stale_state_detection(stale_state_read_cycles_ > 0);
+        const std::string & group_name = component.get_group_name();
+        return_type * group_state = nullptr;
+        if (!group_name.empty())
+        {
+          group_state = &hw_group_state_[group_name];
+        }
+        entries.push_back(
+          {&component, &hardware_info_map_[component.get_name()], group_state,
+           &deferred_component_requests_[component.get_name()], TickSchedule{},
+           get_rate_domain(component.get_name())});
+      }
+    };
+    add_entries(actuators_, snapshot->read_components);
+    add_entries(sensors_, snapshot->read_components);
+    add_entries(systems_, snapshot->read_components);
+    add_entries(actuators_, snapshot->write_components);
+    add_entries(systems_, snapshot->write_components);
+    if (tick_scheduling_)
+    {
+      schedule_components(*snapshot);
+    }
+    replace_component_snapshot(std::move(snapshot));
+  }
+
+  /// Rate domain reading and writing the component, 0 if it is part of the main loop
+  unsigned int get_rate_domain(const std::string & component_name) const
+  {
+    const auto it = hardware_components_rate_domains_.find(component_name);
+    return it == hardware_components_rate_domains_.end() ? 0u : it->second;
+  }
+
+  unsigned int get_update_rate(unsigned int rate_domain) const
+  {
+    return rate_domain == 0 ? cm_update_rate_ : rate_domain_update_rates_.at(rate_domain - 1);
+  }
+
+  /// Assigns the read and write cycles of the components of the snapshot from their rw_rate
+  /**
+   * The components of each rate domain are scheduled separately with the update rate of the
+   * domain. The hardware load profile is the one of the main loop.
+   */
+  void schedule_components(ComponentSnapshot & snapshot)
+  {
+    snapshot.tick_scheduling = true;
+    std::unordered_map<const HardwareComponent *, TickSchedule> schedules;
+    for (unsigned int rate_domain = 0; rate_domain < snapshot.update_rates.size(); ++rate_domain)
+    {
+      std::vector<ComponentSnapshot::Entry *> entries;
+      std::vector<unsigned int> rates;
+      for (auto & entry : snapshot.read_components)
+      {
+        if (entry.rate_domain == rate_domain)
+        {
+          entries.push_back(&entry);
+          rates.push_back(entry.info->rw_rate);
+        }
+      }
+      auto schedule = compute_multi_rate_schedule(snapshot.update_rates[rate_domain], rates);
+      for (size_t i = 0; i < entries.size(); ++i)
+      {
+        entries[i]->schedule = schedule.tasks[i];
+        schedules[entries[i]->component] = schedule.tasks[i];
+      }
+      if (rate_domain == 0)
+      {
+        hardware_load_profile_ = std::move(schedule.load_profile);
+      }
+    }
+    // a component is written in the same cycles as it is read
+    for (auto & entry : snapshot.write_components)
+    {
+      entry.schedule = schedules[entry.component];
+    }
+  }
+
+  /// Replaces the snapshot used by the real-time loop and frees the previous one
+  /**
+   * The previous snapshot is only freed once no read or write cycle uses it anymore. Only the
+   * cycles that started before the snapshot was replaced are waited for, the cycles starting
+   * afterwards register in the other phase of the reader slots. Therefore, the loops of the rate
+   * domains reading and writing continuously can't delay the replacement indefinitely.
+   */
+  void replace_component_snapshot(std::unique_ptr<ComponentSnapshot> snapshot)
+  {
+    std::lock_guard<std::mutex> guard(component_snapshot_writer_mutex_);
+    component_snapshot_ = snapshot.get();
+    const unsigned int phase = component_snapshot_phase_.fetch_add(1) & 1u;
+    auto wait_for_readers = [phase](const ComponentSnapshotReaderSlot & slot)
+    {
+      while (slot.readers[phase] != 0)
+      {
+        std::this_thread::yield();
+      }
+    };
+    wait_for_readers(main_loop_snapshot_reader_slot_);
+    for (const auto & slot : rate_domain_snapshot_reader_slots_)
+    {
+      wait_for_readers(*slot);
+    }
+    published_component_snapshot_ = std::move(snapshot);
+  }
+
+  /// Adds the reader slots of the rate domains, must be called before their loops are started
+  void add_snapshot_reader_slots(size_t rate_domains)
+  {
+    std::lock_guard<std::mutex> guard(component_snapshot_writer_mutex_);
+    while (rate_domain_snapshot_reader_slots_.size() < rate_domains)
+    {
+      rate_domain_snapshot_reader_slots_.push_back(
+        std::make_unique<ComponentSnapshotReaderSlot>());
+    }
   }
 
   /**
    * Returns the return type of the hardware component group state, if the return type is other
    * than OK, then updates the return type of the group to the respective one
    */
-  return_type update_hardware_component_group_state(
-    const std::string & group_name, const return_type & value)
+  static return_type update_hardware_component_group_state(
+    return_type * group_state, const return_type & value)
   {
     // This is for the components that has no configured group
-    if (group_name.empty())
+    if (group_state == nullptr)
     {
       return value;
     }
@@ -1287,9 +1471,9 @@ public:
     // to the respective return type
     if (value != return_type::OK)
     {
-      hw_group_state_.at(group_name) = value;
+      *group_state = value;
     }
-    return hw_group_state_.at(group_name);
+    return *group_state;
   }
 
   /// Gets the logger for the resource storage
@@ -1313,9 +1497,11 @@ public:
   rclcpp::Clock::SharedPtr rm_clock_;
   rclcpp::Logger rm_logger_;
 
-  std::vector<Actuator> actuators_;
-  std::vector<Sensor> sensors_;
-  std::vector<System> systems_;
+  // deque keeps the components in place when new ones are added, as they are referenced by the
+  // component snapshot and the prepared command mode switch
+  std::deque<Actuator> actuators_;
+  std::deque<Sensor> sensors_;
+  std::deque<System> systems_;
 
   std::unordered_map<std::string, HardwareComponentInfo> hardware_info_map_;
   std::unordered_map<std::string, hardware_interface::return_type> hw_group_state_;
@@ -1361,9 +1547,167 @@ public:
   std::vector<std::string> start_interfaces_buffer_;
   std::vector<std::string> stop_interfaces_buffer_;
 
+  /// Command mode switch compiled in prepare_command_mode_switch
+  /**
+   * Holds the components affected by the last accepted prepare call together with their share of
+   * the start and stop interfaces, so that perform_command_mode_switch called with the id of the
+   * prepared switch does not need to filter the interfaces of every component again in the
+   * real-time loop.
+   */
+  struct PreparedCommandModeSwitch
+  {
+    struct ComponentSwitch
+    {
+      HardwareComponent * component = nullptr;
+      /// Actuators and systems are switched as separate groups, see perform_command_mode_switch
+      bool is_actuator = false;
+      std::vector<std::string> start_interfaces;
+      std::vector<std::string> stop_interfaces;
+    };
+
+    bool matches(uint64_t switch_id) const { return id != 0 && switch_id == id; }
+
+    void clear()
+    {
+      id = 0;
+      components.clear();
+    }
+
+    /// Id returned by prepare_command_mode_switch, 0 if no switch is prepared
+    uint64_t id = 0;
+    /// Id of the last prepared switch, incremented by every prepare call
+    uint64_t last_id = 0;
+    std::vector<ComponentSwitch> components;
+  };
+  PreparedCommandModeSwitch prepared_command_mode_switch_;
+
+  /// Requests of the real-time loop executed by the lifecycle worker
+  struct DeferredComponentRequests
+  {
+    /// The component returned DEACTIVATE from write, reset once it is deactivated
+    std::atomic_bool deactivate = false;
+    /// The component failed in read or write, reset once its error transition is executed
+    std::atomic_bool error = false;
+    /// The component failed, but its interfaces could not be removed from the available lists
+    std::atomic_bool remove_interfaces = false;
+
+    /// The component is neither read nor written until the lifecycle worker executed the request
+    bool awaits_transition() const { return deactivate || error; }
+  };
+
+  /// Deferred requests of the components, keyed by the component name
+  /**
+   * The entries are created when the hardware is loaded, so that the real-time loop only sets the
+   * flags through the component snapshot without modifying the map.
+   */
+  std::unordered_map<std::string, DeferredComponentRequests> deferred_component_requests_;
+
+  /// Immutable set of the loaded components used by the real-time loop
+  /**
+   * The set is published with read-copy-update: the non real-time code builds a new snapshot
+   * whenever components are added, publishes it atomically and frees the previous one once no read
+   * or write cycle uses it anymore. Therefore, the real-time loop neither waits for nor skips a
+   * cycle because of components being loaded.
+   *
+   * The entries point into the deques of the components, which are only appended to. Components
+   * are never removed individually, as erasing from a deque would invalidate the entries of the
+   * remaining components. They are only removed all together by clear(), which withdraws the
+   * snapshot before destroying them.
+   */
+  struct ComponentSnapshot
+  {
+    struct Entry
+    {
+      HardwareComponent * component;
+      HardwareComponentInfo * info;
+      /// State of the hardware group of the component, nullptr if it has no group
+      return_type * group_state;
+      DeferredComponentRequests * deferred_requests;
+      /// Read and write cycles of the component if tick scheduling is enabled
+      TickSchedule schedule;
+      /// Rate domain whose thread reads and writes the component
+      unsigned int rate_domain = 0;
+    };
+
+    /// Actuators, sensors and systems, in this order
+    std::vector<Entry> read_components;
+    /// Actuators and systems, in this order
+    std::vector<Entry> write_components;
+    /// Update rates of the rate domains, starting with the one of the controller manager
+    std::vector<unsigned int> update_rates;
+    /// Read cycles without state updates after which a component is stale, 0 if disabled
+    unsigned int stale_state_read_cycles = 0;
+    /// Whether decimated components are read and written in the cycles of their schedule
+    bool tick_scheduling = false;
+  };
+
+  /// Readers of the component snapshot in one real-time loop, in the two phases of replacement
+  struct alignas(64) ComponentSnapshotReaderSlot
+  {
+    std::atomic<int> readers[2] = {0, 0};
+  };
+
+  ComponentSnapshotReaderSlot & get_snapshot_reader_slot(unsigned int rate_domain)
+  {
+    return rate_domain == 0 || rate_domain > rate_domain_snapshot_reader_slots_.size()
+             ? main_loop_snapshot_reader_slot_
+             : *rate_domain_snapshot_reader_slots_[rate_domain - 1];
+  }
+
+  /// Registers a read or write cycle using the component snapshot for its whole lifetime
+  class ComponentSnapshotReader
+  {
+  public:
+    explicit ComponentSnapshotReader(ResourceStorage & storage, unsigned int rate_domain = 0)
+    {
+      auto & slot = storage.get_snapshot_reader_slot(rate_domain);
+      // registering before loading the snapshot ensures that it is not freed while in use, the
+      // registration is repeated if the snapshot was replaced meanwhile
+      while (true)
+      {
+        const unsigned int phase = storage.component_snapshot_phase_;
+        readers_ = &slot.readers[phase & 1u];
+        ++*readers_;
+        if (storage.component_snapshot_phase_ == phase)
+        {
+          break;
+        }
+        --*readers_;
+      }
+      snapshot_ = storage.component_snapshot_;
+    }
+
+    ~ComponentSnapshotReader() { --*readers_; }
+
+    ComponentSnapshotReader(const ComponentSnapshotReader &) = delete;
+    ComponentSnapshotReader & operator=(const ComponentSnapshotReader &) = delete;
+
+    const ComponentSnapshot * get() const { return snapshot_; }
+
+  private:
+    std::atomic<int> * readers_ = nullptr;
+    const ComponentSnapshot * snapshot_ = nullptr;
+  };
+
+  std::atomic<const ComponentSnapshot *> component_snapshot_ = nullptr;
+  /// Incremented by every replacement of the snapshot, its parity selects the readers to register
+  std::atomic<unsigned int> component_snapshot_phase_ = 0;
+  ComponentSnapshotReaderSlot main_loop_snapshot_reader_slot_;
+  std::vector<std::unique_ptr<ComponentSnapshotReaderSlot>> rate_domain_snapshot_reader_slots_;
+  std::mutex component_snapshot_writer_mutex_;
+  // owns the snapshot currently published to the real-time loop
+  std::unique_ptr<ComponentSnapshot> published_component_snapshot_;
+
   // Update rate of the controller manager, and the clock interface of its node
   // Used by async components.
   unsigned int cm_update_rate_ = 100;
+  unsigned int stale_state_read_cycles_ = 0;
+  bool tick_scheduling_ = false;
+  // Rate domains with a dedicated thread of the controller manager, 0 is the main loop
+  std::vector<unsigned int> rate_domain_update_rates_;
+  std::unordered_map<std::string, unsigned int> hardware_components_rate_domains_;
+  // components due per cycle of the last published snapshot, empty without tick scheduling
+  std::vector<double> hardware_load_profile_;
 };
 
 ResourceManager::ResourceManager(
@@ -1379,7 +1723,18 @@ ResourceManager::ResourceManager(rclcpp::Clock::SharedPtr clock, rclcpp::Logger
 {
 }
 
-ResourceManager::~ResourceManager() = default;
+ResourceManager::~ResourceManager()
+{
+  {
+    std::lock_guard<std::mutex> lock(lifecycle_worker_mutex_);
+    lifecycle_worker_stop_ = true;
+  }
+  lifecycle_worker_cv_.notify_all();
+  if (lifecycle_worker_thread_.joinable())
+  {
+    lifecycle_worker_thread_.join();
+  }
+}
 
 ResourceManager::ResourceManager(
   const std::string & urdf, rclcpp::node_interfaces::NodeClockInterface::SharedPtr clock_interface,
@@ -1402,7 +1757,8 @@ ResourceManager::ResourceManager(
 
 ResourceManager::ResourceManager(
   const hardware_interface::ResourceManagerParams & params, bool load)
-: resource_storage_(std::make_unique<ResourceStorage>(params.clock, params.logger))
+: resource_storage_(std::make_unique<ResourceStorage>(params.clock, params.logger)),
+  rt_logger_(std::make_unique<RealtimeLogger>(params.logger))
 {
   RCLCPP_WARN_EXPRESSION(
     params.logger, params.allow_controller_activation_with_inactive_hardware,
@@ -1433,6 +1789,142 @@ ResourceManager::ResourceManager(
       }
     }
   }
+  lifecycle_worker_thread_ = std::thread(&ResourceManager::lifecycle_worker_loop, this);
+}
+
+void ResourceManager::lifecycle_worker_loop()
+{
+  uint64_t processed_generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(lifecycle_worker_mutex_);
+      lifecycle_worker_cv_.wait(
+        lock,
+        [&]()
+        { return lifecycle_worker_stop_ || lifecycle_worker_generation_ != processed_generation; });
+      if (lifecycle_worker_stop_)
+      {
+        break;
+      }
+      processed_generation = lifecycle_worker_generation_;
+    }
+    process_deferred_component_transitions();
+  }
+}
+
+void ResourceManager::process_deferred_component_transitions()
+{
+  std::lock_guard<std::recursive_mutex> deferred_guard(deferred_transitions_lock_);
+  // set_component_state calls this method again, nothing to do in that case
+  if (processing_deferred_transitions_ || !deferred_transitions_requested_.exchange(false))
+  {
+    return;
+  }
+  processing_deferred_transitions_ = true;
+
+  {
+    ResourceStorage::ComponentSnapshotReader snapshot_reader(*resource_storage_);
+    if (const auto * snapshot = snapshot_reader.get())
+    {
+      for (const auto & entry : snapshot->read_components)
+      {
+        if (!entry.deferred_requests->error)
+        {
+          continue;
+        }
+        RCLCPP_INFO(
+          get_logger(), "Executing the error transition of component '%s' after its failed cycle",
+          entry.component->get_name().c_str());
+        entry.component->error();
+        // only now the component is read and written again (if it is still active)
+        entry.deferred_requests->error = false;
+      }
+    }
+  }
+
+  std::vector<std::string> components_to_deactivate;
+  {
+    std::lock_guard<std::recursive_mutex> guard(resources_lock_);
+    for (auto & [component_name, requests] : resource_storage_->deferred_component_requests_)
+    {
+      if (requests.remove_interfaces.exchange(false))
+      {
+        resource_storage_->remove_all_hardware_interfaces_from_available_list(component_name);
+      }
+      if (requests.deactivate)
+      {
+        components_to_deactivate.push_back(component_name);
+      }
+    }
+  }
+
+  for (const auto & component_name : components_to_deactivate)
+  {
+    RCLCPP_INFO(
+      get_logger(), "Deactivating component '%s' as requested from its write cycle",
+      component_name.c_str());
+    rclcpp_lifecycle::State inactive_state(
+      lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, lifecycle_state_names::INACTIVE);
+    if (set_component_state(component_name, inactive_state) != return_type::OK)
+    {
+      RCLCPP_ERROR(
+        get_logger(), "Failed to deactivate component '%s' as requested from its write cycle",
+        component_name.c_str());
+    }
+    // only now the component is read and written again (if it is still active)
+    std::lock_guard<std::recursive_mutex> guard(resources_lock_);
+    auto found_it = resource_storage_->deferred_component_requests_.find(component_name);
+    if (found_it != resource_storage_->deferred_component_requests_.end())
+    {
+      found_it->second.deactivate = false;
+    }
+  }
+  processing_deferred_transitions_ = false;
+}
+
+bool ResourceManager::awaits_deactivation(
+  const std::string & interface_name, bool is_command_interface) const
+{
+  ResourceStorage::ComponentSnapshotReader snapshot_reader(*resource_storage_);
+  const auto * snapshot = snapshot_reader.get();
+  if (!snapshot)
+  {
+    return false;
+  }
+  for (const auto & entry : snapshot->read_components)
+  {
+    if (!entry.deferred_requests->deactivate)
+    {
+      continue;
+    }
+    const auto & interfaces =
+      is_command_interface ? entry.info->command_interfaces : entry.info->state_interfaces;
+    if (std::find(interfaces.begin(), interfaces.end(), interface_name) != interfaces.end())
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ResourceManager::has_pending_component_transitions() const
+{
+  ResourceStorage::ComponentSnapshotReader snapshot_reader(*resource_storage_);
+  const auto * snapshot = snapshot_reader.get();
+  if (!snapshot)
+  {
+    return false;
+  }
+  for (const auto & entry : snapshot->read_components)
+  {
+    const auto & requests = *entry.deferred_requests;
+    if (requests.awaits_transition() || requests.remove_interfaces)
+    {
+      return true;
+    }
+  }
+  return false;
 }
 
 bool ResourceManager::shutdown_components()
@@ -1459,14 +1951,49 @@ bool ResourceManager::load_and_initialize_components(
 
   resource_storage_->robot_description_ = params.robot_description;
   resource_storage_->cm_update_rate_ = params.update_rate;
+  resource_storage_->stale_state_read_cycles_ = params.stale_state_read_cycles;
+  resource_storage_->tick_scheduling_ = params.tick_scheduling;
+  // the threads of the rate domains are only started once the components are loaded
+  rate_domain_cycles_.resize(params.rate_domain_update_rates.size());
+  resource_storage_->add_snapshot_reader_slots(params.rate_domain_update_rates.size());
+  while (rate_domain_joint_limiters_locks_.size() < params.rate_domain_update_rates.size())
+  {
+    rate_domain_joint_limiters_locks_.push_back(std::make_unique<std::recursive_mutex>());
+  }
+  {
+    // the main loop may already enforce the limits of its joints
+    std::lock_guard<std::recursive_mutex> limiters_guard(joint_limiters_lock_);
+    resource_storage_->rate_domain_update_rates_ = params.rate_domain_update_rates;
+    resource_storage_->hardware_components_rate_domains_.clear();
+    for (const auto & [component_name, rate_domain] : params.hardware_components_rate_domains)
+    {
+      if (rate_domain > params.rate_domain_update_rates.size())
+      {
+        RCLCPP_ERROR(
+          get_logger(),
+          "The rate domain %u of the hardware component '%s' doesn't exist, it is read and "
+          "written by the main loop.",
+          rate_domain, component_name.c_str());
+        continue;
+      }
+      resource_storage_->hardware_components_rate_domains_[component_name] = rate_domain;
+    }
+  }
 
   auto hardware_info =
     hardware_interface::parse_control_resources_from_urdf(params.robot_description);
   // Set the update rate for all hardware components
   for (auto & hw : hardware_info)
   {
+    const unsigned int update_rate =
+      resource_storage_->get_update_rate(resource_storage_->get_rate_domain(hw.name));
+    // only the async thread of detached components interpolating their commands runs faster
+    const bool interpolates_commands = hw.is_async &&
+                                       hw.async_params.scheduling_policy == "detached" &&
+                                       has_interpolated_command_interface(hw);
     hw.rw_rate =
-      (hw.rw_rate == 0 || hw.rw_rate > params.update_rate) ? params.update_rate : hw.rw_rate;
+      (hw.rw_rate == 0 || (hw.rw_rate > update_rate && !interpolates_commands)) ? update_rate
+                                                                                 : hw.rw_rate;
   }
 
   const std::string system_type = "system";
@@ -1475,6 +2002,7 @@ bool ResourceManager::load_and_initialize_components(
 
   std::lock_guard<std::recursive_mutex> resource_guard(resources_lock_);
   std::lock_guard<std::recursive_mutex> limiters_guard(joint_limiters_lock_);
+  const auto rate_domain_limiters_guards = lock_rate_domain_joint_limiters();
   for (const auto & individual_hardware_info : hardware_info)
   {
     // Check for identical names
@@ -1528,10 +2056,8 @@ bool ResourceManager::load_and_initialize_components(
 
   if (components_are_loaded_and_initialized_ && validate_storage(hardware_info))
   {
-    std::lock_guard<std::recursive_mutex> guard(resources_lock_);
-    read_write_status.failed_hardware_names.reserve(
-      resource_storage_->actuators_.size() + resource_storage_->sensors_.size() +
-      resource_storage_->systems_.size());
+    // the real-time loop continues with the previous set of components until now
+    resource_storage_->publish_component_snapshot();
   }
   else
   {
@@ -1547,6 +2073,7 @@ bool ResourceManager::load_and_initialize_components(
 void ResourceManager::import_joint_limiters(const std::string & urdf)
 {
   std::lock_guard<std::recursive_mutex> guard(joint_limiters_lock_);
+  const auto rate_domain_limiters_guards = lock_rate_domain_joint_limiters();
   const auto hardware_info = hardware_interface::parse_control_resources_from_urdf(urdf);
   resource_storage_->import_joint_limiters(hardware_info);
 }
@@ -1595,7 +2122,21 @@ bool ResourceManager::state_interface_is_available(const std::string & name) con
   return std::find(
            resource_storage_->available_state_interfaces_.begin(),
            resource_storage_->available_state_interfaces_.end(),
-           name) != resource_storage_->available_state_interfaces_.end();
+           name) != resource_storage_->available_state_interfaces_.end() &&
+         !awaits_deactivation(name, false);
+}
+
+// CM API: Called in "callback/slow"-thread
+bool ResourceManager::enable_state_interface_published_copy(const std::string & name)
+{
+  std::lock_guard<std::recursive_mutex> guard(resource_interfaces_lock_);
+  auto it = resource_storage_->state_interface_map_.find(name);
+  if (it == resource_storage_->state_interface_map_.end())
+  {
+    throw std::runtime_error(
+      fmt::format(FMT_COMPILE("State interface with key '{}' does not exist"), name));
+  }
+  return it->second->enable_published_copy();
 }
 
 std::string ResourceManager::get_state_interface_data_type(const std::string & name) const
@@ -1864,7 +2405,8 @@ bool ResourceManager::command_interface_is_available(const std::string & name) c
   return std::find(
            resource_storage_->available_command_interfaces_.begin(),
            resource_storage_->available_command_interfaces_.end(),
-           name) != resource_storage_->available_command_interfaces_.end();
+           name) != resource_storage_->available_command_interfaces_.end() &&
+         !awaits_deactivation(name, true);
 }
 
 std::string ResourceManager::get_command_interface_data_type(const std::string & name) const
@@ -1887,9 +2429,7 @@ void ResourceManager::import_component(
 {
   std::lock_guard<std::recursive_mutex> guard(resources_lock_);
   resource_storage_->initialize_actuator(std::move(actuator), params);
-  read_write_status.failed_hardware_names.reserve(
-    resource_storage_->actuators_.size() + resource_storage_->sensors_.size() +
-    resource_storage_->systems_.size());
+  resource_storage_->publish_component_snapshot();
 }
 
 void ResourceManager::import_component(
@@ -1897,9 +2437,7 @@ void ResourceManager::import_component(
 {
   std::lock_guard<std::recursive_mutex> guard(resources_lock_);
   resource_storage_->initialize_sensor(std::move(sensor), params);
-  read_write_status.failed_hardware_names.reserve(
-    resource_storage_->actuators_.size() + resource_storage_->sensors_.size() +
-    resource_storage_->systems_.size());
+  resource_storage_->publish_component_snapshot();
 }
 
 void ResourceManager::import_component(
@@ -1907,21 +2445,23 @@ void ResourceManager::import_component(
 {
   std::lock_guard<std::recursive_mutex> guard(resources_lock_);
   resource_storage_->initialize_system(std::move(system), params);
-  read_write_status.failed_hardware_names.reserve(
-    resource_storage_->actuators_.size() + resource_storage_->sensors_.size() +
-    resource_storage_->systems_.size());
+  resource_storage_->publish_component_snapshot();
 }
 
 // CM API: Called in "callback/slow"-thread
 const std::unordered_map<std::string, HardwareComponentInfo> &
 ResourceManager::get_components_status()
 {
+  process_deferred_component_transitions();
+
   auto loop_and_get_state = [&](auto & container)
   {
     for (auto & component : container)
     {
-      resource_storage_->hardware_info_map_[component.get_name()].state =
-        component.get_lifecycle_state();
+      auto & component_info = resource_storage_->hardware_info_map_[component.get_name()];
+      component_info.state = component.get_lifecycle_state();
+      component_info.deadline_overruns = component.get_deadline_overruns();
+      component_info.realtime_memory_arena = component.get_realtime_memory_arena_statistics();
     }
   };
 
@@ -1932,6 +2472,35 @@ ResourceManager::get_components_status()
   return resource_storage_->hardware_info_map_;
 }
 
+// CM API: Called in "callback/slow"-thread
+bool ResourceManager::set_async_component_cpu_affinity(
+  const std::string & component_name, const std::vector<int> & cpus)
+{
+  const auto info_it = resource_storage_->hardware_info_map_.find(component_name);
+  if (info_it == resource_storage_->hardware_info_map_.end() || !info_it->second.is_async)
+  {
+    return false;
+  }
+
+  auto find_and_set_affinity = [&](auto & container)
+  {
+    for (auto & component : container)
+    {
+      if (component.get_name() == component_name)
+      {
+        component.set_async_thread_cpu_affinity(cpus);
+        return true;
+      }
+    }
+    return false;
+  };
+
+  std::lock_guard<std::recursive_mutex> guard(resources_lock_);
+  return find_and_set_affinity(resource_storage_->actuators_) ||
+         find_and_set_affinity(resource_storage_->sensors_) ||
+         find_and_set_affinity(resource_storage_->systems_);
+}
+
 const std::unordered_map<std::string, joint_limits::JointLimits> &
 ResourceManager::get_hard_joint_limits() const
 {
@@ -1949,6 +2518,16 @@ bool ResourceManager::prepare_command_mode_switch(
   const std::vector<std::string> & start_interfaces,
   const std::vector<std::string> & stop_interfaces)
 {
+  uint64_t switch_id = 0;
+  return prepare_command_mode_switch(start_interfaces, stop_interfaces, switch_id);
+}
+
+// CM API: Called in "callback/slow"-thread
+bool ResourceManager::prepare_command_mode_switch(
+  const std::vector<std::string> & start_interfaces,
+  const std::vector<std::string> & stop_interfaces, uint64_t & switch_id)
+{
+  switch_id = 0;
   // When only broadcaster is activated then this lists are empty
   if (start_interfaces.empty() && stop_interfaces.empty())
   {
@@ -2007,9 +2586,13 @@ bool ResourceManager::prepare_command_mode_switch(
     return false;
   }
 
+  auto & prepared_switch = resource_storage_->prepared_command_mode_switch_;
+  prepared_switch.clear();
+
   const auto & hardware_info_map = resource_storage_->hardware_info_map_;
   auto call_prepare_mode_switch =
-    [&start_interfaces, &stop_interfaces, &hardware_info_map, logger = get_logger(),
+    [&start_interfaces, &stop_interfaces, &hardware_info_map, &prepared_switch,
+     logger = get_logger(),
      allow_controller_activation_with_inactive_hardware =
        allow_controller_activation_with_inactive_hardware_](
       auto & components, auto & start_interfaces_buffer, auto & stop_interfaces_buffer)
@@ -2056,6 +2639,12 @@ bool ResourceManager::prepare_command_mode_switch(
               interfaces_to_string(start_interfaces_buffer, stop_interfaces_buffer).c_str());
             ret = false;
           }
+          else
+          {
+            prepared_switch.components.push_back(
+              {&component, std::is_same_v<std::decay_t<decltype(component)>, Actuator>,
+               start_interfaces_buffer, stop_interfaces_buffer});
+          }
         }
         catch (const std::exception & e)
         {
@@ -2097,6 +2686,16 @@ bool ResourceManager::prepare_command_mode_switch(
     resource_storage_->systems_, resource_storage_->start_interfaces_buffer_,
     resource_storage_->stop_interfaces_buffer_);
 
+  if (actuators_result && systems_result)
+  {
+    prepared_switch.id = ++prepared_switch.last_id;
+    switch_id = prepared_switch.id;
+  }
+  else
+  {
+    prepared_switch.clear();
+  }
+
   return actuators_result && systems_result;
 }
 
@@ -2104,6 +2703,14 @@ bool ResourceManager::prepare_command_mode_switch(
 bool ResourceManager::perform_command_mode_switch(
   const std::vector<std::string> & start_interfaces,
   const std::vector<std::string> & stop_interfaces)
+{
+  return perform_command_mode_switch(start_interfaces, stop_interfaces, 0);
+}
+
+// CM API: Called in "update"-thread
+bool ResourceManager::perform_command_mode_switch(
+  const std::vector<std::string> & start_interfaces,
+  const std::vector<std::string> & stop_interfaces, uint64_t switch_id)
 {
   // When only broadcaster is activated then this lists are empty
   if (start_interfaces.empty() && stop_interfaces.empty())
@@ -2111,96 +2718,134 @@ bool ResourceManager::perform_command_mode_switch(
     return true;
   }
 
-  const auto & hardware_info_map = resource_storage_->hardware_info_map_;
-  auto call_perform_mode_switch =
-    [&start_interfaces, &stop_interfaces, &hardware_info_map, logger = get_logger(),
-     allow_controller_activation_with_inactive_hardware =
-       allow_controller_activation_with_inactive_hardware_](
-      auto & components, auto & start_interfaces_buffer, auto & stop_interfaces_buffer)
+  auto call_component_perform_mode_switch =
+    [rt_logger = rt_logger_.get(), allow_controller_activation_with_inactive_hardware =
+                                      allow_controller_activation_with_inactive_hardware_](
+      HardwareComponent & component, const std::vector<std::string> & start_interfaces_buffer,
+      const std::vector<std::string> & stop_interfaces_buffer, bool & abort)
   {
-    bool ret = true;
-    for (auto & component : components)
+    if (
+      !start_interfaces_buffer.empty() &&
+      component.get_lifecycle_state().id() == lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE &&
+      !allow_controller_activation_with_inactive_hardware)
     {
-      const auto & hw_command_itfs = hardware_info_map.at(component.get_name()).command_interfaces;
-      find_common_hardware_interfaces(hw_command_itfs, start_interfaces, start_interfaces_buffer);
-      find_common_hardware_interfaces(hw_command_itfs, stop_interfaces, stop_interfaces_buffer);
-      if (start_interfaces_buffer.empty() && stop_interfaces_buffer.empty())
+      rt_logger->warn(
+        "Component '{}' is in INACTIVE state, but has {} start interfaces to switch",
+        component.get_name(), start_interfaces_buffer.size());
+      abort = true;
+      return false;
+    }
+    if (
+      component.get_lifecycle_state().id() == lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE ||
+      component.get_lifecycle_state().id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+    {
+      try
       {
-        RCLCPP_DEBUG(
-          logger, "Component '%s' after filtering has no command interfaces to perform switch",
-          component.get_name().c_str());
-        continue;
+        if (
+          return_type::OK !=
+          component.perform_command_mode_switch(start_interfaces_buffer, stop_interfaces_buffer))
+        {
+          rt_logger->error(
+            "Component '{}' could not perform switch for {} start and {} stop command interfaces",
+            component.get_name(), start_interfaces_buffer.size(), stop_interfaces_buffer.size());
+          return false;
+        }
       }
-      if (
-        !start_interfaces_buffer.empty() &&
-        component.get_lifecycle_state().id() ==
-          lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE &&
-        !allow_controller_activation_with_inactive_hardware)
+      catch (const std::exception & e)
       {
-        RCLCPP_WARN(
-          logger, "Component '%s' is in INACTIVE state, but has start interfaces to switch: \n%s",
-          component.get_name().c_str(),
-          interfaces_to_string(start_interfaces_buffer, stop_interfaces_buffer).c_str());
+        rt_logger->error(
+          "Exception of type : {} occurred while performing command mode switch for component "
+          "'{}': {}",
+          typeid(e).name(), component.get_name(), e.what());
         return false;
       }
-      if (
-        component.get_lifecycle_state().id() ==
-          lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE ||
-        component.get_lifecycle_state().id() == lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE)
+      catch (...)
       {
-        try
+        rt_logger->error(
+          "Unknown exception occurred while performing command mode switch for component '{}'",
+          component.get_name());
+        return false;
+      }
+    }
+    else
+    {
+      rt_logger->warn(
+        "Component '{}' is not in INACTIVE or ACTIVE state, skipping the perform switch",
+        component.get_name());
+      return false;
+    }
+    return true;
+  };
+
+  bool actuators_result = true;
+  bool systems_result = true;
+  const auto & prepared_switch = resource_storage_->prepared_command_mode_switch_;
+  if (prepared_switch.matches(switch_id))
+  {
+    // The affected components and their interfaces were already resolved when preparing the
+    // switch, only notify them. As below, an abort only skips the remaining components of the
+    // same group.
+    bool actuators_aborted = false;
+    bool systems_aborted = false;
+    for (const auto & component_switch : prepared_switch.components)
+    {
+      bool & group_result = component_switch.is_actuator ? actuators_result : systems_result;
+      bool & group_aborted = component_switch.is_actuator ? actuators_aborted : systems_aborted;
+      if (group_aborted)
+      {
+        continue;
+      }
+      if (!call_component_perform_mode_switch(
+            *component_switch.component, component_switch.start_interfaces,
+            component_switch.stop_interfaces, group_aborted))
+      {
+        group_result = false;
+      }
+    }
+  }
+  else
+  {
+    const auto & hardware_info_map = resource_storage_->hardware_info_map_;
+    auto call_perform_mode_switch =
+      [&start_interfaces, &stop_interfaces, &hardware_info_map, &call_component_perform_mode_switch,
+       rt_logger = rt_logger_.get()](
+        auto & components, auto & start_interfaces_buffer, auto & stop_interfaces_buffer)
+    {
+      bool ret = true;
+      for (auto & component : components)
+      {
+        const auto & hw_command_itfs =
+          hardware_info_map.at(component.get_name()).command_interfaces;
+        find_common_hardware_interfaces(hw_command_itfs, start_interfaces, start_interfaces_buffer);
+        find_common_hardware_interfaces(hw_command_itfs, stop_interfaces, stop_interfaces_buffer);
+        if (start_interfaces_buffer.empty() && stop_interfaces_buffer.empty())
         {
-          if (
-            return_type::OK !=
-            component.perform_command_mode_switch(start_interfaces_buffer, stop_interfaces_buffer))
-          {
-            RCLCPP_ERROR(
-              logger, "Component '%s' could not perform switch for the command interfaces: \n%s",
-              component.get_name().c_str(),
-              interfaces_to_string(start_interfaces_buffer, stop_interfaces_buffer).c_str());
-            ret = false;
-          }
+          rt_logger->debug(
+            "Component '{}' after filtering has no command interfaces to perform switch",
+            component.get_name());
+          continue;
         }
-        catch (const std::exception & e)
+        bool abort = false;
+        if (!call_component_perform_mode_switch(
+              component, start_interfaces_buffer, stop_interfaces_buffer, abort))
         {
-          RCLCPP_ERROR(
-            logger,
-            "Exception of type : %s occurred while performing command mode switch for component "
-            "'%s' for the interfaces: \n %s : %s",
-            typeid(e).name(), component.get_name().c_str(),
-            interfaces_to_string(start_interfaces_buffer, stop_interfaces_buffer).c_str(),
-            e.what());
           ret = false;
         }
-        catch (...)
+        if (abort)
         {
-          RCLCPP_ERROR(
-            logger,
-            "Unknown exception occurred while performing command mode switch for component '%s' "
-            "for "
-            "the interfaces: \n %s",
-            component.get_name().c_str(),
-            interfaces_to_string(start_interfaces_buffer, stop_interfaces_buffer).c_str());
-          ret = false;
+          return false;
         }
       }
-      else
-      {
-        RCLCPP_WARN(
-          logger, "Component '%s' is not in INACTIVE or ACTIVE state, skipping the perform switch",
-          component.get_name().c_str());
-        ret = false;
-      }
-    }
-    return ret;
-  };
+      return ret;
+    };
 
-  const bool actuators_result = call_perform_mode_switch(
-    resource_storage_->actuators_, resource_storage_->start_interfaces_buffer_,
-    resource_storage_->stop_interfaces_buffer_);
-  const bool systems_result = call_perform_mode_switch(
-    resource_storage_->systems_, resource_storage_->start_interfaces_buffer_,
-    resource_storage_->stop_interfaces_buffer_);
+    actuators_result = call_perform_mode_switch(
+      resource_storage_->actuators_, resource_storage_->start_interfaces_buffer_,
+      resource_storage_->stop_interfaces_buffer_);
+    systems_result = call_perform_mode_switch(
+      resource_storage_->systems_, resource_storage_->start_interfaces_buffer_,
+      resource_storage_->stop_interfaces_buffer_);
+  }
 
   if (actuators_result && systems_result)
   {
@@ -2210,9 +2855,9 @@ bool ResourceManager::perform_command_mode_switch(
       for (const auto & [joint_name, limiter] : limiters)
       {
         limiter->reset_internals();
-        RCLCPP_DEBUG(
-          get_logger(), "Resetting internals of joint limiter for joint '%s' in hardware '%s'",
-          joint_name.c_str(), hw_name.c_str());
+        rt_logger_->debug(
+          "Resetting internals of joint limiter for joint '{}' in hardware '{}'", joint_name,
+          hw_name);
       }
     }
   }
@@ -2237,6 +2882,9 @@ return_type ResourceManager::set_component_state(
     return return_type::ERROR;
   }
 
+  // the transitions requested from the real-time loop were requested before this one
+  process_deferred_component_transitions();
+
   return_type result = return_type::OK;
 
   if (target_state.id() == 0)
@@ -2286,6 +2934,7 @@ return_type ResourceManager::set_component_state(
 
   std::lock_guard<std::recursive_mutex> guard(resources_lock_);
   std::lock_guard<std::recursive_mutex> limiters_guard(joint_limiters_lock_);
+  const auto rate_domain_limiters_guards = lock_rate_domain_joint_limiters();
   bool found = find_set_component_state(
     std::bind(&ResourceStorage::set_component_state<Actuator>, resource_storage_.get(), _1, _2),
     resource_storage_->actuators_);
@@ -2308,7 +2957,20 @@ return_type ResourceManager::set_component_state(
 // CM API: Called in "update"-thread
 bool ResourceManager::enforce_command_limits(const rclcpp::Duration & period)
 {
-  std::unique_lock<std::recursive_mutex> limiters_guard(joint_limiters_lock_, std::try_to_lock);
+  return enforce_command_limits(period, 0);
+}
+
+bool ResourceManager::enforce_command_limits(
+  const rclcpp::Duration & period, unsigned int rate_domain)
+{
+  // the locks of the rate domains are only accessed once their threads are started
+  if (rate_domain > 0 && rate_domain > rate_domain_joint_limiters_locks_.size())
+  {
+    return false;
+  }
+  std::unique_lock<std::recursive_mutex> limiters_guard(
+    rate_domain == 0 ? joint_limiters_lock_ : *rate_domain_joint_limiters_locks_[rate_domain - 1],
+    std::try_to_lock);
   if (!limiters_guard.owns_lock())
   {
     return false;
@@ -2318,6 +2980,10 @@ bool ResourceManager::enforce_command_limits(const rclcpp::Duration & period)
   // Joint Limiters operations
   for (auto & [hw_name, limiters] : resource_storage_->joint_limiters_interface_)
   {
+    if (resource_storage_->get_rate_domain(hw_name) != rate_domain)
+    {
+      continue;
+    }
     for (const auto & [joint_name, limiter] : limiters)
     {
       enforce_result |= resource_storage_->enforce_command_limits(joint_name, period);
@@ -2326,212 +2992,346 @@ bool ResourceManager::enforce_command_limits(const rclcpp::Duration & period)
   return enforce_result;
 }
 
+std::vector<std::unique_lock<std::recursive_mutex>>
+ResourceManager::lock_rate_domain_joint_limiters()
+{
+  std::vector<std::unique_lock<std::recursive_mutex>> guards;
+  guards.reserve(rate_domain_joint_limiters_locks_.size());
+  for (auto & lock : rate_domain_joint_limiters_locks_)
+  {
+    guards.emplace_back(*lock);
+  }
+  return guards;
+}
+
 // CM API: Called in "update"-thread
 HardwareReadWriteStatus ResourceManager::read(
-  const rclcpp::Time & /*time*/, const rclcpp::Duration & period)
+  const rclcpp::Time & time, const rclcpp::Duration & period)
 {
+  return read(time, period, 0);
+}
+
+// CM API: Called in "update"-thread of the rate domain
+HardwareReadWriteStatus ResourceManager::read(
+  const rclcpp::Time & /*time*/, const rclcpp::Duration & period, unsigned int rate_domain)
+{
+  auto * cycles = get_rate_domain_cycles(rate_domain);
+  if (!cycles)
+  {
+    return {return_type::ERROR, {}};
+  }
+  auto & read_write_status = cycles->read_write_status;
+  auto & stale_hardware_names = cycles->stale_hardware_names;
   read_write_status.result = return_type::OK;
   read_write_status.failed_hardware_names.clear();
+  stale_hardware_names.clear();
+  const uint64_t tick = cycles->read_tick++;
 
-  // This is needed while we load and initialize the components
-  std::unique_lock<std::recursive_mutex> resource_guard(resources_lock_, std::try_to_lock);
-  if (!resource_guard.owns_lock())
+  // The snapshot stays valid while components are loaded, so no cycle is skipped meanwhile
+  ResourceStorage::ComponentSnapshotReader snapshot_reader(*resource_storage_, rate_domain);
+  const auto * snapshot = snapshot_reader.get();
+  if (!snapshot)
   {
     return read_write_status;
   }
-  auto read_components = [&](auto & components)
+  // no-op unless the number of components changed
+  read_write_status.failed_hardware_names.reserve(snapshot->read_components.size());
+  stale_hardware_names.reserve(snapshot->read_components.size());
+  const unsigned int update_rate = snapshot->update_rates[rate_domain];
+
+  for (const auto & entry : snapshot->read_components)
   {
-    for (auto & component : components)
+    if (entry.rate_domain != rate_domain)
     {
-      std::unique_lock<std::recursive_mutex> lock(component.get_mutex(), std::try_to_lock);
-      const std::string component_name = component.get_name();
-      if (!lock.owns_lock())
+      continue;
+    }
+    auto & component = *entry.component;
+    std::unique_lock<std::recursive_mutex> lock(component.get_mutex(), std::try_to_lock);
+    const std::string & component_name = component.get_name();
+    if (!lock.owns_lock())
+    {
+      rt_logger_->debug(
+        "Skipping read() call for the component '{}' since it is locked", component_name);
+      continue;
+    }
+    // the component waits for the lifecycle worker to execute a transition
+    if (entry.deferred_requests->awaits_transition())
+    {
+      continue;
+    }
+    auto ret_val = return_type::OK;
+    try
+    {
+      auto & hardware_component_info = *entry.info;
+      const auto current_time = resource_storage_->get_clock()->now();
+      if (
+        hardware_component_info.rw_rate == 0 || hardware_component_info.rw_rate == update_rate)
       {
-        RCLCPP_DEBUG(
-          get_logger(), "Skipping read() call for the component '%s' since it is locked",
-          component_name.c_str());
-        continue;
+        ret_val = component.read(current_time, period);
       }
-      auto ret_val = return_type::OK;
-      try
+      else if (snapshot->tick_scheduling)
       {
-        auto & hardware_component_info = resource_storage_->hardware_info_map_[component_name];
-        const auto current_time = resource_storage_->get_clock()->now();
-        if (
-          hardware_component_info.rw_rate == 0 ||
-          hardware_component_info.rw_rate == resource_storage_->cm_update_rate_)
+        if (entry.schedule.is_due(tick))
         {
-          ret_val = component.read(current_time, period);
-        }
-        else
-        {
-          const double read_rate = hardware_component_info.rw_rate;
-          const rclcpp::Duration actual_period =
+          ret_val = component.read(
+            current_time,
             component.get_last_read_time().get_clock_type() != RCL_CLOCK_UNINITIALIZED
               ? current_time - component.get_last_read_time()
-              : rclcpp::Duration::from_seconds(1.0 / static_cast<double>(read_rate));
-
-          const double error_now = std::abs(actual_period.seconds() * read_rate - 1.0);
-          const double error_if_skipped = std::abs(
-            (actual_period.seconds() + 1.0 / resource_storage_->cm_update_rate_) * read_rate - 1.0);
-          if (error_now <= error_if_skipped)
-          {
-            ret_val = component.read(current_time, actual_period);
-          }
-        }
-        if (hardware_component_info.read_statistics)
-        {
-          const auto & read_statistics_collector = component.get_read_statistics();
-          hardware_component_info.read_statistics->execution_time.update_statistics(
-            read_statistics_collector.execution_time);
-          hardware_component_info.read_statistics->periodicity.update_statistics(
-            read_statistics_collector.periodicity);
+              : period * static_cast<double>(entry.schedule.divisor));
         }
-        const auto component_group = component.get_group_name();
-        ret_val =
-          resource_storage_->update_hardware_component_group_state(component_group, ret_val);
-      }
-      catch (const std::exception & e)
-      {
-        RCLCPP_ERROR(
-          get_logger(), "Exception of type : %s thrown during read of the component '%s': %s",
-          typeid(e).name(), component_name.c_str(), e.what());
-        ret_val = return_type::ERROR;
       }
-      catch (...)
+      else
       {
-        RCLCPP_ERROR(
-          get_logger(), "Unknown exception thrown during read of the component '%s'",
-          component_name.c_str());
-        ret_val = return_type::ERROR;
+        const double read_rate = hardware_component_info.rw_rate;
+        const rclcpp::Duration actual_period =
+          component.get_last_read_time().get_clock_type() != RCL_CLOCK_UNINITIALIZED
+            ? current_time - component.get_last_read_time()
+            : rclcpp::Duration::from_seconds(1.0 / static_cast<double>(read_rate));
+
+        const double error_now = std::abs(actual_period.seconds() * read_rate - 1.0);
+        const double error_if_skipped = std::abs(
+          (actual_period.seconds() + 1.0 / update_rate) * read_rate - 1.0);
+        if (error_now <= error_if_skipped)
+        {
+          ret_val = component.read(current_time, actual_period);
+        }
       }
-      RCLCPP_WARN_EXPRESSION(
-        get_logger(), ret_val == hardware_interface::return_type::DEACTIVATE,
-        "DEACTIVATE returned from read cycle is treated the same as ERROR.");
-      if (ret_val != return_type::OK)
+      // also in the cycles without read, to predict the states of decimated components
+      component.extrapolate_states(current_time);
+      if (hardware_component_info.read_statistics)
       {
-        component.error();
-        read_write_status.result = return_type::ERROR;
-        read_write_status.failed_hardware_names.push_back(component_name);
-        resource_storage_->remove_all_hardware_interfaces_from_available_list(component_name);
+        const auto & read_statistics_collector = component.get_read_statistics();
+        hardware_component_info.read_statistics->execution_time.update_statistics(
+          read_statistics_collector.execution_time);
+        hardware_component_info.read_statistics->periodicity.update_statistics(
+          read_statistics_collector.periodicity);
       }
+      ret_val = ResourceStorage::update_hardware_component_group_state(entry.group_state, ret_val);
     }
-  };
-
-  read_components(resource_storage_->actuators_);
-  read_components(resource_storage_->sensors_);
-  read_components(resource_storage_->systems_);
+    catch (const std::exception & e)
+    {
+      rt_logger_->error(
+        "Exception of type : {} thrown during read of the component '{}': {}", typeid(e).name(),
+        component_name, e.what());
+      ret_val = return_type::ERROR;
+    }
+    catch (...)
+    {
+      rt_logger_->error(
+        "Unknown exception thrown during read of the component '{}'", component_name);
+      ret_val = return_type::ERROR;
+    }
+    if (ret_val == hardware_interface::return_type::DEACTIVATE)
+    {
+      rt_logger_->warn("DEACTIVATE returned from read cycle is treated the same as ERROR.");
+    }
+    if (ret_val != return_type::OK)
+    {
+      // the error transition is executed by the lifecycle worker, until then the component is
+      // skipped by read and write
+      request_deferred_component_transition(entry.deferred_requests->error);
+      read_write_status.result = return_type::ERROR;
+      read_write_status.failed_hardware_names.push_back(component_name);
+      remove_failed_component_interfaces(
+        component_name, entry.deferred_requests->remove_interfaces);
+    }
+    else if (
+      snapshot->stale_state_read_cycles > 0 &&
+      component.get_stale_read_cycles() >= snapshot->stale_state_read_cycles)
+    {
+      stale_hardware_names.push_back(component_name);
+    }
+  }
 
   return read_write_status;
 }
 
+const std::vector<std::string> & ResourceManager::get_stale_hardware_names(
+  unsigned int rate_domain) const
+{
+  return rate_domain == 0 ? main_loop_cycles_.stale_hardware_names
+                          : rate_domain_cycles_.at(rate_domain - 1).stale_hardware_names;
+}
+
+ResourceManager::RateDomainCycles * ResourceManager::get_rate_domain_cycles(
+  unsigned int rate_domain)
+{
+  if (rate_domain == 0)
+  {
+    return &main_loop_cycles_;
+  }
+  return rate_domain <= rate_domain_cycles_.size() ? &rate_domain_cycles_[rate_domain - 1]
+                                                    : nullptr;
+}
+
+std::vector<double> ResourceManager::get_hardware_load_profile() const
+{
+  std::lock_guard<std::recursive_mutex> guard(resources_lock_);
+  return resource_storage_->hardware_load_profile_;
+}
+
 // CM API: Called in "update"-thread
 HardwareReadWriteStatus ResourceManager::write(
-  const rclcpp::Time & /*time*/, const rclcpp::Duration & period)
+  const rclcpp::Time & time, const rclcpp::Duration & period)
+{
+  return write(time, period, 0);
+}
+
+// CM API: Called in "update"-thread of the rate domain
+HardwareReadWriteStatus ResourceManager::write(
+  const rclcpp::Time & /*time*/, const rclcpp::Duration & period, unsigned int rate_domain)
 {
+  auto * cycles = get_rate_domain_cycles(rate_domain);
+  if (!cycles)
+  {
+    return {return_type::ERROR, {}};
+  }
+  auto & read_write_status = cycles->read_write_status;
   read_write_status.result = return_type::OK;
   read_write_status.failed_hardware_names.clear();
+  const uint64_t tick = cycles->write_tick++;
 
-  // This is needed while we load and initialize the components
-  std::unique_lock<std::recursive_mutex> resource_guard(resources_lock_, std::try_to_lock);
-  if (!resource_guard.owns_lock())
+  // The snapshot stays valid while components are loaded, so no cycle is skipped meanwhile
+  ResourceStorage::ComponentSnapshotReader snapshot_reader(*resource_storage_, rate_domain);
+  const auto * snapshot = snapshot_reader.get();
+  if (!snapshot)
   {
     return read_write_status;
   }
-  auto write_components = [&](auto & components)
+  // no-op unless the number of components changed
+  read_write_status.failed_hardware_names.reserve(snapshot->write_components.size());
+  const unsigned int update_rate = snapshot->update_rates[rate_domain];
+
+  for (const auto & entry : snapshot->write_components)
   {
-    for (auto & component : components)
+    if (entry.rate_domain != rate_domain)
+    {
+      continue;
+    }
+    auto & component = *entry.component;
+    std::unique_lock<std::recursive_mutex> lock(component.get_mutex(), std::try_to_lock);
+    const std::string & component_name = component.get_name();
+    if (!lock.owns_lock())
+    {
+      rt_logger_->debug(
+        "Skipping write() call for the component '{}' since it is locked", component_name);
+      continue;
+    }
+    // the component waits for the lifecycle worker to execute a transition
+    if (entry.deferred_requests->awaits_transition())
+    {
+      continue;
+    }
+    auto ret_val = return_type::OK;
+    try
     {
-      std::unique_lock<std::recursive_mutex> lock(component.get_mutex(), std::try_to_lock);
-      const std::string component_name = component.get_name();
-      if (!lock.owns_lock())
+      auto & hardware_component_info = *entry.info;
+      const auto current_time = resource_storage_->get_clock()->now();
+      if (
+        hardware_component_info.rw_rate == 0 || hardware_component_info.rw_rate == update_rate)
       {
-        RCLCPP_DEBUG(
-          get_logger(), "Skipping write() call for the component '%s' since it is locked",
-          component_name.c_str());
-        continue;
+        ret_val = component.write(current_time, period);
       }
-      auto ret_val = return_type::OK;
-      try
+      else if (snapshot->tick_scheduling)
       {
-        auto & hardware_component_info = resource_storage_->hardware_info_map_[component_name];
-        const auto current_time = resource_storage_->get_clock()->now();
-        if (
-          hardware_component_info.rw_rate == 0 ||
-          hardware_component_info.rw_rate == resource_storage_->cm_update_rate_)
-        {
-          ret_val = component.write(current_time, period);
-        }
-        else
+        if (entry.schedule.is_due(tick))
         {
-          const double write_rate = hardware_component_info.rw_rate;
-          const rclcpp::Duration actual_period =
+          ret_val = component.write(
+            current_time,
             component.get_last_write_time().get_clock_type() != RCL_CLOCK_UNINITIALIZED
               ? current_time - component.get_last_write_time()
-              : rclcpp::Duration::from_seconds(1.0 / static_cast<double>(write_rate));
-
-          const double error_now = std::abs(actual_period.seconds() * write_rate - 1.0);
-          const double error_if_skipped = std::abs(
-            (actual_period.seconds() + 1.0 / resource_storage_->cm_update_rate_) * write_rate -
-            1.0);
-          if (error_now <= error_if_skipped)
-          {
-            ret_val = component.write(current_time, actual_period);
-          }
+              : period * static_cast<double>(entry.schedule.divisor));
         }
-        if (hardware_component_info.write_statistics)
-        {
-          const auto & write_statistics_collector = component.get_write_statistics();
-          hardware_component_info.write_statistics->execution_time.update_statistics(
-            write_statistics_collector.execution_time);
-          hardware_component_info.write_statistics->periodicity.update_statistics(
-            write_statistics_collector.periodicity);
-        }
-        const auto component_group = component.get_group_name();
-        ret_val =
-          resource_storage_->update_hardware_component_group_state(component_group, ret_val);
       }
-      catch (const std::exception & e)
+      else
       {
-        RCLCPP_ERROR(
-          get_logger(), "Exception of type : %s thrown during write of the component '%s': %s",
-          typeid(e).name(), component_name.c_str(), e.what());
-        ret_val = return_type::ERROR;
+        const double write_rate = hardware_component_info.rw_rate;
+        const rclcpp::Duration actual_period =
+          component.get_last_write_time().get_clock_type() != RCL_CLOCK_UNINITIALIZED
+            ? current_time - component.get_last_write_time()
+            : rclcpp::Duration::from_seconds(1.0 / static_cast<double>(write_rate));
+
+        const double error_now = std::abs(actual_period.seconds() * write_rate - 1.0);
+        const double error_if_skipped = std::abs(
+          (actual_period.seconds() + 1.0 / update_rate) * write_rate - 1.0);
+        if (error_now <= error_if_skipped)
+        {
+          ret_val = component.write(current_time, actual_period);
+        }
       }
-      catch (...)
+      if (hardware_component_info.write_statistics)
       {
-        RCLCPP_ERROR(
-          get_logger(), "Unknown exception thrown during write of the component '%s'",
-          component_name.c_str());
-        ret_val = return_type::ERROR;
+        const auto & write_statistics_collector = component.get_write_statistics();
+        hardware_component_info.write_statistics->execution_time.update_statistics(
+          write_statistics_collector.execution_time);
+        hardware_component_info.write_statistics->periodicity.update_statistics(
+          write_statistics_collector.periodicity);
       }
-      if (ret_val == return_type::ERROR)
+      ret_val = ResourceStorage::update_hardware_component_group_state(entry.group_state, ret_val);
+    }
+    catch (const std::exception & e)
+    {
+      rt_logger_->error(
+        "Exception of type : {} thrown during write of the component '{}': {}", typeid(e).name(),
+        component_name, e.what());
+      ret_val = return_type::ERROR;
+    }
+    catch (...)
+    {
+      rt_logger_->error(
+        "Unknown exception thrown during write of the component '{}'", component_name);
+      ret_val = return_type::ERROR;
+    }
+    if (ret_val == return_type::ERROR)
+    {
+      request_deferred_component_transition(entry.deferred_requests->error);
+      read_write_status.result = ret_val;
+      read_write_status.failed_hardware_names.push_back(component_name);
+      remove_failed_component_interfaces(
+        component_name, entry.deferred_requests->remove_interfaces);
+    }
+    else if (ret_val == return_type::DEACTIVATE)
+    {
+      // the deactivation is executed by the lifecycle worker, until then the component is
+      // skipped by read and write
+      request_deferred_component_transition(entry.deferred_requests->deactivate);
+      read_write_status.result = ret_val;
+      if (return_failed_hardware_names_on_return_deactivate_write_cycle_)
       {
-        component.error();
-        read_write_status.result = ret_val;
         read_write_status.failed_hardware_names.push_back(component_name);
-        resource_storage_->remove_all_hardware_interfaces_from_available_list(component_name);
-      }
-      else if (ret_val == return_type::DEACTIVATE)
-      {
-        rclcpp_lifecycle::State inactive_state(
-          lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, lifecycle_state_names::INACTIVE);
-        set_component_state(component_name, inactive_state);
-        read_write_status.result = ret_val;
-        if (return_failed_hardware_names_on_return_deactivate_write_cycle_)
-        {
-          read_write_status.failed_hardware_names.push_back(component_name);
-        }
       }
     }
-  };
-
-  write_components(resource_storage_->actuators_);
-  write_components(resource_storage_->systems_);
+  }
 
   return read_write_status;
 }
 
+void ResourceManager::remove_failed_component_interfaces(
+  const std::string & component_name, std::atomic_bool & removal_request)
+{
+  // the available lists are shared with the non real-time code, don't wait for it
+  std::unique_lock<std::recursive_mutex> resource_guard(resources_lock_, std::try_to_lock);
+  if (resource_guard.owns_lock())
+  {
+    resource_storage_->remove_all_hardware_interfaces_from_available_list(component_name);
+    return;
+  }
+  request_deferred_component_transition(removal_request);
+}
+
+void ResourceManager::request_deferred_component_transition(std::atomic_bool & request)
+{
+  request = true;
+  deferred_transitions_requested_ = true;
+  {
+    // the worker holds the mutex only to check the generation, so the notification can't get lost
+    // between its check and its wait
+    std::lock_guard<std::mutex> lock(lifecycle_worker_mutex_);
+    ++lifecycle_worker_generation_;
+  }
+  lifecycle_worker_cv_.notify_one();
+}
+
 // BEGIN: "used only in tests and locally"
 size_t ResourceManager::actuator_components_size() const
 {
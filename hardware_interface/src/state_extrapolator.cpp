@@ -0,0 +1,164 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "hardware_interface/state_extrapolator.hpp"
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "hardware_interface/lexical_casts.hpp"
+
+namespace hardware_interface
+{
+namespace
+{
+constexpr double kNanosecondsToSeconds = 1e-9;
+}  // namespace
+
+StateExtrapolation parse_state_extrapolation(const std::string & extrapolation)
+{
+  const std::string lower_case_extrapolation = to_lower_case(extrapolation);
+  if (lower_case_extrapolation == "none")
+  {
+    return StateExtrapolation::NONE;
+  }
+  if (lower_case_extrapolation == "hold")
+  {
+    return StateExtrapolation::HOLD;
+  }
+  if (lower_case_extrapolation == "linear")
+  {
+    return StateExtrapolation::LINEAR;
+  }
+  if (lower_case_extrapolation == "filter")
+  {
+    return StateExtrapolation::FILTER;
+  }
+  throw std::invalid_argument(
+    fmt::format(
+      FMT_COMPILE(
+        "Unknown state extrapolation: '{}', expected 'none', 'hold', 'linear' or 'filter'."),
+      extrapolation));
+}
+
+void StateExtrapolator::set_filter_gains(double alpha, double beta)
+{
+  if (!(alpha > 0.0 && alpha <= 1.0) || !(beta >= 0.0 && beta <= 2.0))
+  {
+    throw std::invalid_argument(
+      fmt::format(
+        FMT_COMPILE(
+          "Invalid gains of the state extrapolation filter: alpha {} has to be in (0, 1] and "
+          "beta {} in [0, 2]."),
+        alpha, beta));
+  }
+  alpha_ = alpha;
+  beta_ = beta;
+}
+
+void StateExtrapolator::set_horizon(int64_t horizon)
+{
+  if (horizon < 0)
+  {
+    throw std::invalid_argument(
+      fmt::format(
+        FMT_COMPILE("The horizon of the state extrapolation can't be negative, got {} ns."),
+        horizon));
+  }
+  horizon_ = horizon;
+}
+
+void StateExtrapolator::add_sample(int64_t time, double value, double derivative)
+{
+  if (number_of_samples_ > 0)
+  {
+    auto & latest = samples_[number_of_samples_ - 1];
+    if (time <= latest.time)
+    {
+      latest.value = value;
+      latest.derivative = derivative;
+      return;
+    }
+    // the extrapolation restarts after non-finite samples
+    if (!std::isfinite(latest.value) || !std::isfinite(value))
+    {
+      number_of_samples_ = 0;
+    }
+  }
+  if (number_of_samples_ == 0)
+  {
+    filtered_value_ = value;
+    filtered_rate_ = std::isfinite(derivative) ? derivative : 0.0;
+  }
+  else
+  {
+    const double dt =
+      static_cast<double>(time - samples_[number_of_samples_ - 1].time) * kNanosecondsToSeconds;
+    const double predicted_value = filtered_value_ + filtered_rate_ * dt;
+    const double residual = value - predicted_value;
+    filtered_value_ = predicted_value + alpha_ * residual;
+    filtered_rate_ += beta_ * residual / dt;
+  }
+  if (number_of_samples_ == samples_.size())
+  {
+    samples_[0] = samples_[1];
+    --number_of_samples_;
+  }
+  samples_[number_of_samples_++] = {time, value, derivative};
+}
+
+double StateExtrapolator::extrapolate(int64_t time) const
+{
+  if (number_of_samples_ == 0)
+  {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  const auto & latest = samples_[number_of_samples_ - 1];
+  int64_t elapsed = std::max<int64_t>(time - latest.time, 0);
+  if (horizon_ > 0)
+  {
+    elapsed = std::min(elapsed, horizon_);
+  }
+  const double dt = static_cast<double>(elapsed) * kNanosecondsToSeconds;
+  switch (extrapolation_)
+  {
+    case StateExtrapolation::LINEAR:
+    {
+      if (std::isfinite(latest.derivative))
+      {
+        return latest.value + latest.derivative * dt;
+      }
+      if (number_of_samples_ < 2)
+      {
+        return latest.value;
+      }
+      const auto & previous = samples_[0];
+      const double duration =
+        static_cast<double>(latest.time - previous.time) * kNanosecondsToSeconds;
+      return latest.value + (latest.value - previous.value) / duration * dt;
+    }
+    case StateExtrapolation::FILTER:
+      return latest.value + filtered_rate_ * dt;
+    default:
+      return latest.value;
+  }
+}
+
+}  // namespace hardware_interface
@@ -14,6 +14,7 @@
 //
 // Author: Denis Stogl
 
+#include <chrono>
 #include <cmath>
 #include <string>
 #include <unordered_map>
@@ -2787,6 +2788,80 @@ TEST_F(TestGenericSystem, perform_command_mode_switch_works_with_all_example_tag
   ASSERT_TRUE(check_perform_command_mode_switch(disabled_commands_));
 }
 
+TEST_F(TestGenericSystem, generic_system_with_many_joints)
+{
+  constexpr size_t kNumberOfJoints = 1000;
+  std::string urdf_joints;
+  std::string hardware_system =
+    R"(
+  <ros2_control name="MockHardwareSystem" type="system">
+    <hardware>
+      <plugin>mock_components/GenericSystem</plugin>
+      <param name="calculate_dynamics">true</param>
+    </hardware>)";
+  for (size_t i = 0; i < kNumberOfJoints; ++i)
+  {
+    const std::string index = std::to_string(i);
+    urdf_joints += R"(
+  <link name="link)" + index + R"("/>
+  <joint name="joint)" + index + R"(" type="continuous">
+    <parent link="base_link"/>
+    <child link="link)" + index + R"("/>
+  </joint>)";
+    hardware_system += R"(
+    <joint name="joint)" + index + R"(">
+      <command_interface name="position"/>
+      <state_interface name="position">
+        <param name="initial_value">0.0</param>
+      </state_interface>
+      <state_interface name="velocity"/>
+    </joint>)";
+  }
+  hardware_system += R"(
+  </ros2_control>
+)";
+  const std::string urdf =
+    R"(<?xml version="1.0" encoding="utf-8"?>
+<robot name="LargeRobot">
+  <link name="base_link"/>)" +
+    urdf_joints + hardware_system + ros2_control_test_assets::urdf_tail;
+  TestableResourceManager rm(node_, urdf);
+  activate_components(rm, {"MockHardwareSystem"});
+  ASSERT_EQ(2 * kNumberOfJoints, rm.state_interface_keys().size());
+  ASSERT_EQ(kNumberOfJoints, rm.command_interface_keys().size());
+
+  std::vector<hardware_interface::LoanedStateInterface> position_states;
+  std::vector<hardware_interface::LoanedStateInterface> velocity_states;
+  std::vector<hardware_interface::LoanedCommandInterface> position_commands;
+  for (size_t i = 0; i < kNumberOfJoints; ++i)
+  {
+    const std::string joint_name = "joint" + std::to_string(i);
+    position_states.push_back(rm.claim_state_interface(joint_name + "/position"));
+    velocity_states.push_back(rm.claim_state_interface(joint_name + "/velocity"));
+    position_commands.push_back(rm.claim_command_interface(joint_name + "/position"));
+    ASSERT_TRUE(position_commands.back().set_value(0.001 * static_cast<double>(i)));
+  }
+
+  constexpr int kCycles = 100;
+  const auto start_time = std::chrono::steady_clock::now();
+  for (int cycle = 0; cycle < kCycles; ++cycle)
+  {
+    ASSERT_EQ(rm.read(TIME, PERIOD).result, hardware_interface::return_type::OK);
+  }
+  const double read_time =
+    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
+      .count() /
+    kCycles;
+  RecordProperty("read_us", std::to_string(read_time));
+
+  for (size_t i = 0; i < kNumberOfJoints; ++i)
+  {
+    EXPECT_NEAR(0.001 * static_cast<double>(i), position_states[i].get_optional().value(), 1e-9);
+    // the position doesn't change after the first cycle
+    EXPECT_NEAR(0.0, velocity_states[i].get_optional().value(), 1e-9);
+  }
+}
+
 int main(int argc, char ** argv)
 {
   rclcpp::init(argc, argv);
@@ -0,0 +1,190 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "hardware_interface/loaned_command_interface.hpp"
+#include "hardware_interface/loaned_state_interface.hpp"
+#include "hardware_interface/resource_manager.hpp"
+#include "mock_components/synthetic_load.hpp"
+#include "rclcpp/node.hpp"
+#include "ros2_control_test_assets/descriptions.hpp"
+
+using mock_components::JitterDistribution;
+using mock_components::SyntheticLoad;
+using mock_components::SyntheticLoadParameters;
+
+namespace
+{
+const auto TIME = rclcpp::Time(0);
+const auto PERIOD = rclcpp::Duration::from_seconds(0.001);
+
+std::string make_urdf(const std::string & failure_rate)
+{
+  const std::string hardware_system =
+    R"(
+  <ros2_control name="LoadGeneratorSystem" type="system">
+    <hardware>
+      <plugin>mock_components/LoadGeneratorSystem</plugin>
+      <param name="cpu_time_us">50</param>
+      <param name="memory_footprint_bytes">1048576</param>
+      <param name="cache_footprint_bytes">65536</param>
+      <param name="jitter_distribution">uniform</param>
+      <param name="jitter_us">10</param>
+      <param name="failure_rate">)" +
+    failure_rate + R"(</param>
+    </hardware>
+    <joint name="joint1">
+      <command_interface name="position"/>
+      <state_interface name="position">
+        <param name="initial_value">1.57</param>
+      </state_interface>
+    </joint>
+  </ros2_control>
+)";
+  return ros2_control_test_assets::urdf_head + hardware_system +
+         ros2_control_test_assets::urdf_tail;
+}
+}  // namespace
+
+class TestLoadGeneratorSystem : public ::testing::Test
+{
+protected:
+  rclcpp::Node::SharedPtr node_ = std::make_shared<rclcpp::Node>("TestLoadGeneratorSystem");
+};
+
+class TestableResourceManager : public hardware_interface::ResourceManager
+{
+public:
+  explicit TestableResourceManager(rclcpp::Node::SharedPtr node, const std::string & urdf)
+  : hardware_interface::ResourceManager(
+      urdf, node->get_node_clock_interface(), node->get_node_logging_interface(), true, 1000)
+  {
+  }
+};
+
+TEST(TestSyntheticLoad, parameters_are_parsed_and_validated)
+{
+  const std::unordered_map<std::string, std::string> parameters = {
+    {"cpu_time_us", "12.5"},
+    {"memory_footprint_bytes", "4096"},
+    {"cache_footprint_bytes", "8192"},
+    {"jitter_distribution", "Exponential"},
+    {"jitter_us", "3"},
+    {"failure_rate", "0.25"},
+    {"seed", "42"},
+    {"unrelated_parameter", "true"}};
+  const auto load = mock_components::parse_synthetic_load_parameters(parameters);
+  EXPECT_EQ(std::chrono::nanoseconds(12500), load.cpu_time);
+  EXPECT_EQ(4096u, load.memory_footprint);
+  EXPECT_EQ(8192u, load.cache_footprint);
+  EXPECT_EQ(JitterDistribution::EXPONENTIAL, load.jitter_distribution);
+  EXPECT_EQ(std::chrono::microseconds(3), load.jitter);
+  EXPECT_DOUBLE_EQ(0.25, load.failure_rate);
+  EXPECT_EQ(42u, load.seed);
+
+  const auto defaults = mock_components::parse_synthetic_load_parameters({});
+  EXPECT_EQ(std::chrono::nanoseconds(0), defaults.cpu_time);
+  EXPECT_EQ(JitterDistribution::NONE, defaults.jitter_distribution);
+
+  EXPECT_THROW(
+    mock_components::parse_synthetic_load_parameters({{"cpu_time_us", "-1"}}),
+    std::invalid_argument);
+  EXPECT_THROW(
+    mock_components::parse_synthetic_load_parameters({{"jitter_distribution", "poisson"}}),
+    std::invalid_argument);
+  EXPECT_THROW(
+    mock_components::parse_synthetic_load_parameters({{"memory_footprint_bytes", "1.5"}}),
+    std::invalid_argument);
+
+  SyntheticLoadParameters invalid_failure_rate;
+  invalid_failure_rate.failure_rate = 1.5;
+  EXPECT_THROW(SyntheticLoad{invalid_failure_rate}, std::invalid_argument);
+}
+
+TEST(TestSyntheticLoad, cycles_take_the_cpu_time_and_fail_with_the_failure_rate)
+{
+  SyntheticLoadParameters parameters;
+  parameters.cpu_time = std::chrono::microseconds(200);
+  parameters.cache_footprint = 4096;
+  SyntheticLoad load(parameters);
+  for (int cycle = 0; cycle < 10; ++cycle)
+  {
+    EXPECT_TRUE(load.run_cycle());
+    EXPECT_GE(load.get_last_cycle_time(), parameters.cpu_time);
+  }
+
+  parameters.failure_rate = 1.0;
+  SyntheticLoad failing_load(parameters);
+  EXPECT_FALSE(failing_load.run_cycle());
+
+  // the same seed results in the same jitter and failures
+  parameters.cpu_time = std::chrono::nanoseconds(0);
+  parameters.failure_rate = 0.5;
+  parameters.jitter_distribution = JitterDistribution::NORMAL;
+  parameters.jitter = std::chrono::microseconds(1);
+  parameters.seed = 7;
+  SyntheticLoad first_load(parameters);
+  SyntheticLoad second_load(parameters);
+  std::vector<bool> first_results;
+  std::vector<bool> second_results;
+  for (int cycle = 0; cycle < 100; ++cycle)
+  {
+    first_results.push_back(first_load.run_cycle());
+    second_results.push_back(second_load.run_cycle());
+  }
+  EXPECT_EQ(first_results, second_results);
+  EXPECT_THAT(first_results, testing::Contains(true));
+  EXPECT_THAT(first_results, testing::Contains(false));
+}
+
+TEST_F(TestLoadGeneratorSystem, commands_are_mirrored_with_synthetic_load)
+{
+  TestableResourceManager rm(node_, make_urdf("0.0"));
+  auto position_state = rm.claim_state_interface("joint1/position");
+  auto position_command = rm.claim_command_interface("joint1/position");
+  EXPECT_DOUBLE_EQ(1.57, position_state.get_optional().value());
+
+  ASSERT_TRUE(position_command.set_value(0.5));
+  const auto start_time = std::chrono::steady_clock::now();
+  ASSERT_EQ(rm.read(TIME, PERIOD).result, hardware_interface::return_type::OK);
+  EXPECT_GE(std::chrono::steady_clock::now() - start_time, std::chrono::microseconds(50));
+  EXPECT_DOUBLE_EQ(0.5, position_state.get_optional().value());
+}
+
+TEST_F(TestLoadGeneratorSystem, synthetic_failures_are_reported_by_read)
+{
+  TestableResourceManager rm(node_, make_urdf("1.0"));
+  const auto status = rm.read(TIME, PERIOD);
+  EXPECT_EQ(status.result, hardware_interface::return_type::ERROR);
+  EXPECT_THAT(status.failed_hardware_names, testing::ElementsAre("LoadGeneratorSystem"));
+}
+
+TEST_F(TestLoadGeneratorSystem, invalid_load_fails_initialization)
+{
+  TestableResourceManager rm(node_, make_urdf("2.0"));
+  EXPECT_FALSE(rm.are_components_initialized());
+}
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  testing::InitGoogleMock(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,241 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "hardware_interface/handle.hpp"
+#include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/loaned_command_interface.hpp"
+#include "hardware_interface/loaned_state_interface.hpp"
+#include "rclcpp/logging.hpp"
+
+using hardware_interface::CommandInterface;
+using hardware_interface::InterfaceDescription;
+using hardware_interface::InterfaceInfo;
+using hardware_interface::LoanedCommandInterface;
+using hardware_interface::LoanedStateInterface;
+using hardware_interface::StateInterface;
+
+namespace
+{
+InterfaceDescription make_description(
+  const std::string & data_type, int size, const std::string & initial_value = "")
+{
+  InterfaceInfo info;
+  info.name = "taxels";
+  info.data_type = data_type;
+  info.size = size;
+  info.initial_value = initial_value;
+  return InterfaceDescription("skin", info);
+}
+}  // namespace
+
+TEST(TestArrayInterface, scalar_interface_is_not_an_array)
+{
+  StateInterface handle{make_description("double", 1)};
+  EXPECT_FALSE(handle.is_array());
+  EXPECT_EQ(1u, handle.get_size());
+  std::array<double, 1> values;
+  EXPECT_THROW({ std::ignore = handle.get_array_values<double>(values); }, std::runtime_error);
+}
+
+TEST(TestArrayInterface, array_values_are_initialized)
+{
+  StateInterface nan_handle{make_description("double", 3)};
+  ASSERT_TRUE(nan_handle.is_array());
+  ASSERT_EQ(3u, nan_handle.get_size());
+  std::array<double, 3> double_values;
+  ASSERT_TRUE(nan_handle.get_array_values<double>(double_values));
+  for (const auto value : double_values)
+  {
+    EXPECT_TRUE(std::isnan(value));
+  }
+
+  StateInterface broadcast_handle{make_description("int32", 3, "-7")};
+  std::array<int32_t, 3> int_values;
+  ASSERT_TRUE(broadcast_handle.get_array_values<int32_t>(int_values));
+  EXPECT_THAT(int_values, testing::ElementsAre(-7, -7, -7));
+
+  StateInterface list_handle{make_description("uint16", 3, "[1, 2, 65535]")};
+  std::array<uint16_t, 3> uint_values;
+  ASSERT_TRUE(list_handle.get_array_values<uint16_t>(uint_values));
+  EXPECT_THAT(uint_values, testing::ElementsAre(1, 2, 65535));
+
+  EXPECT_THROW(
+    { StateInterface bad{make_description("uint16", 3, "[1, 2]")}; }, std::invalid_argument)
+    << "The number of initial values has to match the size";
+  EXPECT_THROW(
+    { StateInterface bad{make_description("uint8", 2, "[1, 256]")}; }, std::invalid_argument)
+    << "Out of range initial values should throw";
+}
+
+TEST(TestArrayInterface, array_values_are_set_and_copied_at_once)
+{
+  CommandInterface handle{make_description("float", 4)};
+  const std::vector<float> command = {1.f, 2.f, 3.f, 4.f};
+  ASSERT_TRUE(handle.set_array_values<float>(command));
+
+  std::vector<float> values(4);
+  ASSERT_TRUE(handle.get_array_values<float>(values));
+  EXPECT_EQ(command, values);
+
+  // views are only handed out while the lock is held
+  {
+    std::unique_lock<std::shared_mutex> lock(handle.get_mutex());
+    auto view = handle.get_array<float>(lock);
+    ASSERT_EQ(4u, view.size());
+    view[0] = 10.f;
+  }
+  std::shared_lock<std::shared_mutex> lock(handle.get_mutex(), std::try_to_lock);
+  ASSERT_TRUE(lock.owns_lock());
+  EXPECT_EQ(10.f, handle.get_array<float>(lock)[0]);
+  lock.unlock();
+
+  std::shared_lock<std::shared_mutex> deferred_lock(handle.get_mutex(), std::defer_lock);
+  EXPECT_TRUE(handle.get_array<float>(deferred_lock).empty());
+
+  // bool arrays are stored contiguously as well
+  StateInterface bool_handle{make_description("bool", 2, "[true, false]")};
+  bool bool_values[2];
+  ASSERT_TRUE(
+    bool_handle.get_array_values<bool>(hardware_interface::Span<bool>(bool_values, 2)));
+  EXPECT_TRUE(bool_values[0]);
+  EXPECT_FALSE(bool_values[1]);
+}
+
+TEST(TestArrayInterface, invalid_array_access_throws)
+{
+  StateInterface handle{make_description("double", 4)};
+  std::vector<double> wrong_size(3);
+  std::vector<float> wrong_type(4);
+  EXPECT_THROW({ std::ignore = handle.get_array_values<double>(wrong_size); }, std::runtime_error);
+  EXPECT_THROW({ std::ignore = handle.get_array_values<float>(wrong_type); }, std::runtime_error);
+  EXPECT_THROW({ std::ignore = handle.get_optional<double>(); }, std::runtime_error);
+  EXPECT_THROW({ std::ignore = handle.set_value(1.0); }, std::runtime_error);
+}
+
+TEST(TestArrayInterface, copied_handle_owns_its_values)
+{
+  StateInterface handle{make_description("int64", 2, "[1, 2]")};
+  StateInterface copy(handle);
+  const std::array<int64_t, 2> new_values = {3, 4};
+  ASSERT_TRUE(handle.set_array_values<int64_t>(new_values));
+
+  std::array<int64_t, 2> values;
+  ASSERT_TRUE(copy.get_array_values<int64_t>(values));
+  EXPECT_THAT(values, testing::ElementsAre(1, 2));
+  EXPECT_EQ(hardware_interface::HandleDataType::INT64, copy.get_data_type());
+}
+
+TEST(TestArrayInterface, loaned_array_interfaces)
+{
+  auto state = std::make_shared<StateInterface>(make_description("double", 3, "0.0"));
+  auto command = std::make_shared<CommandInterface>(make_description("double", 3, "0.0"));
+  LoanedStateInterface loaned_state(state);
+  LoanedCommandInterface loaned_command(command);
+  EXPECT_TRUE(loaned_state.is_array());
+  EXPECT_EQ(3u, loaned_command.get_size());
+
+  const std::array<double, 3> command_values = {1.0, 2.0, 3.0};
+  ASSERT_TRUE(loaned_command.set_array_values<double>(command_values));
+  std::array<double, 3> values;
+  ASSERT_TRUE(loaned_command.get_array_values<double>(values));
+  EXPECT_EQ(command_values, values);
+  ASSERT_TRUE(loaned_state.get_array_values<double>(values));
+  EXPECT_THAT(values, testing::Each(0.0));
+}
+
+TEST(TestArrayInterface, array_bound_to_memory_is_accessed_in_place)
+{
+  auto description = make_description("float", 3, "1.0");
+  std::array<float, 3> process_image = {1.f, 2.f, 3.f};
+  description.bind_memory(process_image.data());
+  StateInterface handle{description};
+
+  std::shared_lock<std::shared_mutex> lock(handle.get_mutex());
+  const auto view = handle.get_array<float>(lock);
+  EXPECT_EQ(process_image.data(), view.data());
+  EXPECT_THAT(view, testing::ElementsAre(1.f, 2.f, 3.f));
+}
+
+class TestArrayInterfaceBenchmark : public testing::TestWithParam<size_t>
+{
+};
+
+// Compares reading N values through one array interface with reading N scalar interfaces, as a
+// controller would do with loaned interfaces. The results are reported as test properties.
+TEST_P(TestArrayInterfaceBenchmark, array_vs_scalar_interfaces)
+{
+  const size_t size = GetParam();
+  constexpr int kRepetitions = 1000;
+
+  std::vector<std::shared_ptr<StateInterface>> scalar_interfaces;
+  std::vector<LoanedStateInterface> loaned_scalar_interfaces;
+  loaned_scalar_interfaces.reserve(size);
+  for (size_t i = 0; i < size; ++i)
+  {
+    InterfaceInfo info;
+    info.name = "taxel_" + std::to_string(i);
+    info.initial_value = std::to_string(i);
+    scalar_interfaces.push_back(
+      std::make_shared<StateInterface>(InterfaceDescription("skin", info)));
+    loaned_scalar_interfaces.emplace_back(scalar_interfaces.back());
+  }
+  auto array_interface = std::make_shared<StateInterface>(
+    make_description("double", static_cast<int>(size), "1.0"));
+  LoanedStateInterface loaned_array_interface(array_interface);
+
+  std::vector<double> values(size);
+  auto start_time = std::chrono::steady_clock::now();
+  for (int repetition = 0; repetition < kRepetitions; ++repetition)
+  {
+    for (size_t i = 0; i < size; ++i)
+    {
+      values[i] = loaned_scalar_interfaces[i].get_optional().value();
+    }
+  }
+  const double scalar_time =
+    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
+      .count() /
+    kRepetitions;
+  EXPECT_DOUBLE_EQ(static_cast<double>(size - 1), values.back());
+
+  start_time = std::chrono::steady_clock::now();
+  for (int repetition = 0; repetition < kRepetitions; ++repetition)
+  {
+    ASSERT_TRUE(loaned_array_interface.get_array_values<double>(values));
+  }
+  const double array_time =
+    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
+      .count() /
+    kRepetitions;
+  EXPECT_DOUBLE_EQ(1.0, values.back());
+
+  RCLCPP_INFO(
+    rclcpp::get_logger("test_array_interface"),
+    "Reading %zu values: %.3f us with scalar interfaces, %.3f us with an array interface", size,
+    scalar_time, array_time);
+  RecordProperty("scalar_interfaces_us", std::to_string(scalar_time));
+  RecordProperty("array_interface_us", std::to_string(array_time));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  number_of_values, TestArrayInterfaceBenchmark, testing::Values<size_t>(16u, 256u, 4096u));
@@ -0,0 +1,106 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "hardware_interface/command_interpolator.hpp"
+
+using hardware_interface::CommandInterpolation;
+using hardware_interface::CommandInterpolator;
+
+namespace
+{
+// 1 kHz controller manager, the hardware component writes at 8 kHz
+constexpr int64_t kPeriod = 1000000;
+constexpr int64_t kSubPeriod = kPeriod / 8;
+}  // namespace
+
+TEST(TestCommandInterpolator, parse_interpolation)
+{
+  EXPECT_EQ(CommandInterpolation::NONE, hardware_interface::parse_command_interpolation("none"));
+  EXPECT_EQ(
+    CommandInterpolation::LINEAR, hardware_interface::parse_command_interpolation("Linear"));
+  EXPECT_EQ(CommandInterpolation::CUBIC, hardware_interface::parse_command_interpolation("cubic"));
+  EXPECT_THROW(hardware_interface::parse_command_interpolation("spline"), std::invalid_argument);
+}
+
+TEST(TestCommandInterpolator, linear_interpolation_is_delayed_by_one_cycle)
+{
+  CommandInterpolator interpolator(CommandInterpolation::LINEAR);
+  EXPECT_TRUE(std::isnan(interpolator.interpolate(0)));
+
+  interpolator.add_setpoint(0, 1.0);
+  EXPECT_DOUBLE_EQ(1.0, interpolator.interpolate(kSubPeriod));
+
+  interpolator.add_setpoint(kPeriod, 2.0);
+  for (int64_t step = 0; step <= 8; ++step)
+  {
+    EXPECT_DOUBLE_EQ(
+      1.0 + static_cast<double>(step) / 8.0, interpolator.interpolate(kPeriod + step * kSubPeriod));
+  }
+  // the latest setpoint is held if the next one is late
+  EXPECT_DOUBLE_EQ(2.0, interpolator.interpolate(3 * kPeriod));
+
+  // a setpoint of the same cycle replaces the latest one
+  interpolator.add_setpoint(kPeriod, 3.0);
+  EXPECT_DOUBLE_EQ(2.0, interpolator.interpolate(kPeriod + 4 * kSubPeriod));
+}
+
+TEST(TestCommandInterpolator, cubic_interpolation_is_smooth)
+{
+  CommandInterpolator interpolator(CommandInterpolation::CUBIC);
+  interpolator.add_setpoint(0, 0.0);
+  interpolator.add_setpoint(kPeriod, 1.0);
+  interpolator.add_setpoint(2 * kPeriod, 2.0);
+  // a ramp is interpolated exactly
+  for (int64_t step = 0; step <= 8; ++step)
+  {
+    EXPECT_NEAR(
+      1.0 + static_cast<double>(step) / 8.0,
+      interpolator.interpolate(2 * kPeriod + step * kSubPeriod), 1e-12);
+  }
+
+  // the interpolated command continues with the velocity of the ramp when it stops
+  interpolator.add_setpoint(3 * kPeriod, 2.0);
+  const double start = interpolator.interpolate(3 * kPeriod);
+  const double next = interpolator.interpolate(3 * kPeriod + kSubPeriod);
+  EXPECT_DOUBLE_EQ(2.0, start);
+  EXPECT_NEAR(1.0 / 8.0, (next - start), 0.05);
+  EXPECT_DOUBLE_EQ(2.0, interpolator.interpolate(4 * kPeriod));
+}
+
+TEST(TestCommandInterpolator, non_finite_setpoints_restart_the_interpolation)
+{
+  CommandInterpolator interpolator(CommandInterpolation::LINEAR);
+  interpolator.add_setpoint(0, 1.0);
+  interpolator.add_setpoint(kPeriod, std::numeric_limits<double>::quiet_NaN());
+  EXPECT_EQ(1u, interpolator.get_number_of_setpoints());
+  EXPECT_TRUE(std::isnan(interpolator.interpolate(kPeriod + kSubPeriod)));
+
+  interpolator.add_setpoint(2 * kPeriod, 3.0);
+  EXPECT_DOUBLE_EQ(3.0, interpolator.interpolate(2 * kPeriod + kSubPeriod));
+  interpolator.add_setpoint(3 * kPeriod, 4.0);
+  EXPECT_DOUBLE_EQ(3.5, interpolator.interpolate(3 * kPeriod + 4 * kSubPeriod));
+
+  interpolator.reset();
+  EXPECT_EQ(0u, interpolator.get_number_of_setpoints());
+  CommandInterpolator disabled(CommandInterpolation::NONE);
+  disabled.add_setpoint(0, 1.0);
+  disabled.add_setpoint(kPeriod, 2.0);
+  EXPECT_DOUBLE_EQ(2.0, disabled.interpolate(kPeriod));
+}
@@ -13,9 +13,12 @@
 // limitations under the License.
 
 #include <array>
+#include <chrono>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <vector>
@@ -777,6 +780,70 @@ class DummySystemPreparePerform : public hardware_interface::SystemInterface
   }
 };
 
+// Simulates a fieldbus master, that writes the states to and reads the commands from its process
+// image, which is bound to the interfaces
+class DummySystemProcessImage : public hardware_interface::SystemInterface
+{
+public:
+  struct ProcessImage
+  {
+    std::array<double, 3> positions = {0.0, 0.0, 0.0};
+    std::array<double, 3> velocity_commands = {0.0, 0.0, 0.0};
+    // big-endian velocities, not aligned
+    std::array<uint8_t, 3 * sizeof(double) + 1> raw_velocities = {};
+  };
+
+  CallbackReturn on_init(
+    const hardware_interface::HardwareComponentInterfaceParams & params) override
+  {
+    if (
+      hardware_interface::SystemInterface::on_init(params) !=
+      hardware_interface::CallbackReturn::SUCCESS)
+    {
+      return hardware_interface::CallbackReturn::ERROR;
+    }
+    for (size_t i = 0; i < 3; ++i)
+    {
+      const std::string joint = "joint" + std::to_string(i + 1);
+      bind_state_interface_memory(joint + "/position", &process_image.positions[i]);
+      bind_state_interface_memory(
+        joint + "/velocity",
+        process_image.raw_velocities.data() + 1 + i * sizeof(double),
+        hardware_interface::HandleDataType::DOUBLE,
+        hardware_interface::InterfaceMemory::ByteOrder::BIG);
+      bind_command_interface_memory(joint + "/velocity", &process_image.velocity_commands[i]);
+    }
+    EXPECT_THROW(
+      bind_state_interface_memory("joint1/nonexisting/interface", &process_image.positions[0]),
+      std::runtime_error);
+    return CallbackReturn::SUCCESS;
+  }
+
+  CallbackReturn on_configure(const rclcpp_lifecycle::State & /*previous_state*/) override
+  {
+    // the interfaces are already exported
+    EXPECT_THROW(
+      bind_state_interface_memory("joint1/position", &process_image.positions[0]),
+      std::runtime_error);
+    return CallbackReturn::SUCCESS;
+  }
+
+  hardware_interface::return_type read(
+    const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/) override
+  {
+    // the process image is updated by the fieldbus master, nothing to copy
+    return hardware_interface::return_type::OK;
+  }
+
+  hardware_interface::return_type write(
+    const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/) override
+  {
+    return hardware_interface::return_type::OK;
+  }
+
+  ProcessImage process_image;
+};
+
 }  // namespace test_components
 
 // BEGIN (Handle export change): for backward compatibility
@@ -1500,6 +1567,380 @@ TEST(TestComponentInterfaces, dummy_system_default)
   EXPECT_EQ(hardware_interface::return_type::OK, system_hw.perform_command_mode_switch({}, {}));
 }
 
+TEST(TestComponentInterfaces, dummy_system_bound_to_process_image)
+{
+  auto component = std::make_unique<test_components::DummySystemProcessImage>();
+  auto & process_image = component->process_image;
+  hardware_interface::System system_hw(std::move(component));
+
+  const std::string urdf_to_test =
+    std::string(ros2_control_test_assets::urdf_head) +
+    ros2_control_test_assets::valid_urdf_ros2_control_dummy_system_robot +
+    ros2_control_test_assets::urdf_tail;
+  const std::vector<hardware_interface::HardwareInfo> control_resources =
+    hardware_interface::parse_control_resources_from_urdf(urdf_to_test);
+  rclcpp::Node::SharedPtr node = std::make_shared<rclcpp::Node>("test_system_components");
+  hardware_interface::HardwareComponentParams params;
+  params.hardware_info = control_resources[0];
+  params.clock = node->get_clock();
+  params.logger = node->get_logger();
+  system_hw.initialize(params);
+
+  auto state_interfaces = system_hw.export_state_interfaces();
+  auto command_interfaces = system_hw.export_command_interfaces();
+  ASSERT_EQ(6u, state_interfaces.size());
+  ASSERT_EQ(3u, command_interfaces.size());
+  system_hw.configure();
+
+  auto si_joint2_pos = test_components::vector_contains(state_interfaces, "joint2/position").second;
+  auto si_joint2_vel = test_components::vector_contains(state_interfaces, "joint2/velocity").second;
+  auto ci_joint2_vel =
+    test_components::vector_contains(command_interfaces, "joint2/velocity").second;
+  const auto & position = state_interfaces[si_joint2_pos];
+  const auto & velocity = state_interfaces[si_joint2_vel];
+  auto & command = command_interfaces[ci_joint2_vel];
+  EXPECT_TRUE(position->is_bound_to_memory());
+  EXPECT_TRUE(command->is_bound_to_memory());
+
+  // values written by the fieldbus master are visible without calling read()
+  process_image.positions[1] = 1.5;
+  EXPECT_DOUBLE_EQ(1.5, position->get_optional().value());
+  // big-endian encoding of 2.0
+  process_image.raw_velocities[1 + sizeof(double)] = 0x40;
+  EXPECT_DOUBLE_EQ(2.0, velocity->get_optional().value());
+
+  // commands of the controllers end up in the process image without calling write()
+  ASSERT_TRUE(command->set_value(0.25));
+  EXPECT_DOUBLE_EQ(0.25, process_image.velocity_commands[1]);
+}
+
+TEST(TestComponentInterfaces, dummy_system_default_dirty_commands)
+{
+  auto component = std::make_unique<test_components::DummySystemDefault>();
+  auto * hardware = component.get();
+  hardware_interface::System system_hw(std::move(component));
+
+  const std::string urdf_to_test =
+    std::string(ros2_control_test_assets::urdf_head) +
+    ros2_control_test_assets::valid_urdf_ros2_control_dummy_system_robot +
+    ros2_control_test_assets::urdf_tail;
+  const std::vector<hardware_interface::HardwareInfo> control_resources =
+    hardware_interface::parse_control_resources_from_urdf(urdf_to_test);
+  rclcpp::Node::SharedPtr node = std::make_shared<rclcpp::Node>("test_system_components");
+  hardware_interface::HardwareComponentParams params;
+  params.hardware_info = control_resources[0];
+  params.clock = node->get_clock();
+  params.logger = node->get_logger();
+  system_hw.initialize(params);
+  auto command_interfaces = system_hw.export_command_interfaces();
+  ASSERT_EQ(3u, command_interfaces.size());
+
+  std::vector<std::string> dirty_commands;
+  auto collect = [&dirty_commands](const hardware_interface::CommandInterface & command)
+  { dirty_commands.push_back(command.get_name()); };
+  EXPECT_EQ(0u, hardware->for_each_dirty_command(collect));
+
+  auto ci_joint2_vel =
+    test_components::vector_contains(command_interfaces, "joint2/velocity").second;
+  ASSERT_TRUE(command_interfaces[ci_joint2_vel]->set_value(0.5));
+  EXPECT_EQ(1u, hardware->for_each_dirty_command(collect));
+  EXPECT_THAT(dirty_commands, testing::ElementsAre("joint2/velocity"));
+
+  // the command is transmitted and unchanged
+  ASSERT_TRUE(command_interfaces[ci_joint2_vel]->set_value(0.5));
+  EXPECT_EQ(0u, hardware->for_each_dirty_command(collect));
+
+  dirty_commands.clear();
+  hardware->mark_all_commands_dirty();
+  EXPECT_EQ(3u, hardware->for_each_dirty_command(collect));
+  EXPECT_THAT(
+    dirty_commands,
+    testing::UnorderedElementsAre("joint1/velocity", "joint2/velocity", "joint3/velocity"));
+}
+
+TEST(TestComponentInterfaces, dummy_system_default_dirty_commands_failed_transmission)
+{
+  auto component = std::make_unique<test_components::DummySystemDefault>();
+  auto * hardware = component.get();
+  hardware_interface::System system_hw(std::move(component));
+
+  const std::string urdf_to_test =
+    std::string(ros2_control_test_assets::urdf_head) +
+    ros2_control_test_assets::valid_urdf_ros2_control_dummy_system_robot +
+    ros2_control_test_assets::urdf_tail;
+  const std::vector<hardware_interface::HardwareInfo> control_resources =
+    hardware_interface::parse_control_resources_from_urdf(urdf_to_test);
+  rclcpp::Node::SharedPtr node = std::make_shared<rclcpp::Node>("test_system_components");
+  hardware_interface::HardwareComponentParams params;
+  params.hardware_info = control_resources[0];
+  params.clock = node->get_clock();
+  params.logger = node->get_logger();
+  system_hw.initialize(params);
+  auto command_interfaces = system_hw.export_command_interfaces();
+  auto ci_joint1_vel =
+    test_components::vector_contains(command_interfaces, "joint1/velocity").second;
+  auto ci_joint2_vel =
+    test_components::vector_contains(command_interfaces, "joint2/velocity").second;
+
+  // the bus rejects the command of joint1
+  std::vector<std::string> transmitted_commands;
+  auto transmit = [&transmitted_commands](const hardware_interface::CommandInterface & command)
+  {
+    if (command.get_name() == "joint1/velocity")
+    {
+      return false;
+    }
+    transmitted_commands.push_back(command.get_name());
+    return true;
+  };
+  ASSERT_TRUE(command_interfaces[ci_joint1_vel]->set_value(0.5));
+  ASSERT_TRUE(command_interfaces[ci_joint2_vel]->set_value(0.5));
+  EXPECT_EQ(2u, hardware->for_each_dirty_command(transmit));
+  EXPECT_THAT(transmitted_commands, testing::ElementsAre("joint2/velocity"));
+
+  // the failed command is retried although the controller sets the same value again
+  ASSERT_TRUE(command_interfaces[ci_joint1_vel]->set_value(0.5));
+  EXPECT_TRUE(command_interfaces[ci_joint1_vel]->is_dirty());
+  EXPECT_FALSE(command_interfaces[ci_joint2_vel]->is_dirty());
+  transmitted_commands.clear();
+  auto transmit_all = [&transmitted_commands](const hardware_interface::CommandInterface & command)
+  {
+    transmitted_commands.push_back(command.get_name());
+    return true;
+  };
+  EXPECT_EQ(1u, hardware->for_each_dirty_command(transmit_all));
+  EXPECT_THAT(transmitted_commands, testing::ElementsAre("joint1/velocity"));
+  EXPECT_EQ(0u, hardware->for_each_dirty_command(transmit_all));
+}
+
+TEST(TestComponentInterfaces, dummy_system_default_stale_states)
+{
+  hardware_interface::System system_hw(std::make_unique<test_components::DummySystemDefault>());
+
+  const std::string urdf_to_test =
+    std::string(ros2_control_test_assets::urdf_head) +
+    ros2_control_test_assets::valid_urdf_ros2_control_dummy_system_robot +
+    ros2_control_test_assets::urdf_tail;
+  const std::vector<hardware_interface::HardwareInfo> control_resources =
+    hardware_interface::parse_control_resources_from_urdf(urdf_to_test);
+  rclcpp::Node::SharedPtr node = std::make_shared<rclcpp::Node>("test_system_components");
+  hardware_interface::HardwareComponentParams params;
+  params.hardware_info = control_resources[0];
+  params.clock = node->get_clock();
+  params.logger = node->get_logger();
+  system_hw.initialize(params);
+  auto state_interfaces = system_hw.export_state_interfaces();
+  auto command_interfaces = system_hw.export_command_interfaces();
+  auto si_joint1_pos = test_components::vector_contains(state_interfaces, "joint1/position").second;
+  const auto & position = state_interfaces[si_joint1_pos];
+
+  // on_configure sets all states
+  system_hw.configure();
+  const auto sequence_after_configure = position->get_update_sequence();
+  EXPECT_GT(sequence_after_configure, 0u);
+
+  // the states are only updated in write, thus stale after each read, but only counted if the
+  // detection is enabled
+  const rclcpp::Time read_time(3, 0);
+  for (auto step = 0u; step < 3; ++step)
+  {
+    ASSERT_EQ(hardware_interface::return_type::OK, system_hw.read(read_time, PERIOD));
+  }
+  EXPECT_EQ(0u, system_hw.get_stale_read_cycles());
+  system_hw.set_stale_state_detection(true);
+  for (auto step = 0u; step < 3; ++step)
+  {
+    ASSERT_EQ(hardware_interface::return_type::OK, system_hw.read(read_time, PERIOD));
+  }
+  EXPECT_EQ(2u, system_hw.get_stale_read_cycles());
+  EXPECT_EQ(sequence_after_configure, position->get_update_sequence());
+
+  system_hw.activate();
+  const rclcpp::Time write_time(5, 0);
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.write(write_time, PERIOD));
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.read(write_time, PERIOD));
+  EXPECT_EQ(0u, system_hw.get_stale_read_cycles());
+  EXPECT_GT(position->get_update_sequence(), sequence_after_configure);
+  // stamped with the time of the read cycle preceding the write
+  EXPECT_EQ(read_time.nanoseconds(), position->get_update_time().value().nanoseconds());
+}
+
+TEST(TestComponentInterfaces, dummy_system_default_pipelined)
+{
+  hardware_interface::System system_hw(std::make_unique<test_components::DummySystemDefault>());
+
+  const std::string urdf_to_test =
+    std::string(ros2_control_test_assets::urdf_head) +
+    ros2_control_test_assets::valid_urdf_ros2_control_dummy_pipelined_system_robot +
+    ros2_control_test_assets::urdf_tail;
+  const std::vector<hardware_interface::HardwareInfo> control_resources =
+    hardware_interface::parse_control_resources_from_urdf(urdf_to_test);
+  rclcpp::Node::SharedPtr node = std::make_shared<rclcpp::Node>("test_system_components");
+  hardware_interface::HardwareComponentParams params;
+  params.hardware_info = control_resources[0];
+  params.clock = node->get_clock();
+  params.logger = node->get_logger();
+  system_hw.initialize(params);
+  auto state_interfaces = system_hw.export_state_interfaces();
+  auto command_interfaces = system_hw.export_command_interfaces();
+  ASSERT_EQ(6u, state_interfaces.size());
+  ASSERT_EQ(3u, command_interfaces.size());
+  system_hw.configure();
+  system_hw.activate();
+
+  auto si_joint1_pos = test_components::vector_contains(state_interfaces, "joint1/position").second;
+  auto ci_joint1_vel =
+    test_components::vector_contains(command_interfaces, "joint1/velocity").second;
+  const auto & position = state_interfaces[si_joint1_pos];
+  auto & command = command_interfaces[ci_joint1_vel];
+
+  // the command is handed over and written while the controllers are updated
+  ASSERT_TRUE(command->set_value(0.5));
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.read(rclcpp::Time(1, 0), PERIOD));
+  EXPECT_DOUBLE_EQ(0.0, position->get_optional().value());
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.write(rclcpp::Time(1, 0), PERIOD));
+
+  // the states read after the write are available one cycle later
+  ASSERT_TRUE(command->set_value(1.0));
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.read(rclcpp::Time(2, 0), PERIOD));
+  EXPECT_DOUBLE_EQ(0.5, position->get_optional().value());
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.write(rclcpp::Time(2, 0), PERIOD));
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.read(rclcpp::Time(3, 0), PERIOD));
+  EXPECT_DOUBLE_EQ(1.5, position->get_optional().value());
+
+  system_hw.deactivate();
+}
+
+TEST(TestComponentInterfaces, dummy_system_default_interpolated_commands)
+{
+  hardware_interface::System system_hw(std::make_unique<test_components::DummySystemDefault>());
+
+  const std::string urdf_to_test =
+    std::string(ros2_control_test_assets::urdf_head) +
+    ros2_control_test_assets::valid_urdf_ros2_control_dummy_interpolated_system_robot +
+    ros2_control_test_assets::urdf_tail;
+  const std::vector<hardware_interface::HardwareInfo> control_resources =
+    hardware_interface::parse_control_resources_from_urdf(urdf_to_test);
+  rclcpp::Node::SharedPtr node = std::make_shared<rclcpp::Node>("test_system_components");
+  hardware_interface::HardwareComponentParams params;
+  params.hardware_info = control_resources[0];
+  params.clock = node->get_clock();
+  params.logger = node->get_logger();
+  system_hw.initialize(params);
+  auto state_interfaces = system_hw.export_state_interfaces();
+  auto command_interfaces = system_hw.export_command_interfaces();
+  ASSERT_EQ(3u, command_interfaces.size());
+  system_hw.configure();
+  system_hw.activate();
+
+  auto si_joint1_vel = test_components::vector_contains(state_interfaces, "joint1/velocity").second;
+  auto ci_joint1_vel =
+    test_components::vector_contains(command_interfaces, "joint1/velocity").second;
+  const auto & velocity = state_interfaces[si_joint1_vel];
+  auto & command = command_interfaces[ci_joint1_vel];
+
+  // the setpoints of the controllers reach write() of the async thread through the interpolator
+  const auto wait_for_velocity = [&velocity](double expected_velocity)
+  {
+    for (auto attempt = 0u; attempt < 100u; ++attempt)
+    {
+      if (velocity->get_optional().value_or(0.0) == expected_velocity)
+      {
+        return true;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+  };
+  ASSERT_TRUE(command->set_value(0.5));
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.write(node->now(), PERIOD));
+  EXPECT_TRUE(wait_for_velocity(0.5));
+  ASSERT_TRUE(command->set_value(1.0));
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.write(node->now(), PERIOD));
+  // the interpolated command reaches the latest setpoint one period after it
+  EXPECT_TRUE(wait_for_velocity(1.0));
+
+  system_hw.deactivate();
+}
+
+TEST(TestComponentInterfaces, dummy_system_default_extrapolated_states)
+{
+  hardware_interface::System system_hw(std::make_unique<test_components::DummySystemDefault>());
+
+  const std::string urdf_to_test =
+    std::string(ros2_control_test_assets::urdf_head) +
+    ros2_control_test_assets::valid_urdf_ros2_control_dummy_extrapolated_system_robot +
+    ros2_control_test_assets::urdf_tail;
+  const std::vector<hardware_interface::HardwareInfo> control_resources =
+    hardware_interface::parse_control_resources_from_urdf(urdf_to_test);
+  rclcpp::Node::SharedPtr node = std::make_shared<rclcpp::Node>("test_system_components");
+  hardware_interface::HardwareComponentParams params;
+  params.hardware_info = control_resources[0];
+  params.clock = node->get_clock();
+  params.logger = node->get_logger();
+  system_hw.initialize(params);
+  auto state_interfaces = system_hw.export_state_interfaces();
+  auto command_interfaces = system_hw.export_command_interfaces();
+  ASSERT_EQ(6u, state_interfaces.size());
+  system_hw.configure();
+  system_hw.activate();
+
+  std::vector<hardware_interface::StateInterface::ConstSharedPtr> positions;
+  for (const auto & name : {"joint1/position", "joint2/position", "joint3/position"})
+  {
+    positions.push_back(
+      state_interfaces[test_components::vector_contains(state_interfaces, name).second]);
+  }
+  for (auto & command : command_interfaces)
+  {
+    ASSERT_TRUE(command->set_value(0.5));
+  }
+
+  // the states updated by the component are handed over in the read cycle of the resource manager
+  const rclcpp::Time start(1, 0, RCL_ROS_TIME);
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.read(start, PERIOD));
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.write(start, PERIOD));
+  system_hw.extrapolate_states(start + PERIOD);
+  for (const auto & position : positions)
+  {
+    EXPECT_DOUBLE_EQ(0.5, position->get_optional().value());
+    EXPECT_FALSE(position->is_predicted());
+  }
+
+  std::vector<uint64_t> update_sequences;
+  for (const auto & position : positions)
+  {
+    update_sequences.push_back(position->get_update_sequence());
+  }
+
+  // the component is not read in the next cycles due to its rw_rate, the states are predicted
+  // from the velocity of the latest sample, or held
+  const auto prediction_time = start + rclcpp::Duration::from_seconds(0.004);
+  system_hw.extrapolate_states(prediction_time);
+  for (size_t i = 0; i < positions.size(); ++i)
+  {
+    EXPECT_TRUE(positions[i]->is_predicted());
+    // predictions are no new samples for the controllers updated on state updates
+    EXPECT_EQ(update_sequences[i], positions[i]->get_update_sequence());
+  }
+  EXPECT_NEAR(0.502, positions[0]->get_optional().value(), 1e-9);
+  EXPECT_NEAR(0.502, positions[1]->get_optional().value(), 1e-9);
+  EXPECT_DOUBLE_EQ(0.5, positions[2]->get_optional().value());
+
+  // the states of the next read cycle replace the predictions
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.read(start + PERIOD * 10.0, PERIOD));
+  ASSERT_EQ(hardware_interface::return_type::OK, system_hw.write(start + PERIOD * 10.0, PERIOD));
+  system_hw.extrapolate_states(start + PERIOD * 10.0);
+  for (size_t i = 0; i < positions.size(); ++i)
+  {
+    EXPECT_DOUBLE_EQ(1.0, positions[i]->get_optional().value());
+    EXPECT_FALSE(positions[i]->is_predicted());
+    EXPECT_GT(positions[i]->get_update_sequence(), update_sequences[i]);
+  }
+
+  system_hw.deactivate();
+}
+
 TEST(TestComponentInterfaces, dummy_command_mode_system)
 {
   hardware_interface::System system_hw(
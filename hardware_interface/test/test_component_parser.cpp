@@ -11,6 +11,9 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
+#include <chrono>
+#include <cmath>
+#include <cstdint>
 #include <string>
 
 #include "gmock/gmock.h"
@@ -1099,6 +1102,55 @@ TEST_F(
   EXPECT_EQ(hardware_info.gpios[0].state_interfaces[1].size, 1);
 }
 
+TEST_F(TestComponentParser, successfully_parse_valid_urdf_system_with_native_data_types)
+{
+  std::string urdf_to_test = std::string(ros2_control_test_assets::urdf_head) +
+                             ros2_control_test_assets::
+                               valid_urdf_ros2_control_system_robot_with_native_data_types +
+                             ros2_control_test_assets::urdf_tail;
+  const auto control_hardware = parse_control_resources_from_urdf(urdf_to_test);
+  ASSERT_THAT(control_hardware, SizeIs(1));
+  auto hardware_info = control_hardware.front();
+
+  EXPECT_EQ(hardware_info.name, "RRBotSystemWithNativeDataTypes");
+  ASSERT_THAT(hardware_info.joints, SizeIs(1));
+  ASSERT_THAT(hardware_info.joints[0].command_interfaces, SizeIs(1));
+  EXPECT_EQ(hardware_info.joints[0].command_interfaces[0].data_type, "float");
+  ASSERT_THAT(hardware_info.joints[0].state_interfaces, SizeIs(3));
+  EXPECT_EQ(hardware_info.joints[0].state_interfaces[0].data_type, "float");
+  EXPECT_EQ(hardware_info.joints[0].state_interfaces[1].data_type, "int32");
+  EXPECT_EQ(hardware_info.joints[0].state_interfaces[2].data_type, "int64");
+  ASSERT_THAT(hardware_info.gpios, SizeIs(1));
+  ASSERT_THAT(hardware_info.gpios[0].command_interfaces, SizeIs(1));
+  EXPECT_EQ(hardware_info.gpios[0].command_interfaces[0].data_type, "uint8");
+  ASSERT_THAT(hardware_info.gpios[0].state_interfaces, SizeIs(1));
+  EXPECT_EQ(hardware_info.gpios[0].state_interfaces[0].data_type, "uint16");
+
+  hardware_interface::InterfaceDescription float_cmd_description(
+    hardware_info.joints[0].name, hardware_info.joints[0].command_interfaces[0]);
+  auto float_cmd_itf = hardware_interface::CommandInterface(float_cmd_description);
+  ASSERT_EQ(hardware_interface::HandleDataType::FLOAT, float_cmd_itf.get_data_type());
+  EXPECT_TRUE(std::isnan(float_cmd_itf.get_optional<float>().value()));
+
+  hardware_interface::InterfaceDescription int32_state_description(
+    hardware_info.joints[0].name, hardware_info.joints[0].state_interfaces[1]);
+  auto int32_state_itf = hardware_interface::StateInterface(int32_state_description);
+  ASSERT_EQ(hardware_interface::HandleDataType::INT32, int32_state_itf.get_data_type());
+  EXPECT_EQ(-1024, int32_state_itf.get_optional<int32_t>().value());
+
+  hardware_interface::InterfaceDescription uint8_cmd_description(
+    hardware_info.gpios[0].name, hardware_info.gpios[0].command_interfaces[0]);
+  auto uint8_cmd_itf = hardware_interface::CommandInterface(uint8_cmd_description);
+  ASSERT_EQ(hardware_interface::HandleDataType::UINT8, uint8_cmd_itf.get_data_type());
+  EXPECT_EQ(0u, uint8_cmd_itf.get_optional<uint8_t>().value());
+
+  hardware_interface::InterfaceDescription uint16_state_description(
+    hardware_info.gpios[0].name, hardware_info.gpios[0].state_interfaces[0]);
+  auto uint16_state_itf = hardware_interface::StateInterface(uint16_state_description);
+  ASSERT_EQ(hardware_interface::HandleDataType::UINT16, uint16_state_itf.get_data_type());
+  EXPECT_EQ(65535u, uint16_state_itf.get_optional<uint16_t>().value());
+}
+
 TEST_F(TestComponentParser, successfully_parse_valid_urdf_system_and_disabled_interfaces)
 {
   std::string urdf_to_test =
@@ -1567,6 +1619,71 @@ TEST_F(TestComponentParser, successfully_parse_valid_urdf_async_components)
     hardware_info.async_params.cpu_affinity_cores, testing::ContainerEq(std::vector<int>({1})));
 }
 
+TEST_F(TestComponentParser, successfully_parse_valid_urdf_pipelined_component)
+{
+  std::string urdf_to_test = std::string(ros2_control_test_assets::urdf_head) +
+                             ros2_control_test_assets::valid_urdf_ros2_control_dummy_system_robot +
+                             ros2_control_test_assets::urdf_tail;
+  auto control_hardware = parse_control_resources_from_urdf(urdf_to_test);
+  ASSERT_THAT(control_hardware, SizeIs(1));
+  EXPECT_FALSE(control_hardware[0].async_params.pipelined);
+
+  urdf_to_test = std::string(ros2_control_test_assets::urdf_head) +
+                 ros2_control_test_assets::valid_urdf_ros2_control_dummy_pipelined_system_robot +
+                 ros2_control_test_assets::urdf_tail;
+  control_hardware = parse_control_resources_from_urdf(urdf_to_test);
+  ASSERT_THAT(control_hardware, SizeIs(1));
+  EXPECT_TRUE(control_hardware[0].is_async);
+  EXPECT_TRUE(control_hardware[0].async_params.pipelined);
+  EXPECT_EQ(control_hardware[0].async_params.scheduling_policy, "synchronized");
+
+  // the hand-over of the values needs the async thread triggered in each cycle
+  urdf_to_test = std::string(ros2_control_test_assets::urdf_head) +
+                 ros2_control_test_assets::invalid_urdf_ros2_control_pipelined_detached_system +
+                 ros2_control_test_assets::urdf_tail;
+  EXPECT_THROW(parse_control_resources_from_urdf(urdf_to_test), std::runtime_error);
+}
+
+TEST_F(TestComponentParser, successfully_parse_valid_urdf_deadline_scheduled_component)
+{
+  std::string urdf_to_test =
+    std::string(ros2_control_test_assets::urdf_head) +
+    ros2_control_test_assets::valid_urdf_ros2_control_dummy_deadline_scheduled_system_robot +
+    ros2_control_test_assets::urdf_tail;
+  auto control_hardware = parse_control_resources_from_urdf(urdf_to_test);
+  ASSERT_THAT(control_hardware, SizeIs(1));
+  const auto & deadline_scheduling = control_hardware[0].async_params.deadline_scheduling;
+  EXPECT_TRUE(deadline_scheduling.is_enabled());
+  EXPECT_EQ(deadline_scheduling.runtime, std::chrono::microseconds(300));
+  EXPECT_EQ(deadline_scheduling.deadline, std::chrono::microseconds(1000));
+  // resolved with the rw_rate by the component
+  EXPECT_EQ(deadline_scheduling.period, std::chrono::microseconds(0));
+
+  urdf_to_test =
+    std::string(ros2_control_test_assets::urdf_head) +
+    ros2_control_test_assets::invalid_urdf_ros2_control_sched_deadline_without_runtime_system +
+    ros2_control_test_assets::urdf_tail;
+  EXPECT_THROW(parse_control_resources_from_urdf(urdf_to_test), std::runtime_error);
+}
+
+TEST_F(TestComponentParser, successfully_parse_valid_urdf_realtime_memory_arena_size)
+{
+  std::string urdf_to_test = std::string(ros2_control_test_assets::urdf_head) +
+                             ros2_control_test_assets::valid_urdf_ros2_control_dummy_system_robot +
+                             ros2_control_test_assets::urdf_tail;
+  auto control_hardware = parse_control_resources_from_urdf(urdf_to_test);
+  ASSERT_THAT(control_hardware, SizeIs(1));
+  EXPECT_EQ(0u, control_hardware[0].realtime_memory_arena_size);
+
+  urdf_to_test =
+    std::string(ros2_control_test_assets::urdf_head) +
+    ros2_control_test_assets::valid_urdf_ros2_control_system_with_realtime_memory_arena +
+    ros2_control_test_assets::urdf_tail;
+  control_hardware = parse_control_resources_from_urdf(urdf_to_test);
+  ASSERT_THAT(control_hardware, SizeIs(1));
+  EXPECT_EQ(65536u, control_hardware[0].realtime_memory_arena_size);
+}
+
 TEST_F(TestComponentParser, successfully_parse_parameter_empty)
 {
   const std::string urdf_to_test =
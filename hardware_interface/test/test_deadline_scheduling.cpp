@@ -0,0 +1,84 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <signal.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+
+#include "hardware_interface/deadline_scheduling.hpp"
+
+using hardware_interface::DeadlineOverrunCounter;
+using hardware_interface::DeadlineSchedulingParams;
+using namespace std::chrono_literals;
+
+TEST(TestDeadlineScheduling, resolve_params)
+{
+  DeadlineSchedulingParams params;
+  EXPECT_FALSE(params.is_enabled());
+  EXPECT_THROW(
+    hardware_interface::resolve_deadline_scheduling_params(params, 1000us), std::invalid_argument);
+
+  // the deadline and the period default to the period of the loop
+  params.runtime = 200us;
+  auto resolved = hardware_interface::resolve_deadline_scheduling_params(params, 1000us);
+  EXPECT_TRUE(resolved.is_enabled());
+  EXPECT_EQ(200us, resolved.runtime);
+  EXPECT_EQ(1000us, resolved.deadline);
+  EXPECT_EQ(1000us, resolved.period);
+
+  params.deadline = 500us;
+  params.period = 2000us;
+  resolved = hardware_interface::resolve_deadline_scheduling_params(params, 1000us);
+  EXPECT_EQ(500us, resolved.deadline);
+  EXPECT_EQ(2000us, resolved.period);
+
+  params.runtime = 600us;
+  EXPECT_THROW(
+    hardware_interface::resolve_deadline_scheduling_params(params, 1000us), std::invalid_argument);
+  params.runtime = 200us;
+  params.deadline = 3000us;
+  EXPECT_THROW(
+    hardware_interface::resolve_deadline_scheduling_params(params, 1000us), std::invalid_argument);
+}
+
+TEST(TestDeadlineScheduling, count_overruns_of_attached_thread)
+{
+  DeadlineOverrunCounter counter;
+  EXPECT_EQ(0u, counter.get_count());
+
+  std::thread thread(
+    [&counter]()
+    {
+      DeadlineSchedulingParams params;
+      params.runtime = 900us;
+      // the reservation may be rejected without permissions, the handler is installed anyway
+      std::ignore = hardware_interface::configure_sched_deadline(
+        hardware_interface::resolve_deadline_scheduling_params(params, 1000us));
+      ASSERT_TRUE(counter.attach_to_current_thread());
+      // SIGXCPU is sent to the thread overrunning its runtime
+      raise(SIGXCPU);
+      raise(SIGXCPU);
+    });
+  thread.join();
+  EXPECT_EQ(2u, counter.get_count());
+
+  // the overruns of the detached thread are kept, other threads aren't counted
+  counter.detach();
+  raise(SIGXCPU);
+  EXPECT_EQ(2u, counter.get_count());
+}
@@ -12,6 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <thread>
 
 #include "gmock/gmock.h"
@@ -22,8 +29,10 @@
 #include "hardware_interface/hardware_info.hpp"
 
 using hardware_interface::CommandInterface;
+using hardware_interface::HandleDataType;
 using hardware_interface::InterfaceDescription;
 using hardware_interface::InterfaceInfo;
+using hardware_interface::InterfaceMemory;
 using hardware_interface::StateInterface;
 
 namespace
@@ -293,6 +302,54 @@ TEST(TestHandle, handle_constructor_bool_data_type)
   ASSERT_THROW({ std::ignore = handle.set_value(0.0); }, std::runtime_error);
 }
 
+TEST(TestHandle, handle_constructor_native_numeric_data_types)
+{
+  const std::string itf_name = "joint1";
+  StateInterface float_handle{itf_name, "position", "float", "1.5"};
+  ASSERT_EQ(hardware_interface::HandleDataType::FLOAT, float_handle.get_data_type());
+  ASSERT_EQ(float_handle.get_optional<float>().value(), 1.5f);
+  ASSERT_TRUE(float_handle.set_value(2.5f));
+  ASSERT_EQ(float_handle.get_optional<float>().value(), 2.5f);
+  ASSERT_EQ(float_handle.get_optional(), 2.5);
+  StateInterface float_nan_handle{itf_name, "velocity", "float"};
+  ASSERT_TRUE(std::isnan(float_nan_handle.get_optional<float>().value()));
+
+  StateInterface int32_handle{itf_name, "encoder_counts", "int32", "-42"};
+  ASSERT_EQ(hardware_interface::HandleDataType::INT32, int32_handle.get_data_type());
+  ASSERT_TRUE(int32_handle.is_castable_to_double());
+  ASSERT_EQ(int32_handle.get_optional<int32_t>().value(), -42);
+  ASSERT_TRUE(int32_handle.set_value(int32_t{1000}));
+  ASSERT_EQ(int32_handle.get_optional<int32_t>().value(), 1000);
+  ASSERT_EQ(int32_handle.get_optional(), 1000.0);
+
+  StateInterface int64_handle{itf_name, "timestamp", "int64", "-9223372036854775807"};
+  ASSERT_EQ(hardware_interface::HandleDataType::INT64, int64_handle.get_data_type());
+  ASSERT_EQ(int64_handle.get_optional<int64_t>().value(), -9223372036854775807);
+
+  CommandInterface uint8_handle{itf_name, "digital_outputs", "uint8"};
+  ASSERT_EQ(hardware_interface::HandleDataType::UINT8, uint8_handle.get_data_type());
+  ASSERT_EQ(uint8_handle.get_optional<uint8_t>().value(), 0u) << "Default value should be 0";
+  ASSERT_TRUE(uint8_handle.set_value(uint8_t{0b1010}));
+  ASSERT_EQ(uint8_handle.get_optional<uint8_t>().value(), 0b1010);
+
+  StateInterface uint16_handle{itf_name, "status_word", "uint16", "65535"};
+  ASSERT_EQ(hardware_interface::HandleDataType::UINT16, uint16_handle.get_data_type());
+  ASSERT_EQ(uint16_handle.get_optional<uint16_t>().value(), 65535u);
+  ASSERT_EQ(uint16_handle.get_optional(), 65535.0);
+
+  // Test the assertions
+  ASSERT_THROW({ std::ignore = int32_handle.get_optional<int64_t>(); }, std::runtime_error);
+  ASSERT_THROW({ std::ignore = int32_handle.set_value(int64_t{1}); }, std::runtime_error);
+  ASSERT_THROW({ std::ignore = uint16_handle.set_value(1.0); }, std::runtime_error);
+  EXPECT_THROW(
+    { StateInterface bad_itf(itf_name, "counts", "int32", "1.5"); }, std::invalid_argument)
+    << "Non integer value should throw";
+  EXPECT_THROW({ StateInterface bad_itf(itf_name, "bits", "uint8", "256"); }, std::invalid_argument)
+    << "Out of range value should throw";
+  EXPECT_THROW({ StateInterface bad_itf(itf_name, "bits", "uint16", "-1"); }, std::invalid_argument)
+    << "Negative value should throw for unsigned types";
+}
+
 TEST(TestHandle, interface_description_unknown_data_type)
 {
   const std::string collision_interface = "collision";
@@ -426,3 +483,309 @@ TEST(TestHandle, move_assignment)
   EXPECT_DOUBLE_EQ(moved.get_optional().value(), 0.0);
 }
 #pragma GCC diagnostic pop
+
+TEST(TestHandle, interface_bound_to_native_memory)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.initial_value = "1.0";
+  InterfaceDescription description(JOINT_NAME, info);
+  double process_image = 2.0;
+  description.bind_memory(&process_image);
+
+  StateInterface state{description};
+  EXPECT_TRUE(state.is_bound_to_memory());
+  // the initial value is not written to the memory, the values are accessed in place
+  EXPECT_DOUBLE_EQ(2.0, state.get_optional().value());
+  process_image = 3.0;
+  EXPECT_DOUBLE_EQ(3.0, state.get_optional().value());
+  ASSERT_TRUE(state.set_value(4.0));
+  EXPECT_DOUBLE_EQ(4.0, process_image);
+
+  // copies share the memory
+  StateInterface copy(state);
+  process_image = 5.0;
+  EXPECT_DOUBLE_EQ(5.0, copy.get_optional().value());
+
+  info.data_type = "int32";
+  info.initial_value = "";
+  InterfaceDescription int_description(JOINT_NAME, info);
+  int32_t int_process_image = -3;
+  int_description.bind_memory(&int_process_image);
+  CommandInterface command{int_description};
+  EXPECT_EQ(-3, command.get_optional<int32_t>().value());
+  EXPECT_DOUBLE_EQ(-3.0, command.get_optional().value());
+  ASSERT_TRUE(command.set_value<int32_t>(7));
+  EXPECT_EQ(7, int_process_image);
+  EXPECT_THROW({ std::ignore = command.get_optional<int64_t>(); }, std::runtime_error);
+  EXPECT_THROW({ std::ignore = command.set_value(1.0); }, std::runtime_error);
+}
+
+TEST(TestHandle, interface_bound_to_big_endian_unaligned_memory)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.data_type = "uint16";
+  InterfaceDescription description(JOINT_NAME, info);
+  alignas(alignof(uint16_t)) std::array<uint8_t, 3> process_image = {0x00, 0x12, 0x34};
+  description.bind_memory(
+    process_image.data() + 1, HandleDataType::UINT16, InterfaceMemory::ByteOrder::BIG);
+  EXPECT_EQ(1u, description.memory.alignment);
+
+  StateInterface state{description};
+  EXPECT_EQ(0x1234, state.get_optional<uint16_t>().value());
+  EXPECT_DOUBLE_EQ(4660.0, state.get_optional().value());
+  ASSERT_TRUE(state.set_value<uint16_t>(0xABCD));
+  EXPECT_THAT(process_image, testing::ElementsAre(0x00, 0xAB, 0xCD));
+
+  info.data_type = "double";
+  info.size = 2;
+  InterfaceDescription array_description(JOINT_NAME, info);
+  std::array<double, 2> values = {1.0, 2.0};
+  std::array<uint8_t, 2 * sizeof(double)> array_image;
+  for (size_t i = 0; i < values.size(); ++i)
+  {
+    std::memcpy(array_image.data() + i * sizeof(double), &values[i], sizeof(double));
+    std::reverse(
+      array_image.begin() + i * sizeof(double), array_image.begin() + (i + 1) * sizeof(double));
+  }
+  array_description.bind_memory(
+    array_image.data(), HandleDataType::DOUBLE, InterfaceMemory::ByteOrder::BIG);
+  CommandInterface command{array_description};
+  std::array<double, 2> read_values;
+  ASSERT_TRUE(command.get_array_values<double>(read_values));
+  // on a big-endian host the values are accessed in place
+  EXPECT_EQ(values, read_values);
+
+  const std::array<double, 2> new_values = {3.0, 4.0};
+  ASSERT_TRUE(command.set_array_values<double>(new_values));
+  ASSERT_TRUE(command.get_array_values<double>(read_values));
+  EXPECT_EQ(new_values, read_values);
+}
+
+TEST(TestHandle, bind_memory_of_wrong_type_throws)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.data_type = "float";
+  InterfaceDescription description(JOINT_NAME, info);
+  double double_image = 0.0;
+  float * null_image = nullptr;
+  EXPECT_THROW(description.bind_memory(&double_image), std::invalid_argument);
+  EXPECT_THROW(description.bind_memory(null_image), std::invalid_argument);
+  EXPECT_THROW(
+    description.bind_memory(&double_image, HandleDataType::DOUBLE), std::invalid_argument);
+  EXPECT_EQ(nullptr, description.memory.data);
+
+  StateInterface state{description};
+  EXPECT_FALSE(state.is_bound_to_memory());
+}
+
+TEST(TestHandle, command_interface_dirty_tracking)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.initial_value = "0.0";
+  CommandInterface command{InterfaceDescription(JOINT_NAME, info)};
+  EXPECT_FALSE(command.is_dirty());
+  EXPECT_EQ(0u, command.get_change_count());
+
+  ASSERT_TRUE(command.set_value(1.0));
+  EXPECT_TRUE(command.is_dirty());
+  command.clear_dirty();
+  EXPECT_FALSE(command.is_dirty());
+
+  // setting the same value again is not a change
+  ASSERT_TRUE(command.set_value(1.0));
+  ASSERT_TRUE(command.set_limited_value(1.0));
+  EXPECT_FALSE(command.is_dirty());
+  EXPECT_EQ(1u, command.get_change_count());
+
+  ASSERT_TRUE(command.set_value(std::numeric_limits<double>::quiet_NaN()));
+  command.clear_dirty();
+  ASSERT_TRUE(command.set_value(std::numeric_limits<double>::quiet_NaN()));
+  EXPECT_FALSE(command.is_dirty());
+
+  command.mark_dirty();
+  EXPECT_TRUE(command.is_dirty());
+
+  info.data_type = "int32";
+  info.initial_value = "0";
+  info.size = 2;
+  CommandInterface array_command{InterfaceDescription(JOINT_NAME, info)};
+  const std::array<int32_t, 2> values = {1, 2};
+  ASSERT_TRUE(array_command.set_array_values<int32_t>(values));
+  EXPECT_TRUE(array_command.is_dirty());
+  array_command.clear_dirty();
+  ASSERT_TRUE(array_command.set_array_values<int32_t>(values));
+  EXPECT_FALSE(array_command.is_dirty());
+}
+
+TEST(TestHandle, update_sequence_counts_all_updates)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.initial_value = "0.0";
+  StateInterface state{InterfaceDescription(JOINT_NAME, info)};
+  EXPECT_EQ(0u, state.get_update_sequence());
+  EXPECT_EQ(RCL_CLOCK_UNINITIALIZED, state.get_update_time().value().get_clock_type());
+
+  ASSERT_TRUE(state.set_value(1.0));
+  ASSERT_TRUE(state.set_value(1.0));
+  EXPECT_EQ(2u, state.get_update_sequence());
+  EXPECT_EQ(1u, state.get_change_count());
+
+  {
+    std::unique_lock<std::shared_mutex> lock(state.get_mutex());
+    state.set_update_time(lock, rclcpp::Time(1, 500, RCL_STEADY_TIME));
+  }
+  const auto update_time = state.get_update_time();
+  ASSERT_TRUE(update_time.has_value());
+  EXPECT_EQ(1000000500, update_time->nanoseconds());
+  EXPECT_EQ(RCL_STEADY_TIME, update_time->get_clock_type());
+
+  StateInterface copy(state);
+  EXPECT_EQ(2u, copy.get_update_sequence());
+  EXPECT_EQ(1000000500, copy.get_update_time()->nanoseconds());
+}
+
+TEST(TestHandle, copy_values_from_other_interface)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.initial_value = "0.0";
+  StateInterface source{InterfaceDescription(JOINT_NAME, info)};
+  StateInterface destination{InterfaceDescription(JOINT_NAME, info)};
+  ASSERT_TRUE(source.set_value(1.5));
+  {
+    std::unique_lock<std::shared_mutex> lock(source.get_mutex());
+    source.set_update_time(lock, rclcpp::Time(2, 0, RCL_STEADY_TIME));
+  }
+
+  ASSERT_TRUE(destination.copy_values_from(source));
+  EXPECT_DOUBLE_EQ(1.5, destination.get_optional().value());
+  EXPECT_EQ(1u, destination.get_change_count());
+  EXPECT_EQ(2000000000, destination.get_update_time()->nanoseconds());
+  // copying the same values again is an update without change
+  ASSERT_TRUE(destination.copy_values_from(source));
+  EXPECT_EQ(1u, destination.get_change_count());
+  EXPECT_EQ(2u, destination.get_update_sequence());
+
+  // the values of interfaces bound to memory are copied as well
+  double process_image = 3.0;
+  InterfaceDescription bound_description(JOINT_NAME, info);
+  bound_description.bind_memory(&process_image);
+  CommandInterface bound_command{bound_description};
+  ASSERT_TRUE(bound_command.copy_values_from(destination));
+  EXPECT_DOUBLE_EQ(1.5, process_image);
+
+  info.data_type = "uint16";
+  info.initial_value = "[1, 2, 3]";
+  info.size = 3;
+  StateInterface array_source{InterfaceDescription(JOINT_NAME, info)};
+  info.initial_value = "0";
+  StateInterface array_destination{InterfaceDescription(JOINT_NAME, info)};
+  ASSERT_TRUE(array_destination.copy_values_from(array_source));
+  std::array<uint16_t, 3> values;
+  ASSERT_TRUE(array_destination.get_array_values<uint16_t>(values));
+  EXPECT_THAT(values, testing::ElementsAre(1u, 2u, 3u));
+
+  // the data types and sizes have to match
+  EXPECT_THROW({ std::ignore = destination.copy_values_from(array_source); }, std::runtime_error);
+  info.size = 2;
+  StateInterface smaller_array{InterfaceDescription(JOINT_NAME, info)};
+  EXPECT_THROW(
+    { std::ignore = smaller_array.copy_values_from(array_source); }, std::runtime_error);
+
+  // locked interfaces are not copied
+  std::unique_lock<std::shared_mutex> lock(source.get_mutex());
+  EXPECT_FALSE(destination.copy_values_from(source));
+}
+
+TEST(TestHandle, published_copy_is_read_without_locking)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.initial_value = "1.0";
+  StateInterface state{InterfaceDescription(JOINT_NAME, info)};
+  EXPECT_FALSE(state.has_published_copy());
+  ASSERT_TRUE(state.enable_published_copy());
+  EXPECT_TRUE(state.has_published_copy());
+  EXPECT_DOUBLE_EQ(1.0, state.get_optional().value());
+  ASSERT_TRUE(state.set_value(2.0));
+  {
+    // a writer holding the lock doesn't make the reads fail
+    std::unique_lock<std::shared_mutex> lock(state.get_mutex());
+    EXPECT_DOUBLE_EQ(2.0, state.get_optional().value());
+  }
+
+  info.data_type = "int32";
+  info.initial_value = "-4";
+  StateInterface int_state{InterfaceDescription(JOINT_NAME, info)};
+  ASSERT_TRUE(int_state.enable_published_copy());
+  EXPECT_EQ(-4, int_state.get_optional<int32_t>().value());
+  EXPECT_DOUBLE_EQ(-4.0, int_state.get_optional().value());
+  EXPECT_THROW({ std::ignore = int_state.get_optional<int64_t>(); }, std::runtime_error);
+
+  // arrays spanning multiple words of the copy
+  info.data_type = "uint8";
+  info.initial_value = "0";
+  info.size = 9;
+  StateInterface array_state{InterfaceDescription(JOINT_NAME, info)};
+  ASSERT_TRUE(array_state.enable_published_copy());
+  const std::array<uint8_t, 9> written = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+  ASSERT_TRUE(array_state.set_array_values<uint8_t>(written));
+  std::array<uint8_t, 9> values;
+  {
+    std::unique_lock<std::shared_mutex> lock(array_state.get_mutex());
+    ASSERT_TRUE(array_state.get_array_values<uint8_t>(values));
+  }
+  EXPECT_EQ(written, values);
+  EXPECT_THROW({ std::ignore = array_state.get_optional<uint8_t>(); }, std::runtime_error);
+
+  // the values bound to memory are written without the interface
+  info.data_type = "double";
+  info.initial_value = "";
+  info.size = 1;
+  double process_image = 3.0;
+  InterfaceDescription bound_description(JOINT_NAME, info);
+  bound_description.bind_memory(&process_image);
+  StateInterface bound_state{bound_description};
+  EXPECT_FALSE(bound_state.enable_published_copy());
+  EXPECT_FALSE(bound_state.has_published_copy());
+}
+
+TEST(TestHandle, published_copy_is_consistent_while_written)
+{
+  InterfaceInfo info;
+  info.name = FOO_INTERFACE;
+  info.data_type = "int64";
+  info.initial_value = "0";
+  info.size = 4;
+  StateInterface state{InterfaceDescription(JOINT_NAME, info)};
+  ASSERT_TRUE(state.enable_published_copy());
+
+  std::atomic_bool stop = false;
+  std::thread writer(
+    [&state, &stop]()
+    {
+      for (int64_t i = 1; !stop; ++i)
+      {
+        const std::array<int64_t, 4> written = {i, i, i, i};
+        std::ignore = state.set_array_values<int64_t>(written);
+      }
+    });
+  size_t successful_reads = 0;
+  for (size_t i = 0; i < 100000; ++i)
+  {
+    std::array<int64_t, 4> values;
+    if (state.get_array_values<int64_t>(values))
+    {
+      ++successful_reads;
+      EXPECT_THAT(values, testing::Each(values[0]));
+    }
+  }
+  stop = true;
+  writer.join();
+  EXPECT_GT(successful_reads, 0u);
+}
@@ -0,0 +1,294 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "hardware_interface/handle.hpp"
+#include "hardware_interface/hardware_info.hpp"
+#include "hardware_interface/interface_accessor.hpp"
+#include "hardware_interface/system.hpp"
+#include "hardware_interface/system_interface.hpp"
+#include "hardware_interface/types/hardware_interface_type_values.hpp"
+#include "rclcpp/logging.hpp"
+#include "rclcpp/node.hpp"
+
+using hardware_interface::CommandInterface;
+using hardware_interface::CommandInterfaceAccessor;
+using hardware_interface::CommandInterfaceArrayAccessor;
+using hardware_interface::InterfaceDescription;
+using hardware_interface::InterfaceInfo;
+using hardware_interface::StateInterface;
+using hardware_interface::StateInterfaceAccessor;
+using hardware_interface::StateInterfaceArrayAccessor;
+
+namespace
+{
+InterfaceDescription make_description(
+  const std::string & name, const std::string & data_type, const std::string & initial_value,
+  int size = 1)
+{
+  InterfaceInfo info;
+  info.name = name;
+  info.data_type = data_type;
+  info.initial_value = initial_value;
+  info.size = size;
+  return InterfaceDescription("joint1", info);
+}
+
+class BenchmarkSystem : public hardware_interface::SystemInterface
+{
+public:
+  hardware_interface::return_type read(
+    const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/) override
+  {
+    return hardware_interface::return_type::OK;
+  }
+
+  hardware_interface::return_type write(
+    const rclcpp::Time & /*time*/, const rclcpp::Duration & /*period*/) override
+  {
+    return hardware_interface::return_type::OK;
+  }
+};
+
+hardware_interface::HardwareInfo make_hardware_info(size_t number_of_joints)
+{
+  hardware_interface::HardwareInfo info;
+  info.name = "benchmark_system";
+  info.type = "system";
+  InterfaceInfo position;
+  position.name = hardware_interface::HW_IF_POSITION;
+  position.initial_value = "0.0";
+  for (size_t i = 0; i < number_of_joints; ++i)
+  {
+    hardware_interface::ComponentInfo joint;
+    joint.name = "joint" + std::to_string(i);
+    joint.type = "joint";
+    joint.command_interfaces.push_back(position);
+    joint.state_interfaces.push_back(position);
+    info.joints.push_back(joint);
+  }
+  return info;
+}
+}  // namespace
+
+TEST(TestInterfaceAccessor, values_are_accessed_with_their_type)
+{
+  auto state = std::make_shared<StateInterface>(make_description("position", "double", "1.5"));
+  auto command = std::make_shared<CommandInterface>(make_description("mode", "int32", "3"));
+  const rclcpp::Time read_time(2, 0);
+  StateInterfaceAccessor<double> state_accessor(state, &read_time);
+  CommandInterfaceAccessor<int32_t> command_accessor(command);
+  ASSERT_TRUE(state_accessor.is_valid());
+  EXPECT_EQ("joint1/position", state_accessor.get_name());
+
+  EXPECT_DOUBLE_EQ(1.5, state_accessor.get());
+  EXPECT_EQ(3, command_accessor.get_unsynchronized());
+
+  state_accessor.set(2.5);
+  EXPECT_DOUBLE_EQ(2.5, state->get_optional().value());
+  EXPECT_EQ(1u, state->get_change_count());
+  EXPECT_EQ(1u, state->get_update_sequence());
+  EXPECT_EQ(read_time.nanoseconds(), state->get_update_time()->nanoseconds());
+
+  // setting the same value is an update, but no change
+  state_accessor.set_unsynchronized(2.5);
+  EXPECT_EQ(1u, state->get_change_count());
+  EXPECT_EQ(2u, state->get_update_sequence());
+
+  ASSERT_TRUE(command->set_value<int32_t>(-4));
+  EXPECT_EQ(-4, command_accessor.get());
+  command_accessor.set(5);
+  EXPECT_EQ(5, command->get_optional<int32_t>().value());
+  EXPECT_TRUE(command->is_dirty());
+}
+
+TEST(TestInterfaceAccessor, invalid_interfaces_throw)
+{
+  StateInterfaceAccessor<double> default_accessor;
+  EXPECT_FALSE(default_accessor.is_valid());
+
+  auto state = std::make_shared<StateInterface>(make_description("position", "double", "1.5"));
+  EXPECT_THROW({ StateInterfaceAccessor<float> accessor(state); }, std::runtime_error);
+  auto array = std::make_shared<StateInterface>(make_description("taxels", "double", "0.0", 3));
+  EXPECT_THROW({ StateInterfaceAccessor<double> accessor(array); }, std::runtime_error);
+  EXPECT_THROW({ StateInterfaceAccessor<double> accessor(nullptr); }, std::runtime_error);
+}
+
+TEST(TestInterfaceAccessor, array_values_are_accessed_with_their_type)
+{
+  auto state = std::make_shared<StateInterface>(make_description("taxels", "double", "0.0", 3));
+  auto command = std::make_shared<CommandInterface>(make_description("leds", "uint8", "1", 3));
+  const rclcpp::Time read_time(2, 0);
+  StateInterfaceArrayAccessor<double> state_accessor(state, &read_time);
+  CommandInterfaceArrayAccessor<uint8_t> command_accessor(command);
+  ASSERT_TRUE(state_accessor.is_valid());
+  EXPECT_EQ("joint1/taxels", state_accessor.get_name());
+  EXPECT_EQ(3u, state_accessor.size());
+
+  std::array<uint8_t, 3> commands{};
+  command_accessor.get(commands);
+  EXPECT_THAT(commands, testing::ElementsAre(1, 1, 1));
+
+  const std::array<double, 3> states = {1.0, 2.0, 3.0};
+  state_accessor.set(states);
+  std::array<double, 3> values{};
+  ASSERT_TRUE(state->get_array_values<double>(values));
+  EXPECT_EQ(states, values);
+  EXPECT_EQ(1u, state->get_change_count());
+  EXPECT_EQ(read_time.nanoseconds(), state->get_update_time()->nanoseconds());
+
+  std::array<double, 2> wrong_size{};
+  EXPECT_THROW(state_accessor.get(wrong_size), std::runtime_error);
+  EXPECT_THROW({ StateInterfaceArrayAccessor<float> accessor(state); }, std::runtime_error);
+  auto scalar = std::make_shared<StateInterface>(make_description("position", "double", "1.5"));
+  EXPECT_THROW({ StateInterfaceArrayAccessor<double> accessor(scalar); }, std::runtime_error);
+}
+
+TEST(TestInterfaceAccessor, values_bound_to_memory)
+{
+  std::array<double, 1> process_image = {0.5};
+  auto in_place = make_description("position", "double", "0.0");
+  in_place.bind_memory(process_image.data());
+  auto state = std::make_shared<StateInterface>(in_place);
+  StateInterfaceAccessor<double> accessor(state);
+  process_image[0] = 1.5;
+  EXPECT_DOUBLE_EQ(1.5, accessor.get());
+  accessor.set(2.5);
+  EXPECT_DOUBLE_EQ(2.5, process_image[0]);
+
+  // big-endian values are converted on each access
+  std::array<uint8_t, 2> raw_values = {0x01, 0x02};
+  auto big_endian = make_description("current", "uint16", "0");
+  big_endian.bind_memory(
+    raw_values.data(), hardware_interface::HandleDataType::UINT16,
+    hardware_interface::InterfaceMemory::ByteOrder::BIG);
+  auto command = std::make_shared<CommandInterface>(big_endian);
+  CommandInterfaceAccessor<uint16_t> command_accessor(command);
+  EXPECT_EQ(0x0102, command_accessor.get());
+  command_accessor.set(0x0304);
+  EXPECT_THAT(raw_values, testing::ElementsAre(0x03, 0x04));
+  EXPECT_EQ(0x0304, command->get_optional<uint16_t>().value());
+}
+
+class TestInterfaceAccessorBenchmark : public testing::TestWithParam<size_t>
+{
+};
+
+// Compares copying the commands to the states of a hardware component by name, as most
+// hardware components do in read() and write(), with the accessors resolved in on_configure().
+// The results are reported as test properties.
+TEST_P(TestInterfaceAccessorBenchmark, accessors_vs_access_by_name)
+{
+  const size_t number_of_joints = GetParam();
+  constexpr int kRepetitions = 100;
+
+  auto component = std::make_unique<BenchmarkSystem>();
+  auto * hardware = component.get();
+  hardware_interface::System system(std::move(component));
+  rclcpp::Node::SharedPtr node = std::make_shared<rclcpp::Node>("test_interface_accessor");
+  hardware_interface::HardwareComponentParams params;
+  params.hardware_info = make_hardware_info(number_of_joints);
+  params.clock = node->get_clock();
+  params.logger = node->get_logger();
+  system.initialize(params);
+  const auto state_interfaces = system.export_state_interfaces();
+  const auto command_interfaces = system.export_command_interfaces();
+  ASSERT_EQ(number_of_joints, state_interfaces.size());
+  ASSERT_EQ(number_of_joints, command_interfaces.size());
+  system.configure();
+
+  EXPECT_THROW(
+    { std::ignore = hardware->get_state_accessor("joint0/nonexisting"); }, std::runtime_error);
+  EXPECT_THROW(
+    { std::ignore = hardware->get_command_accessor<bool>("joint0/position"); },
+    std::runtime_error);
+
+  std::vector<std::string> names;
+  std::vector<StateInterfaceAccessor<double>> states;
+  std::vector<CommandInterfaceAccessor<double>> commands;
+  for (size_t i = 0; i < number_of_joints; ++i)
+  {
+    names.push_back("joint" + std::to_string(i) + "/" + hardware_interface::HW_IF_POSITION);
+    states.push_back(hardware->get_state_accessor(names.back()));
+    commands.push_back(hardware->get_command_accessor(names.back()));
+    commands.back().set(static_cast<double>(i));
+  }
+
+  auto start_time = std::chrono::steady_clock::now();
+  for (int repetition = 0; repetition < kRepetitions; ++repetition)
+  {
+    for (const auto & name : names)
+    {
+      hardware->set_state(name, hardware->get_command(name));
+    }
+  }
+  const double by_name_time =
+    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
+      .count() /
+    kRepetitions;
+
+  start_time = std::chrono::steady_clock::now();
+  for (int repetition = 0; repetition < kRepetitions; ++repetition)
+  {
+    for (size_t i = 0; i < number_of_joints; ++i)
+    {
+      states[i].set(commands[i].get());
+    }
+  }
+  const double accessor_time =
+    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
+      .count() /
+    kRepetitions;
+
+  start_time = std::chrono::steady_clock::now();
+  for (int repetition = 0; repetition < kRepetitions; ++repetition)
+  {
+    for (size_t i = 0; i < number_of_joints; ++i)
+    {
+      states[i].set_unsynchronized(commands[i].get_unsynchronized());
+    }
+  }
+  const double unsynchronized_time =
+    std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time)
+      .count() /
+    kRepetitions;
+
+  EXPECT_DOUBLE_EQ(static_cast<double>(number_of_joints - 1), states.back().get());
+
+  RCLCPP_INFO(
+    rclcpp::get_logger("test_interface_accessor"),
+    "Copying %zu commands to states: %.3f us by name, %.3f us with accessors, %.3f us with "
+    "unsynchronized accessors",
+    number_of_joints, by_name_time, accessor_time, unsynchronized_time);
+  RecordProperty("by_name_us", std::to_string(by_name_time));
+  RecordProperty("accessor_us", std::to_string(accessor_time));
+  RecordProperty("unsynchronized_accessor_us", std::to_string(unsynchronized_time));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  number_of_joints, TestInterfaceAccessorBenchmark, testing::Values<size_t>(10u, 100u, 1000u));
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  testing::InitGoogleMock(&argc, argv);
+  return RUN_ALL_TESTS();
+}
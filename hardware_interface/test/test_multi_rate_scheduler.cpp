@@ -0,0 +1,100 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "hardware_interface/multi_rate_scheduler.hpp"
+
+using hardware_interface::compute_multi_rate_schedule;
+using hardware_interface::to_tick_divisor;
+
+TEST(TestMultiRateScheduler, rates_are_rounded_to_integer_tick_divisors)
+{
+  EXPECT_EQ(1u, to_tick_divisor(100, 0));
+  EXPECT_EQ(1u, to_tick_divisor(100, 100));
+  EXPECT_EQ(1u, to_tick_divisor(100, 500));
+  EXPECT_EQ(1u, to_tick_divisor(100, 71));
+  EXPECT_EQ(2u, to_tick_divisor(100, 50));
+  EXPECT_EQ(2u, to_tick_divisor(100, 63));
+  // ties are rounded to the higher rate
+  EXPECT_EQ(2u, to_tick_divisor(100, 40));
+  EXPECT_EQ(3u, to_tick_divisor(100, 37));
+  EXPECT_EQ(8u, to_tick_divisor(100, 12));
+  EXPECT_EQ(10u, to_tick_divisor(100, 10));
+  EXPECT_EQ(1000u, to_tick_divisor(1000, 1));
+}
+
+TEST(TestMultiRateScheduler, decimated_tasks_are_spread_over_the_hyperperiod)
+{
+  // four 10 Hz tasks at 100 Hz would all be due in the same tick without phase offsets
+  const auto schedule = compute_multi_rate_schedule(100, {10, 10, 10, 10, 100});
+  ASSERT_THAT(schedule.tasks, testing::SizeIs(5));
+  ASSERT_THAT(schedule.load_profile, testing::SizeIs(10));
+  std::vector<unsigned int> phases;
+  for (size_t i = 0; i < 4; ++i)
+  {
+    EXPECT_EQ(10u, schedule.tasks[i].divisor);
+    phases.push_back(schedule.tasks[i].phase);
+  }
+  EXPECT_THAT(phases, testing::UnorderedElementsAre(0u, 1u, 2u, 3u));
+  EXPECT_EQ(1u, schedule.tasks[4].divisor);
+  EXPECT_DOUBLE_EQ(2.0, schedule.get_peak_load());
+  EXPECT_DOUBLE_EQ(1.4, schedule.get_average_load());
+
+  // each task is due exactly once per divisor
+  for (const auto & task : schedule.tasks)
+  {
+    size_t executions = 0;
+    for (uint64_t tick = 0; tick < 100; ++tick)
+    {
+      executions += task.is_due(tick) ? 1u : 0u;
+    }
+    EXPECT_EQ(100u / task.divisor, executions);
+  }
+}
+
+TEST(TestMultiRateScheduler, weights_and_mixed_divisors_are_balanced)
+{
+  const auto schedule =
+    compute_multi_rate_schedule(1000, {500, 250, 250, 100}, {4.0, 2.0, 1.0, 1.0});
+  EXPECT_EQ(2u, schedule.tasks[0].divisor);
+  EXPECT_EQ(4u, schedule.tasks[1].divisor);
+  EXPECT_EQ(10u, schedule.tasks[3].divisor);
+  ASSERT_THAT(schedule.load_profile, testing::SizeIs(20));
+  // the 250 Hz tasks are placed in the ticks without the 500 Hz task
+  EXPECT_NE(schedule.tasks[0].phase % 2, schedule.tasks[1].phase % 2);
+  EXPECT_NE(schedule.tasks[0].phase % 2, schedule.tasks[2].phase % 2);
+  EXPECT_DOUBLE_EQ(4.0, schedule.get_peak_load());
+}
+
+TEST(TestMultiRateScheduler, long_hyperperiods_are_truncated)
+{
+  const auto schedule = compute_multi_rate_schedule(100000, {1031, 1124, 1205});
+  // the divisors 97, 89 and 83 have a hyperperiod of 716539 ticks
+  EXPECT_EQ(hardware_interface::kMaxHyperperiod, schedule.load_profile.size());
+  for (const auto & task : schedule.tasks)
+  {
+    EXPECT_LT(task.phase, task.divisor);
+  }
+}
+
+TEST(TestMultiRateScheduler, invalid_arguments_throw)
+{
+  EXPECT_TRUE(compute_multi_rate_schedule(100, {}).load_profile.empty());
+  EXPECT_THROW(compute_multi_rate_schedule(0, {10}), std::invalid_argument);
+  EXPECT_THROW(compute_multi_rate_schedule(100, {10, 20}, {1.0}), std::invalid_argument);
+}
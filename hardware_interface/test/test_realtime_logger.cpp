@@ -0,0 +1,150 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface/realtime_logger.hpp"
+#include "rclcpp/logger.hpp"
+#include "rcutils/logging.h"
+
+namespace
+{
+std::vector<std::string> logged_messages;
+
+void capture_output_handler(
+  const rcutils_log_location_t *, int, const char *, rcutils_time_point_value_t,
+  const char * format, va_list * args)
+{
+  char buffer[1024];
+  va_list args_copy;
+  va_copy(args_copy, *args);
+  std::vsnprintf(buffer, sizeof(buffer), format, args_copy);
+  va_end(args_copy);
+  logged_messages.emplace_back(buffer);
+}
+}  // namespace
+
+class TestRealtimeLogger : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    ASSERT_EQ(RCUTILS_RET_OK, rcutils_logging_initialize());
+    previous_output_handler_ = rcutils_logging_get_output_handler();
+    rcutils_logging_set_output_handler(capture_output_handler);
+    logged_messages.clear();
+  }
+
+  void TearDown() override { rcutils_logging_set_output_handler(previous_output_handler_); }
+
+  // long drain period, so that the buffer is only drained by the test
+  const std::chrono::milliseconds drain_period_{std::chrono::hours(1)};
+  rcutils_logging_output_handler_t previous_output_handler_ = nullptr;
+};
+
+TEST_F(TestRealtimeLogger, messages_are_formatted_when_drained)
+{
+  hardware_interface::RealtimeLogger logger(
+    rclcpp::get_logger("test_realtime_logger"), 16, drain_period_);
+  // the drain thread runs once at the start
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  logged_messages.clear();
+
+  const std::string name = "joint1";
+  EXPECT_TRUE(logger.error("Component '{}' failed with {} errors", name, 3));
+  EXPECT_TRUE(logger.warn("Cycle took {:.3f} us (limit {} us)", 1.23456, 1000u));
+  EXPECT_TRUE(logger.info("Flag is {}, name is {}", true, "literal"));
+  EXPECT_TRUE(logger.info("No arguments"));
+  EXPECT_TRUE(logged_messages.empty());
+
+  EXPECT_EQ(4u, logger.drain());
+  EXPECT_THAT(
+    logged_messages,
+    testing::ElementsAre(
+      "Component 'joint1' failed with 3 errors", "Cycle took 1.235 us (limit 1000 us)",
+      "Flag is true, name is literal", "No arguments"));
+  EXPECT_EQ(0u, logger.drain());
+  EXPECT_EQ(0u, logger.get_dropped_messages());
+}
+
+TEST_F(TestRealtimeLogger, messages_below_logger_level_are_not_queued)
+{
+  hardware_interface::RealtimeLogger logger(
+    rclcpp::get_logger("test_realtime_logger_level"), 16, drain_period_);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  ASSERT_EQ(
+    RCUTILS_RET_OK,
+    rcutils_logging_set_logger_level("test_realtime_logger_level", RCUTILS_LOG_SEVERITY_WARN));
+  EXPECT_TRUE(logger.info("Filtered {}", 1));
+  EXPECT_TRUE(logger.warn("Not filtered {}", 2));
+  EXPECT_EQ(1u, logger.drain());
+}
+
+TEST_F(TestRealtimeLogger, messages_are_dropped_and_counted_when_full)
+{
+  hardware_interface::RealtimeLogger logger(
+    rclcpp::get_logger("test_realtime_logger"), 2, drain_period_);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  logged_messages.clear();
+
+  EXPECT_TRUE(logger.error("Message {}", 1));
+  EXPECT_TRUE(logger.error("Message {}", 2));
+  EXPECT_FALSE(logger.error("Message {}", 3));
+  EXPECT_FALSE(logger.error("Message {}", 4));
+  EXPECT_EQ(2u, logger.get_dropped_messages());
+
+  EXPECT_EQ(2u, logger.drain());
+  ASSERT_EQ(3u, logged_messages.size());
+  EXPECT_EQ("Message 1", logged_messages[0]);
+  EXPECT_EQ("Message 2", logged_messages[1]);
+  EXPECT_THAT(logged_messages[2], testing::HasSubstr("2 real-time log messages were dropped"));
+
+  // the freed records can be used again
+  EXPECT_TRUE(logger.error("Message {}", 5));
+  EXPECT_EQ(1u, logger.drain());
+}
+
+TEST_F(TestRealtimeLogger, long_string_arguments_are_truncated)
+{
+  hardware_interface::RealtimeLogger logger(
+    rclcpp::get_logger("test_realtime_logger"), 4, drain_period_);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  logged_messages.clear();
+
+  constexpr size_t capacity = hardware_interface::RealtimeLogger::kStringArgumentsCapacity;
+  const std::string long_string(2 * capacity, 'a');
+  EXPECT_TRUE(logger.error("{}|{}", long_string, std::string("b")));
+  EXPECT_EQ(1u, logger.drain());
+  // the first argument fills the storage, the second one is empty
+  EXPECT_THAT(logged_messages, testing::ElementsAre(std::string(capacity, 'a') + "|"));
+}
+
+TEST_F(TestRealtimeLogger, throttle)
+{
+  std::chrono::steady_clock::time_point last_time;
+  EXPECT_TRUE(
+    hardware_interface::RealtimeLogger::throttle(last_time, std::chrono::milliseconds(100)));
+  EXPECT_FALSE(
+    hardware_interface::RealtimeLogger::throttle(last_time, std::chrono::milliseconds(100)));
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  EXPECT_TRUE(
+    hardware_interface::RealtimeLogger::throttle(last_time, std::chrono::milliseconds(100)));
+}
@@ -0,0 +1,130 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "hardware_interface/realtime_memory.hpp"
+
+using hardware_interface::RealtimeMemoryArena;
+
+TEST(TestRealtimeMemoryArena, allocate_and_reuse_blocks)
+{
+  EXPECT_THROW(RealtimeMemoryArena(0u), std::invalid_argument);
+
+  RealtimeMemoryArena arena(4096u);
+  EXPECT_EQ(4096u, arena.get_capacity());
+  EXPECT_EQ(0u, arena.get_statistics().used_bytes);
+
+  // rounded up to the size class of 32 bytes
+  void * block = arena.allocate(20u, 8u);
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(block) % 8u);
+  EXPECT_EQ(32u, arena.get_statistics().used_bytes);
+  void * aligned_block = arena.allocate(8u, 64u);
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(aligned_block) % 64u);
+  EXPECT_EQ(96u, arena.get_statistics().used_bytes);
+
+  // a freed block is reused by the next allocation of its size class
+  arena.deallocate(block, 20u, 8u);
+  EXPECT_EQ(64u, arena.get_statistics().used_bytes);
+  EXPECT_EQ(block, arena.allocate(32u, 8u));
+  arena.deallocate(block, 32u, 8u);
+  arena.deallocate(aligned_block, 8u, 64u);
+  EXPECT_EQ(0u, arena.get_statistics().used_bytes);
+  EXPECT_EQ(96u, arena.get_statistics().high_water_mark);
+  EXPECT_EQ(0u, arena.get_statistics().failed_allocations);
+
+  // bounded, there is no fallback to the heap
+  EXPECT_THROW(static_cast<void>(arena.allocate(8192u, 8u)), std::bad_alloc);
+  EXPECT_THROW(static_cast<void>(arena.allocate(8u, 128u)), std::bad_alloc);
+  EXPECT_EQ(2u, arena.get_statistics().failed_allocations);
+}
+
+TEST(TestRealtimeMemoryArena, growing_pmr_container)
+{
+  RealtimeMemoryArena arena(64u * 1024u);
+  {
+    std::pmr::vector<double> buffer(&arena);
+    for (int i = 0; i < 1000; ++i)
+    {
+      buffer.push_back(static_cast<double>(i));
+    }
+    EXPECT_DOUBLE_EQ(999.0, buffer.back());
+    EXPECT_GE(arena.get_statistics().used_bytes, 1000u * sizeof(double));
+  }
+  EXPECT_EQ(0u, arena.get_statistics().used_bytes);
+  const auto high_water_mark = arena.get_statistics().high_water_mark;
+  EXPECT_GE(high_water_mark, 1000u * sizeof(double));
+
+  // the blocks of the first growth are reused, so the high-water mark doesn't increase
+  std::pmr::vector<double> buffer(&arena);
+  for (int i = 0; i < 1000; ++i)
+  {
+    buffer.push_back(static_cast<double>(i));
+  }
+  EXPECT_EQ(high_water_mark, arena.get_statistics().high_water_mark);
+}
+
+TEST(TestRealtimeMemoryArena, concurrent_allocations)
+{
+  RealtimeMemoryArena arena(1024u * 1024u);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+  {
+    threads.emplace_back(
+      [&arena]()
+      {
+        std::vector<void *> blocks;
+        for (int cycle = 0; cycle < 1000; ++cycle)
+        {
+          for (size_t size = 8u; size <= 512u; size *= 2u)
+          {
+            blocks.push_back(arena.allocate(size, 8u));
+          }
+          size_t size = 8u;
+          for (void * block : blocks)
+          {
+            arena.deallocate(block, size, 8u);
+            size *= 2u;
+          }
+          blocks.clear();
+        }
+      });
+  }
+  for (auto & thread : threads)
+  {
+    thread.join();
+  }
+  EXPECT_EQ(0u, arena.get_statistics().used_bytes);
+  EXPECT_EQ(0u, arena.get_statistics().failed_allocations);
+}
+
+TEST(TestRealtimeMemoryArena, prefault_stack)
+{
+  EXPECT_EQ(0u, hardware_interface::prefault_current_thread_stack(0u));
+  size_t touched = 0u;
+  std::thread thread(
+    [&touched]() { touched = hardware_interface::prefault_current_thread_stack(256u * 1024u); });
+  thread.join();
+  EXPECT_EQ(256u * 1024u, touched);
+  // limited to the available stack
+  EXPECT_LT(
+    hardware_interface::prefault_current_thread_stack(size_t{1} << 40), size_t{1} << 40);
+}
@@ -0,0 +1,97 @@
+// Copyright 2025 ros2_control development team
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "hardware_interface/state_extrapolator.hpp"
+
+using hardware_interface::StateExtrapolation;
+using hardware_interface::StateExtrapolator;
+
+namespace
+{
+// the hardware component is read at 100 Hz, the controller manager runs at 1 kHz
+constexpr int64_t kReadPeriod = 10000000;
+constexpr int64_t kCycle = kReadPeriod / 10;
+}  // namespace
+
+TEST(TestStateExtrapolator, parse_extrapolation)
+{
+  EXPECT_EQ(StateExtrapolation::NONE, hardware_interface::parse_state_extrapolation("none"));
+  EXPECT_EQ(StateExtrapolation::HOLD, hardware_interface::parse_state_extrapolation("Hold"));
+  EXPECT_EQ(StateExtrapolation::LINEAR, hardware_interface::parse_state_extrapolation("linear"));
+  EXPECT_EQ(StateExtrapolation::FILTER, hardware_interface::parse_state_extrapolation("filter"));
+  EXPECT_THROW(hardware_interface::parse_state_extrapolation("kalman"), std::invalid_argument);
+
+  StateExtrapolator extrapolator(StateExtrapolation::FILTER);
+  EXPECT_THROW(extrapolator.set_filter_gains(0.0, 0.1), std::invalid_argument);
+  EXPECT_THROW(extrapolator.set_filter_gains(0.5, 2.5), std::invalid_argument);
+  EXPECT_THROW(extrapolator.set_horizon(-1), std::invalid_argument);
+}
+
+TEST(TestStateExtrapolator, hold_and_linear_extrapolation)
+{
+  StateExtrapolator hold(StateExtrapolation::HOLD);
+  EXPECT_TRUE(std::isnan(hold.extrapolate(0)));
+  hold.add_sample(0, 1.0, 10.0);
+  hold.add_sample(kReadPeriod, 2.0, 10.0);
+  EXPECT_DOUBLE_EQ(2.0, hold.extrapolate(kReadPeriod + 5 * kCycle));
+
+  // the slope between the last two samples without derivative
+  StateExtrapolator linear(StateExtrapolation::LINEAR);
+  linear.add_sample(0, 1.0);
+  EXPECT_DOUBLE_EQ(1.0, linear.extrapolate(kCycle));
+  linear.add_sample(kReadPeriod, 2.0);
+  for (int64_t cycle = 0; cycle < 10; ++cycle)
+  {
+    EXPECT_NEAR(
+      2.0 + static_cast<double>(cycle) / 10.0, linear.extrapolate(kReadPeriod + cycle * kCycle),
+      1e-12);
+  }
+
+  // the derivative, e.g., the velocity of a position, takes precedence over the slope
+  linear.add_sample(2 * kReadPeriod, 3.0, -50.0);
+  EXPECT_NEAR(2.5, linear.extrapolate(2 * kReadPeriod + 10 * kCycle), 1e-12);
+
+  // the prediction is held after the horizon
+  linear.set_horizon(2 * kCycle);
+  EXPECT_NEAR(2.9, linear.extrapolate(2 * kReadPeriod + 10 * kCycle), 1e-12);
+}
+
+TEST(TestStateExtrapolator, filter_estimates_the_rate_of_noisy_samples)
+{
+  StateExtrapolator filter(StateExtrapolation::FILTER);
+  filter.set_filter_gains(0.5, 0.1);
+  // a ramp of 10 per second with alternating noise
+  for (int64_t sample = 0; sample < 200; ++sample)
+  {
+    const double noise = (sample % 2 == 0) ? 0.01 : -0.01;
+    filter.add_sample(sample * kReadPeriod, 0.1 * static_cast<double>(sample) + noise);
+  }
+  const int64_t latest = 199 * kReadPeriod;
+  const double latest_value = 19.9 - 0.01;
+  // the rate of change converges to the ramp despite the noise
+  EXPECT_NEAR(latest_value + 0.05, filter.extrapolate(latest + 5 * kCycle), 0.01);
+
+  // the latest sample is held while the samples aren't finite
+  filter.add_sample(200 * kReadPeriod, std::numeric_limits<double>::quiet_NaN());
+  EXPECT_TRUE(std::isnan(filter.extrapolate(200 * kReadPeriod + kCycle)));
+  filter.add_sample(201 * kReadPeriod, 1.0);
+  EXPECT_EQ(1u, filter.get_number_of_samples());
+  EXPECT_DOUBLE_EQ(1.0, filter.extrapolate(201 * kReadPeriod + 5 * kCycle));
+}
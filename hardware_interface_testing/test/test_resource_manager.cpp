@@ -17,8 +17,12 @@
 #include "test_resource_manager.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <future>
 #include <memory>
+#include <numeric>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -1737,6 +1741,151 @@ TEST_F(ResourceManagerTestReadWriteError, handle_deactivate_on_hardware_write)
     std::bind(&TestableResourceManager::read, rm, _1, _2), test_constants::WRITE_DEACTIVATE_VALUE);
 }
 
+TEST_F(ResourceManagerTestReadWriteError, deactivate_on_hardware_write_is_executed_by_worker)
+{
+  setup_resource_manager_and_do_initial_checks();
+
+  ASSERT_TRUE(claimed_itfs[0].set_value(test_constants::WRITE_DEACTIVATE_VALUE));
+  {
+    auto [result, failed_hardware_names] = rm->write(time, duration);
+    EXPECT_EQ(result, hardware_interface::return_type::DEACTIVATE);
+    EXPECT_THAT(failed_hardware_names, testing::ElementsAre(TEST_ACTUATOR_HARDWARE_NAME));
+  }
+  // the component is skipped until the deactivation is done, so it is reported only once
+  {
+    auto [result, failed_hardware_names] = rm->write(time, duration);
+    EXPECT_EQ(result, hardware_interface::return_type::OK);
+    EXPECT_TRUE(failed_hardware_names.empty());
+  }
+
+  // the deactivation is executed without any further call to the resource manager
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (rm->has_pending_component_transitions() && std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ASSERT_FALSE(rm->has_pending_component_transitions());
+
+  auto status_map = rm->get_components_status();
+  EXPECT_EQ(
+    status_map[TEST_ACTUATOR_HARDWARE_NAME].state.id(),
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE);
+  EXPECT_EQ(
+    status_map[TEST_SYSTEM_HARDWARE_NAME].state.id(),
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+  {
+    auto [result, failed_hardware_names] = rm->write(time, duration);
+    EXPECT_EQ(result, hardware_interface::return_type::OK);
+    EXPECT_TRUE(failed_hardware_names.empty());
+  }
+}
+
+TEST_F(ResourceManagerTestReadWriteError, interfaces_are_unavailable_until_deferred_deactivation)
+{
+  setup_resource_manager_and_do_initial_checks();
+
+  // keep the lifecycle worker from deactivating the component
+  std::promise<void> locked;
+  std::promise<void> release;
+  std::thread locking_thread(
+    [&]()
+    {
+      std::lock_guard<std::recursive_mutex> guard(rm->resources_lock_);
+      locked.set_value();
+      release.get_future().wait();
+    });
+  locked.get_future().wait();
+
+  ASSERT_TRUE(claimed_itfs[0].set_value(test_constants::WRITE_DEACTIVATE_VALUE));
+  {
+    auto [result, failed_hardware_names] = rm->write(time, duration);
+    EXPECT_EQ(result, hardware_interface::return_type::DEACTIVATE);
+  }
+  EXPECT_TRUE(rm->has_pending_component_transitions());
+  check_if_interface_available(false, true);
+
+  release.set_value();
+  locking_thread.join();
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (rm->has_pending_component_transitions() && std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ASSERT_FALSE(rm->has_pending_component_transitions());
+  // the interfaces of inactive components stay available
+  check_if_interface_available(true, true);
+}
+
+TEST_F(ResourceManagerTestReadWriteError, error_on_hardware_read_is_executed_by_worker)
+{
+  setup_resource_manager_and_do_initial_checks();
+
+  ASSERT_TRUE(claimed_itfs[0].set_value(test_constants::READ_FAIL_VALUE));
+  {
+    auto [result, failed_hardware_names] = rm->read(time, duration);
+    EXPECT_EQ(result, hardware_interface::return_type::ERROR);
+    EXPECT_THAT(failed_hardware_names, testing::ElementsAre(TEST_ACTUATOR_HARDWARE_NAME));
+  }
+
+  // the error transition is executed without any further call to the resource manager
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (rm->has_pending_component_transitions() && std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ASSERT_FALSE(rm->has_pending_component_transitions());
+
+  auto status_map = rm->get_components_status();
+  EXPECT_EQ(
+    status_map[TEST_ACTUATOR_HARDWARE_NAME].state.id(),
+    lifecycle_msgs::msg::State::PRIMARY_STATE_UNCONFIGURED);
+  EXPECT_EQ(
+    status_map[TEST_SYSTEM_HARDWARE_NAME].state.id(),
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE);
+  check_if_interface_available(false, true);
+}
+
+TEST_F(ResourceManagerTestReadWriteError, read_is_not_skipped_while_resources_are_locked)
+{
+  setup_resource_manager_and_do_initial_checks();
+
+  // simulate a component being loaded or switching its state in another thread
+  std::promise<void> locked;
+  std::promise<void> release;
+  std::thread locking_thread(
+    [&]()
+    {
+      std::lock_guard<std::recursive_mutex> guard(rm->resources_lock_);
+      locked.set_value();
+      release.get_future().wait();
+    });
+  locked.get_future().wait();
+
+  ASSERT_TRUE(claimed_itfs[0].set_value(test_constants::READ_FAIL_VALUE));
+  {
+    auto [result, failed_hardware_names] = rm->read(time, duration);
+    EXPECT_EQ(result, hardware_interface::return_type::ERROR);
+    EXPECT_THAT(failed_hardware_names, testing::ElementsAre(TEST_ACTUATOR_HARDWARE_NAME));
+  }
+  {
+    auto [result, failed_hardware_names] = rm->write(time, duration);
+    EXPECT_EQ(result, hardware_interface::return_type::OK);
+    EXPECT_TRUE(failed_hardware_names.empty());
+  }
+  EXPECT_TRUE(rm->has_pending_component_transitions());
+
+  // the interfaces of the failed component are removed once the resources are released
+  release.set_value();
+  locking_thread.join();
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (rm->has_pending_component_transitions() && std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ASSERT_FALSE(rm->has_pending_component_transitions());
+  check_if_interface_available(false, true);
+}
+
 TEST_F(ResourceManagerTest, test_caching_of_controllers_to_hardware)
 {
   TestableResourceManager rm(node_, ros2_control_test_assets::minimal_robot_urdf, false);
@@ -2226,6 +2375,100 @@ TEST_F(
   EXPECT_DOUBLE_EQ(state_itfs[0].get_optional().value(), 15.0);
 }
 
+TEST_F(ResourceManagerTest, tick_scheduling_spreads_components_with_lower_rw_rate)
+{
+  hardware_interface::ResourceManagerParams params;
+  params.robot_description = ros2_control_test_assets::minimal_robot_urdf_with_different_hw_rw_rate;
+  params.clock = node_.get_clock();
+  params.logger = node_.get_logger();
+  params.update_rate = 100;
+  params.tick_scheduling = true;
+  TestableResourceManager rm(params);
+  activate_components(rm);
+
+  // the actuator (50 Hz), system (25 Hz) and sensor (20 Hz) have a hyperperiod of 20 cycles, with
+  // phase offsets at most two of them are due in the same cycle instead of all three
+  const auto load_profile = rm.get_hardware_load_profile();
+  ASSERT_THAT(load_profile, testing::SizeIs(20));
+  EXPECT_DOUBLE_EQ(2.0, *std::max_element(load_profile.begin(), load_profile.end()));
+  EXPECT_DOUBLE_EQ(
+    10.0 + 5.0 + 4.0, std::accumulate(load_profile.begin(), load_profile.end(), 0.0));
+
+  const auto period = rclcpp::Duration::from_seconds(0.01);
+  for (size_t i = 0; i < load_profile.size(); ++i)
+  {
+    EXPECT_EQ(rm.read(node_.now(), period).result, hardware_interface::return_type::OK);
+    EXPECT_EQ(rm.write(node_.now(), period).result, hardware_interface::return_type::OK);
+  }
+  auto status_map = rm.get_components_status();
+  EXPECT_EQ(
+    10u, status_map[TEST_ACTUATOR_HARDWARE_NAME]
+           .read_statistics->execution_time.get_statistics()
+           .sample_count);
+  EXPECT_EQ(
+    5u, status_map[TEST_SYSTEM_HARDWARE_NAME]
+          .read_statistics->execution_time.get_statistics()
+          .sample_count);
+  EXPECT_EQ(
+    4u, status_map[TEST_SENSOR_HARDWARE_NAME]
+          .read_statistics->execution_time.get_statistics()
+          .sample_count);
+  EXPECT_EQ(
+    10u, status_map[TEST_ACTUATOR_HARDWARE_NAME]
+           .write_statistics->execution_time.get_statistics()
+           .sample_count);
+}
+
+TEST_F(ResourceManagerTest, rate_domains_read_and_write_their_components)
+{
+  hardware_interface::ResourceManagerParams params;
+  params.robot_description = ros2_control_test_assets::minimal_robot_urdf;
+  params.clock = node_.get_clock();
+  params.logger = node_.get_logger();
+  params.update_rate = 100;
+  params.rate_domain_update_rates = {1000};
+  params.hardware_components_rate_domains = {{TEST_ACTUATOR_HARDWARE_NAME, 1}};
+  TestableResourceManager rm(params);
+  activate_components(rm);
+
+  auto status_map = rm.get_components_status();
+  // the rw_rate is limited by the update rate of the rate domain of the component
+  EXPECT_EQ(1000u, status_map[TEST_ACTUATOR_HARDWARE_NAME].rw_rate);
+  EXPECT_EQ(100u, status_map[TEST_SYSTEM_HARDWARE_NAME].rw_rate);
+
+  const auto period = rclcpp::Duration::from_seconds(0.01);
+  const auto fast_period = rclcpp::Duration::from_seconds(0.001);
+  for (size_t i = 0; i < 2; ++i)
+  {
+    EXPECT_EQ(rm.read(node_.now(), period).result, hardware_interface::return_type::OK);
+    EXPECT_EQ(rm.write(node_.now(), period).result, hardware_interface::return_type::OK);
+  }
+  for (size_t i = 0; i < 5; ++i)
+  {
+    EXPECT_EQ(rm.read(node_.now(), fast_period, 1).result, hardware_interface::return_type::OK);
+    EXPECT_EQ(rm.write(node_.now(), fast_period, 1).result, hardware_interface::return_type::OK);
+  }
+  EXPECT_EQ(rm.read(node_.now(), period, 2).result, hardware_interface::return_type::ERROR);
+
+  status_map = rm.get_components_status();
+  EXPECT_EQ(
+    5u, status_map[TEST_ACTUATOR_HARDWARE_NAME]
+          .read_statistics->execution_time.get_statistics()
+          .sample_count);
+  EXPECT_EQ(
+    5u, status_map[TEST_ACTUATOR_HARDWARE_NAME]
+          .write_statistics->execution_time.get_statistics()
+          .sample_count);
+  EXPECT_EQ(
+    2u, status_map[TEST_SYSTEM_HARDWARE_NAME]
+          .read_statistics->execution_time.get_statistics()
+          .sample_count);
+  EXPECT_EQ(
+    2u, status_map[TEST_SENSOR_HARDWARE_NAME]
+          .read_statistics->execution_time.get_statistics()
+          .sample_count);
+}
+
 class ResourceManagerTestAsyncReadWrite : public ResourceManagerTest
 {
 public:
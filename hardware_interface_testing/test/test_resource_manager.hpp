@@ -51,6 +51,7 @@ public:
   FRIEND_TEST(ResourceManagerTest, managing_controllers_reference_interfaces);
   FRIEND_TEST(ResourceManagerTest, resource_availability_and_claiming_in_lifecycle);
   FRIEND_TEST(ResourceManagerTest, test_uninitializable_hardware_no_validation);
+  FRIEND_TEST(ResourceManagerTestReadWriteError, read_is_not_skipped_while_resources_are_locked);
 
   explicit TestableResourceManager(rclcpp::Node & node)
   : hardware_interface::ResourceManager(
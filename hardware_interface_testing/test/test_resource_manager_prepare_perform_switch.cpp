@@ -237,6 +237,36 @@ TEST_F(
   EXPECT_NEAR(claimed_actuator_position_state_->get_optional().value(), 0.101, 1e-7);
 };
 
+// System  : ACTIVE
+// Actuator: INACTIVE
+TEST_F(ResourceManagerPreparePerformTest, when_switch_id_is_used_expect_prepared_switch_matched)
+{
+  preconfigure_components(
+    lifecycle_msgs::msg::State::PRIMARY_STATE_ACTIVE, "active",
+    lifecycle_msgs::msg::State::PRIMARY_STATE_INACTIVE, "inactive");
+
+  uint64_t switch_id = 0;
+  EXPECT_TRUE(rm_->prepare_command_mode_switch(legal_keys_system, legal_keys_system, switch_id));
+  EXPECT_NE(switch_id, 0u);
+  EXPECT_EQ(claimed_system_acceleration_state_->get_optional().value(), 1.0);
+  EXPECT_TRUE(rm_->perform_command_mode_switch(legal_keys_system, legal_keys_system, switch_id));
+  EXPECT_EQ(claimed_system_acceleration_state_->get_optional().value(), 101.0);
+
+  // A stale id falls back to filtering the components for the given interfaces
+  const uint64_t stale_switch_id = switch_id;
+  EXPECT_TRUE(rm_->prepare_command_mode_switch(legal_keys_system, empty_keys, switch_id));
+  EXPECT_NE(switch_id, stale_switch_id);
+  EXPECT_EQ(claimed_system_acceleration_state_->get_optional().value(), 102.0);
+  EXPECT_TRUE(rm_->perform_command_mode_switch(legal_keys_system, empty_keys, stale_switch_id));
+  EXPECT_EQ(claimed_system_acceleration_state_->get_optional().value(), 202.0);
+
+  // A failed prepare doesn't hand out an id
+  EXPECT_FALSE(rm_->prepare_command_mode_switch(legal_keys_actuator, empty_keys, switch_id));
+  EXPECT_EQ(switch_id, 0u);
+  EXPECT_FALSE(rm_->perform_command_mode_switch(legal_keys_actuator, empty_keys, switch_id));
+  EXPECT_EQ(claimed_system_acceleration_state_->get_optional().value(), 202.0);
+};
+
 // System  : INACTIVE
 // Actuator: ACTIVE
 TEST_F(
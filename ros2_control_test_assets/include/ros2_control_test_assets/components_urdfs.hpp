@@ -720,6 +720,126 @@ const auto valid_urdf_ros2_control_dummy_system_robot =
   </ros2_control>
 )";
 
+const auto valid_urdf_ros2_control_dummy_pipelined_system_robot =
+  R"(
+  <ros2_control name="RRBotPipelinedSystem" type="system" is_async="true">
+    <properties>
+      <async pipelined="true"/>
+    </properties>
+    <hardware>
+      <plugin>ros2_control_demo_hardware/RRBotSystemWithGPIOHardware</plugin>
+    </hardware>
+    <joint name="joint1">
+      <command_interface name="velocity"/>
+      <state_interface name="position"/>
+      <state_interface name="velocity"/>
+    </joint>
+    <joint name="joint2">
+      <command_interface name="velocity"/>
+      <state_interface name="position"/>
+      <state_interface name="velocity"/>
+    </joint>
+    <joint name="joint3">
+      <command_interface name="velocity"/>
+      <state_interface name="position"/>
+      <state_interface name="velocity"/>
+    </joint>
+  </ros2_control>
+)";
+
+const auto valid_urdf_ros2_control_dummy_deadline_scheduled_system_robot =
+  R"(
+  <ros2_control name="RRBotDeadlineScheduledSystem" type="system" is_async="true" rw_rate="500">
+    <properties>
+      <async sched_runtime="300" sched_deadline="1000"/>
+    </properties>
+    <hardware>
+      <plugin>ros2_control_demo_hardware/RRBotSystemWithGPIOHardware</plugin>
+    </hardware>
+    <joint name="joint1">
+      <command_interface name="velocity"/>
+      <state_interface name="position"/>
+    </joint>
+  </ros2_control>
+)";
+
+const auto valid_urdf_ros2_control_system_with_realtime_memory_arena =
+  R"(
+  <ros2_control name="RRBotArenaSystem" type="system" realtime_memory_arena_size="65536">
+    <hardware>
+      <plugin>ros2_control_demo_hardware/RRBotSystemWithGPIOHardware</plugin>
+    </hardware>
+    <joint name="joint1">
+      <command_interface name="velocity"/>
+      <state_interface name="position"/>
+    </joint>
+  </ros2_control>
+)";
+
+const auto valid_urdf_ros2_control_dummy_interpolated_system_robot =
+  R"(
+  <ros2_control name="RRBotInterpolatedSystem" type="system" is_async="true" rw_rate="800">
+    <properties>
+      <async scheduling_policy="detached"/>
+    </properties>
+    <hardware>
+      <plugin>ros2_control_demo_hardware/RRBotSystemWithGPIOHardware</plugin>
+    </hardware>
+    <joint name="joint1">
+      <command_interface name="velocity">
+        <param name="interpolation">linear</param>
+      </command_interface>
+      <state_interface name="position"/>
+      <state_interface name="velocity"/>
+    </joint>
+    <joint name="joint2">
+      <command_interface name="velocity">
+        <param name="interpolation">cubic</param>
+      </command_interface>
+      <state_interface name="position"/>
+      <state_interface name="velocity"/>
+    </joint>
+    <joint name="joint3">
+      <command_interface name="velocity"/>
+      <state_interface name="position"/>
+      <state_interface name="velocity"/>
+    </joint>
+  </ros2_control>
+)";
+
+const auto valid_urdf_ros2_control_dummy_extrapolated_system_robot =
+  R"(
+  <ros2_control name="RRBotExtrapolatedSystem" type="system" rw_rate="100">
+    <hardware>
+      <plugin>ros2_control_demo_hardware/RRBotSystemWithGPIOHardware</plugin>
+    </hardware>
+    <joint name="joint1">
+      <command_interface name="velocity"/>
+      <state_interface name="position">
+        <param name="extrapolation">linear</param>
+      </state_interface>
+      <state_interface name="velocity"/>
+    </joint>
+    <joint name="joint2">
+      <command_interface name="velocity"/>
+      <state_interface name="position">
+        <param name="extrapolation">filter</param>
+        <param name="extrapolation_alpha">0.8</param>
+        <param name="extrapolation_beta">0.2</param>
+      </state_interface>
+      <state_interface name="velocity"/>
+    </joint>
+    <joint name="joint3">
+      <command_interface name="velocity"/>
+      <state_interface name="position">
+        <param name="extrapolation">hold</param>
+        <param name="extrapolation_horizon">0.05</param>
+      </state_interface>
+      <state_interface name="velocity"/>
+    </joint>
+  </ros2_control>
+)";
+
 const auto valid_urdf_ros2_control_parameter_empty =
   R"(
   <ros2_control name="2DOF_System_Robot_Position_Only" type="system">
@@ -761,7 +881,62 @@ const auto valid_urdf_ros2_control_system_robot_with_size_and_data_type_on_joint
   </ros2_control>
 )";
 
+const auto valid_urdf_ros2_control_system_robot_with_native_data_types =
+  R"(
+  <ros2_control name="RRBotSystemWithNativeDataTypes" type="system">
+    <hardware>
+      <plugin>ros2_control_demo_hardware/RRBotSystemWithNativeDataTypes</plugin>
+    </hardware>
+    <joint name="joint1">
+      <command_interface name="position" data_type="float"/>
+      <state_interface name="position" data_type="float"/>
+      <state_interface name="encoder_counts" data_type="int32">
+        <param name="initial_value">-1024</param>
+      </state_interface>
+      <state_interface name="timestamp" data_type="int64"/>
+    </joint>
+    <gpio name="flange_IOS">
+      <command_interface name="digital_outputs" data_type="uint8"/>
+      <state_interface name="status_word" data_type="uint16">
+        <param name="initial_value">65535</param>
+      </state_interface>
+    </gpio>
+  </ros2_control>
+)";
+
 // Errors
+const auto invalid_urdf_ros2_control_pipelined_detached_system =
+  R"(
+  <ros2_control name="RRBotPipelinedSystem" type="system" is_async="true">
+    <properties>
+      <async scheduling_policy="detached" pipelined="true"/>
+    </properties>
+    <hardware>
+      <plugin>ros2_control_demo_hardware/RRBotSystemWithGPIOHardware</plugin>
+    </hardware>
+    <joint name="joint1">
+      <command_interface name="velocity"/>
+      <state_interface name="position"/>
+    </joint>
+  </ros2_control>
+)";
+
+const auto invalid_urdf_ros2_control_sched_deadline_without_runtime_system =
+  R"(
+  <ros2_control name="RRBotDeadlineScheduledSystem" type="system" is_async="true">
+    <properties>
+      <async sched_deadline="1000"/>
+    </properties>
+    <hardware>
+      <plugin>ros2_control_demo_hardware/RRBotSystemWithGPIOHardware</plugin>
+    </hardware>
+    <joint name="joint1">
+      <command_interface name="velocity"/>
+      <state_interface name="position"/>
+    </joint>
+  </ros2_control>
+)";
+
 const auto invalid_urdf_ros2_control_invalid_child =
   R"(
   <ros2_control name="2DOF_System_Robot_Position_Only" type="system">